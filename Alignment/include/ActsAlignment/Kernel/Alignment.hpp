@@ -14,6 +14,8 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "ActsAlignment/Kernel/AlignmentSolver.hpp"
+#include "ActsAlignment/Kernel/detail/AlignmentAccumulator.hpp"
 #include "ActsAlignment/Kernel/detail/AlignmentEngine.hpp"
 
 #include <limits>
@@ -88,6 +90,9 @@ struct AlignmentOptions {
 
   // The alignment mask for different iterations
   std::map<unsigned int, AlignmentMask> iterationState;
+
+  // The threading and solver steering
+  AlignmentComputeOptions computeOptions;
 };
 
 /// @brief Alignment result struct
@@ -100,9 +105,13 @@ struct AlignmentResult {
   std::unordered_map<Acts::SurfacePlacementBase*, Acts::Transform3>
       alignedParameters;
 
-  // The covariance of alignment parameters
+  // The full covariance of alignment parameters, only filled for the dense
+  // solver or if requested in the compute options
   Acts::DynamicMatrix alignmentCovariance;
 
+  // The covariance block of each aligned surface
+  std::vector<Acts::AlignmentMatrix> alignmentCovarianceBlocks;
+
   // The average chi2/ndf (ndf is the measurement dim)
   double averageChi2ONdf = std::numeric_limits<double>::max();
 
@@ -118,7 +127,8 @@ struct AlignmentResult {
   // The alignment degree of freedom
   std::size_t alignmentDof = 0;
 
-  // The number of tracks used for alignment
+  // The number of tracks used for alignment, i.e. the tracks whose alignment
+  // state could be evaluated. Tracks failing the fit are not counted.
   std::size_t numTracks = 0;
 
   // The indexed alignable surfaces
@@ -182,13 +192,15 @@ struct Alignment {
   /// @param fitOptions The fit Options steering the fit
   /// @param alignResult [in, out] The aligned result
   /// @param alignMask The alignment mask (same for all measurements now)
+  /// @param computeOptions The threading and solver steering
   template <typename trajectory_container_t,
             typename start_parameters_container_t, typename fit_options_t>
   void calculateAlignmentParameters(
       const trajectory_container_t& trajectoryCollection,
       const start_parameters_container_t& startParametersCollection,
       const fit_options_t& fitOptions, AlignmentResult& alignResult,
-      const AlignmentMask& alignMask = AlignmentMask::All) const;
+      const AlignmentMask& alignMask = AlignmentMask::All,
+      const AlignmentComputeOptions& computeOptions = {}) const;
 
   /// @brief calculate the alignment parameters delta from a set of
   /// TrackAlignmentStates
@@ -196,10 +208,11 @@ struct Alignment {
   /// @param TrackStateCollection The collection of TrackAlignmentStates
   /// as input of fitting
   /// @param alignResult [in, out] The aligned result
-  /// @param alignMask The alignment mask (same for all measurements now)
+  /// @param computeOptions The threading and solver steering
   void calculateAlignmentParameters(
       const std::vector<detail::TrackAlignmentState>& trackAlignmentStates,
-      AlignmentResult& alignResult) const;
+      AlignmentResult& alignResult,
+      const AlignmentComputeOptions& computeOptions = {}) const;
 
   /// @brief update the detector element alignment parameters
   ///
@@ -234,6 +247,17 @@ struct Alignment {
       const AlignmentOptions<fit_options_t>& alignOptions) const;
 
  private:
+  /// @brief solve for the alignment parameters delta from the accumulated
+  /// chi2 derivatives
+  ///
+  /// @param accumulator The chi2 derivatives summed over all tracks
+  /// @param alignResult [in, out] The aligned result
+  /// @param computeOptions The solver steering
+  void solveAlignmentParameters(
+      const detail::AlignmentAccumulator& accumulator,
+      AlignmentResult& alignResult,
+      const AlignmentComputeOptions& computeOptions) const;
+
   // The fitter
   fitter_t m_fitter;
 
@@ -69,109 +69,104 @@ void ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
     const start_parameters_container_t& startParametersCollection,
     const fit_options_t& fitOptions,
     ActsAlignment::AlignmentResult& alignResult,
-    const ActsAlignment::AlignmentMask& alignMask) const {
+    const ActsAlignment::AlignmentMask& alignMask,
+    const ActsAlignment::AlignmentComputeOptions& computeOptions) const {
   // The number of trajectories must be equal to the number of starting
   // parameters
   assert(trajectoryCollection.size() == startParametersCollection.size());
 
-  // The total alignment degree of freedom
-  alignResult.alignmentDof =
-      alignResult.idxedAlignSurfaces.size() * Acts::eAlignmentSize;
-  // Copy the fit options
-  fit_options_t fitOptionsWithRefSurface = fitOptions;
-  // Calculate contribution to chi2 derivatives from all input trajectories
+  // Calculate contribution to chi2 derivatives from all input trajectories.
+  // Each chunk fits a contiguous range of trajectories and sums their
+  // contributions, the alignment states are not kept.
   // @Todo: How to update the source link error iteratively?
-  alignResult.chi2 = 0;
-  alignResult.measurementDim = 0;
-  alignResult.numTracks = trajectoryCollection.size();
-  std::vector<detail::TrackAlignmentState> alignmentStates;
-  for (unsigned int iTraj = 0; iTraj < trajectoryCollection.size(); iTraj++) {
-    const auto& sourceLinks = trajectoryCollection.at(iTraj);
-    const auto& sParameters = startParametersCollection.at(iTraj);
-    // Set the target surface
-    fitOptionsWithRefSurface.referenceSurface = &sParameters.referenceSurface();
-    // The result for one single track
-    auto evaluateRes = evaluateTrackAlignmentState(
-        fitOptions.geoContext, sourceLinks, sParameters,
-        fitOptionsWithRefSurface, alignResult.idxedAlignSurfaces, alignMask);
-    if (!evaluateRes.ok()) {
-      ACTS_DEBUG("Evaluation of alignment state for track " << iTraj
-                                                            << " failed");
-      continue;
+  const auto fillRange = [&](detail::AlignmentAccumulator& accumulator,
+                             std::size_t begin, std::size_t end) {
+    // Copy the fit options
+    fit_options_t fitOptionsWithRefSurface = fitOptions;
+    for (std::size_t iTraj = begin; iTraj < end; iTraj++) {
+      const auto& sourceLinks = trajectoryCollection.at(iTraj);
+      const auto& sParameters = startParametersCollection.at(iTraj);
+      // Set the target surface
+      fitOptionsWithRefSurface.referenceSurface =
+          &sParameters.referenceSurface();
+      // The result for one single track
+      auto evaluateRes = evaluateTrackAlignmentState(
+          fitOptions.geoContext, sourceLinks, sParameters,
+          fitOptionsWithRefSurface, alignResult.idxedAlignSurfaces,
+          alignMask);
+      if (!evaluateRes.ok()) {
+        ACTS_DEBUG("Evaluation of alignment state for track " << iTraj
+                                                              << " failed");
+        continue;
+      }
+      accumulator.add(evaluateRes.value());
     }
-    const auto& alignState = evaluateRes.value();
-    alignmentStates.push_back(alignState);
-  }
-  return calculateAlignmentParameters(alignmentStates, alignResult);
+  };
+  const detail::AlignmentAccumulator accumulator = detail::accumulateAlignment(
+      trajectoryCollection.size(), alignResult.idxedAlignSurfaces.size(),
+      computeOptions.executor.get(), fillRange);
+
+  solveAlignmentParameters(accumulator, alignResult, computeOptions);
 }
 
 template <typename fitter_t>
 void ActsAlignment::Alignment<fitter_t>::calculateAlignmentParameters(
     const std::vector<detail::TrackAlignmentState>& trackAlignmentStates,
-    AlignmentResult& alignResult) const {
-  // The total alignment degree of freedom
-  alignResult.alignmentDof =
-      alignResult.idxedAlignSurfaces.size() * Acts::eAlignmentSize;
-  // Initialize derivative of chi2 w.r.t. alignment parameters for all tracks
-  Acts::DynamicVector sumChi2Derivative =
-      Acts::DynamicVector::Zero(alignResult.alignmentDof);
-  Acts::DynamicMatrix sumChi2SecondDerivative = Acts::DynamicMatrix::Zero(
-      alignResult.alignmentDof, alignResult.alignmentDof);
-  alignResult.chi2 = 0;
-  alignResult.measurementDim = 0;
-  alignResult.numTracks = trackAlignmentStates.size();
-  double sumChi2ONdf = 0;
-  for (const auto& alignState : trackAlignmentStates) {
-    for (const auto& [rowSurface, rows] : alignState.alignedSurfaces) {
-      const auto& [dstRow, srcRow] = rows;
-      // Fill the results into full chi2 derivative matrix
-      sumChi2Derivative.segment<Acts::eAlignmentSize>(dstRow *
-                                                      Acts::eAlignmentSize) +=
-          alignState.alignmentToChi2Derivative.segment(
-              srcRow * Acts::eAlignmentSize, Acts::eAlignmentSize);
+    AlignmentResult& alignResult,
+    const AlignmentComputeOptions& computeOptions) const {
+  const detail::AlignmentAccumulator accumulator = detail::accumulateAlignment(
+      trackAlignmentStates.size(), alignResult.idxedAlignSurfaces.size(),
+      computeOptions.executor.get(),
+      [&](detail::AlignmentAccumulator& partial, std::size_t begin,
+          std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          partial.add(trackAlignmentStates[i]);
+        }
+      });
 
-      for (const auto& [colSurface, cols] : alignState.alignedSurfaces) {
-        const auto& [dstCol, srcCol] = cols;
-        sumChi2SecondDerivative
-            .block<Acts::eAlignmentSize, Acts::eAlignmentSize>(
-                dstRow * Acts::eAlignmentSize, dstCol * Acts::eAlignmentSize) +=
-            alignState.alignmentToChi2SecondDerivative.block(
-                srcRow * Acts::eAlignmentSize, srcCol * Acts::eAlignmentSize,
-                Acts::eAlignmentSize, Acts::eAlignmentSize);
-      }
-    }
-    alignResult.chi2 += alignState.chi2;
-    alignResult.measurementDim += alignState.measurementDim;
-    sumChi2ONdf += alignState.chi2 / alignState.measurementDim;
-  }
-  alignResult.averageChi2ONdf = sumChi2ONdf / alignResult.numTracks;
+  solveAlignmentParameters(accumulator, alignResult, computeOptions);
+}
+
+template <typename fitter_t>
+void ActsAlignment::Alignment<fitter_t>::solveAlignmentParameters(
+    const detail::AlignmentAccumulator& accumulator,
+    AlignmentResult& alignResult,
+    const AlignmentComputeOptions& computeOptions) const {
+  // The total alignment degree of freedom
+  alignResult.alignmentDof = accumulator.alignmentDof();
+  alignResult.chi2 = accumulator.chi2();
+  alignResult.measurementDim = accumulator.measurementDim();
+  alignResult.numTracks = accumulator.numTracks();
+  alignResult.averageChi2ONdf =
+      accumulator.sumChi2ONdf() / alignResult.numTracks;
+  ACTS_DEBUG("Accumulated " << accumulator.numBlocks()
+                            << " non-zero blocks of the chi2 second "
+                               "derivative from "
+                            << alignResult.numTracks << " tracks");
 
-  // Get the inverse of chi2 second derivative matrix (we need this to
-  // calculate the covariance of the alignment parameters)
   // @TODO: use more stable method for solving the inverse
-  std::size_t alignDof = alignResult.alignmentDof;
-  Acts::DynamicMatrix sumChi2SecondDerivativeInverse =
-      Acts::DynamicMatrix::Zero(alignDof, alignDof);
-  sumChi2SecondDerivativeInverse = sumChi2SecondDerivative.inverse();
-  if (sumChi2SecondDerivativeInverse.hasNaN()) {
-    ACTS_DEBUG("Chi2 second derivative inverse has NaN");
+  auto solution = detail::solveAlignment(accumulator, computeOptions);
+  if (!solution.success) {
+    if (computeOptions.solver == AlignmentSolver::Dense) {
+      ACTS_DEBUG("Chi2 second derivative inverse has NaN");
+    } else {
+      ACTS_WARNING("Sparse solve of the alignment parameters failed after "
+                   << solution.iterations << " iterations");
+    }
   }
 
-  // Initialize the alignment results
-  alignResult.deltaAlignmentParameters = Acts::DynamicVector::Zero(alignDof);
-  alignResult.alignmentCovariance =
-      Acts::DynamicMatrix::Zero(alignDof, alignDof);
-  // Solve the linear equation to get alignment parameters change
   alignResult.deltaAlignmentParameters =
-      -sumChi2SecondDerivative.fullPivLu().solve(sumChi2Derivative);
-  ACTS_VERBOSE("sumChi2SecondDerivative = \n" << sumChi2SecondDerivative);
-  ACTS_VERBOSE("sumChi2Derivative = \n" << sumChi2Derivative);
+      std::move(solution.deltaAlignmentParameters);
+  alignResult.alignmentCovariance = std::move(solution.alignmentCovariance);
+  alignResult.alignmentCovarianceBlocks =
+      std::move(solution.alignmentCovarianceBlocks);
+  ACTS_VERBOSE("sumChi2SecondDerivative = \n"
+               << accumulator.denseChi2SecondDerivative());
+  ACTS_VERBOSE("sumChi2Derivative = \n" << accumulator.chi2Derivative());
   ACTS_VERBOSE("alignResult.deltaAlignmentParameters \n");
 
-  // Alignment parameters covariance
-  alignResult.alignmentCovariance = 2 * sumChi2SecondDerivativeInverse;
   // chi2 change
-  alignResult.deltaChi2 = 0.5 * sumChi2Derivative.transpose() *
+  alignResult.deltaChi2 = 0.5 * accumulator.chi2Derivative().transpose() *
                           alignResult.deltaAlignmentParameters;
 }
 
@@ -270,7 +265,8 @@ ActsAlignment::Alignment<fitter_t>::align(
     // Calculate the alignment parameters delta etc.
     calculateAlignmentParameters(
         trajectoryCollection, startParametersCollection,
-        alignOptions.fitOptions, alignResult, alignMask);
+        alignOptions.fitOptions, alignResult, alignMask,
+        alignOptions.computeOptions);
     // Screen out the information
     ACTS_INFO("iIter = " << iIter << ", total chi2 = " << alignResult.chi2
                          << ", total measurementDim = "
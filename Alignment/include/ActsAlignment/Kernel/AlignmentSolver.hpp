@@ -0,0 +1,59 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ActsAlignment {
+
+/// Linear solvers for the alignment parameters update
+enum struct AlignmentSolver : std::uint8_t {
+  /// Dense LU decomposition and dense inverse of the full chi2 second
+  /// derivative, cubic in the number of alignment degrees of freedom
+  Dense = 0,
+  /// Sparse LDLT (Cholesky) decomposition of the block sparse chi2 second
+  /// derivative. The covariance is obtained from the same decomposition.
+  SparseCholesky = 1,
+  /// Conjugate gradient with a diagonal (Jacobi) preconditioner on the block
+  /// sparse chi2 second derivative. Only the diagonal blocks of the
+  /// covariance are computed, i.e. the correlations between different
+  /// detector elements are neglected.
+  ConjugateGradient = 2,
+};
+
+/// Steering of the chi2 derivative accumulation and of the linear solve
+struct AlignmentComputeOptions {
+  /// Executor running the track fits and the accumulation of their chi2
+  /// derivatives in chunks, see @c Acts::parallelFor. The partial sums of
+  /// the chunks are merged serially. Without an executor everything runs on
+  /// the calling thread.
+  std::shared_ptr<const Acts::ParallelExecutor> executor;
+
+  /// The solver for the alignment parameters update
+  AlignmentSolver solver = AlignmentSolver::Dense;
+
+  /// Compute the full covariance of the alignment parameters also for the
+  /// sparse solvers. This needs a dense matrix over all alignment degrees of
+  /// freedom; otherwise only the covariance block of each aligned surface is
+  /// computed. The dense solver always computes the full covariance.
+  bool fullCovariance = false;
+
+  /// Relative residual tolerance of the conjugate gradient solver
+  double cgTolerance = 1e-10;
+
+  /// Maximum number of conjugate gradient iterations, zero uses twice the
+  /// number of alignment degrees of freedom
+  std::size_t cgMaxIterations = 0;
+};
+
+}  // namespace ActsAlignment
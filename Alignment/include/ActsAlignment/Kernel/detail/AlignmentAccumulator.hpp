@@ -0,0 +1,155 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Alignment.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+#include "ActsAlignment/Kernel/AlignmentSolver.hpp"
+#include "ActsAlignment/Kernel/detail/AlignmentEngine.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/SparseCore>
+
+namespace ActsAlignment::detail {
+
+/// Sum of the chi2 derivatives of many tracks w.r.t. the alignment parameters
+///
+/// A track only couples the few alignable surfaces it crosses, so the chi2
+/// second derivative is kept as the non-zero 6x6 blocks of each block row
+/// instead of a dense matrix over all alignment degrees of freedom.
+class AlignmentAccumulator {
+ public:
+  /// Sparse matrix type of the chi2 second derivative
+  using SparseMatrix = Eigen::SparseMatrix<double>;
+
+  /// Constructor
+  ///
+  /// @param nAlignedSurfaces The number of alignable surfaces
+  explicit AlignmentAccumulator(std::size_t nAlignedSurfaces);
+
+  /// Add the contribution of a single track
+  ///
+  /// @param alignState The alignment state of the track
+  void add(const TrackAlignmentState& alignState);
+
+  /// Add the partial sums of another accumulator
+  ///
+  /// @param other The accumulator to merge, with the same number of surfaces
+  void merge(const AlignmentAccumulator& other);
+
+  /// The total number of alignment degrees of freedom
+  std::size_t alignmentDof() const {
+    return m_blocks.size() * Acts::eAlignmentSize;
+  }
+
+  /// The number of non-zero 6x6 blocks of the chi2 second derivative
+  std::size_t numBlocks() const;
+
+  /// The number of added tracks
+  std::size_t numTracks() const { return m_numTracks; }
+
+  /// The summed chi2
+  double chi2() const { return m_chi2; }
+
+  /// The summed measurement dimension
+  std::size_t measurementDim() const { return m_measurementDim; }
+
+  /// The summed chi2/ndf of the tracks
+  double sumChi2ONdf() const { return m_sumChi2ONdf; }
+
+  /// The summed derivative of the chi2 w.r.t. the alignment parameters
+  const Acts::DynamicVector& chi2Derivative() const { return m_chi2Derivative; }
+
+  /// The summed second derivative of the chi2 as dense matrix
+  Acts::DynamicMatrix denseChi2SecondDerivative() const;
+
+  /// The summed second derivative of the chi2 as sparse matrix
+  SparseMatrix sparseChi2SecondDerivative() const;
+
+ private:
+  std::vector<std::unordered_map<std::size_t, Acts::AlignmentMatrix>> m_blocks;
+  Acts::DynamicVector m_chi2Derivative;
+  std::size_t m_numTracks = 0;
+  double m_chi2 = 0;
+  std::size_t m_measurementDim = 0;
+  double m_sumChi2ONdf = 0;
+};
+
+/// Accumulate the chi2 derivatives of @p n items in parallel chunks
+///
+/// Each chunk of items fills its own accumulator by calling
+/// @p fill(accumulator, begin, end). The partial sums are merged serially in
+/// chunk order, so the result only depends on the number of chunks and not
+/// on their scheduling. Exceptions thrown by @p fill are propagated.
+///
+/// @param n The number of items
+/// @param nAlignedSurfaces The number of alignable surfaces
+/// @param executor The executor running the chunks, may be nullptr
+/// @param fill The function filling an accumulator from a range of items
+/// @return The accumulated chi2 derivatives of all items
+template <typename fill_t>
+AlignmentAccumulator accumulateAlignment(std::size_t n,
+                                         std::size_t nAlignedSurfaces,
+                                         const Acts::ParallelExecutor* executor,
+                                         const fill_t& fill) {
+  std::vector<AlignmentAccumulator> partial(
+      std::min(Acts::maxParallelChunks(executor), std::max<std::size_t>(n, 1)),
+      AlignmentAccumulator(nAlignedSurfaces));
+  const std::size_t nChunks = Acts::parallelFor(
+      executor, n,
+      [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        fill(partial[chunk], begin, end);
+      });
+
+  for (std::size_t chunk = 1; chunk < nChunks; ++chunk) {
+    partial.front().merge(partial[chunk]);
+  }
+  return std::move(partial.front());
+}
+
+/// The solution of the alignment linear system
+struct AlignmentSolution {
+  /// The change of the alignment parameters
+  Acts::DynamicVector deltaAlignmentParameters;
+
+  /// The full covariance of the alignment parameters, only filled for the
+  /// dense solver or if requested in the options
+  Acts::DynamicMatrix alignmentCovariance;
+
+  /// The 6x6 covariance block of each aligned surface
+  std::vector<Acts::AlignmentMatrix> alignmentCovarianceBlocks;
+
+  /// Whether the decomposition succeeded or the iterative solver converged
+  bool success = true;
+
+  /// The number of iterations of an iterative solver
+  std::size_t iterations = 0;
+};
+
+/// Solve for the alignment parameters update
+///
+/// The sparse solvers only consider degrees of freedom with a non-zero
+/// diagonal in the chi2 second derivative, i.e. those that are constrained
+/// by at least one track and not masked. The others are left unchanged and
+/// have zero covariance. Without the full covariance, the sparse Cholesky
+/// solver computes the covariance blocks of the aligned surfaces by solving
+/// only for the columns of each block.
+///
+/// @param accumulator The accumulated chi2 derivatives
+/// @param options The solver options
+/// @return The alignment parameters update and its covariance
+AlignmentSolution solveAlignment(const AlignmentAccumulator& accumulator,
+                                 const AlignmentComputeOptions& options);
+
+}  // namespace ActsAlignment::detail
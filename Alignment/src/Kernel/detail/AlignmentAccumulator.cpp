@@ -0,0 +1,300 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsAlignment/Kernel/detail/AlignmentAccumulator.hpp"
+
+#include <cassert>
+#include <utility>
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCholesky>
+
+namespace ActsAlignment::detail {
+
+namespace {
+
+constexpr std::size_t kBlock = Acts::eAlignmentSize;
+
+/// Sparse matrix restricted to the degrees of freedom with non-zero diagonal
+struct ReducedSystem {
+  AlignmentAccumulator::SparseMatrix matrix;
+  Acts::DynamicVector rhs;
+  /// Full index of each reduced index
+  std::vector<std::size_t> fullIndex;
+};
+
+ReducedSystem reduceSystem(const AlignmentAccumulator::SparseMatrix& matrix,
+                           const Acts::DynamicVector& rhs) {
+  const auto n = static_cast<std::size_t>(matrix.rows());
+  const Acts::DynamicVector diagonal = matrix.diagonal();
+
+  ReducedSystem reduced;
+  std::vector<std::ptrdiff_t> reducedIndex(n, -1);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (diagonal[i] != 0) {
+      reducedIndex[i] = reduced.fullIndex.size();
+      reduced.fullIndex.push_back(i);
+    }
+  }
+
+  const auto nReduced = static_cast<Eigen::Index>(reduced.fullIndex.size());
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(matrix.nonZeros());
+  for (Eigen::Index col = 0; col < matrix.outerSize(); ++col) {
+    for (AlignmentAccumulator::SparseMatrix::InnerIterator it(matrix, col); it;
+         ++it) {
+      const std::ptrdiff_t row = reducedIndex[it.row()];
+      const std::ptrdiff_t reducedCol = reducedIndex[it.col()];
+      if (row >= 0 && reducedCol >= 0) {
+        triplets.emplace_back(row, reducedCol, it.value());
+      }
+    }
+  }
+  reduced.matrix.resize(nReduced, nReduced);
+  reduced.matrix.setFromTriplets(triplets.begin(), triplets.end());
+
+  reduced.rhs.resize(nReduced);
+  for (Eigen::Index i = 0; i < nReduced; ++i) {
+    reduced.rhs[i] = rhs[reduced.fullIndex[i]];
+  }
+  return reduced;
+}
+
+/// Half-open ranges of reduced indices belonging to the same aligned surface
+std::vector<std::pair<std::size_t, std::size_t>> surfaceRanges(
+    const ReducedSystem& reduced) {
+  std::vector<std::pair<std::size_t, std::size_t>> ranges;
+  std::size_t begin = 0;
+  while (begin < reduced.fullIndex.size()) {
+    // Reduced indices of the same detector element are consecutive
+    const std::size_t block = reduced.fullIndex[begin] / kBlock;
+    std::size_t end = begin;
+    while (end < reduced.fullIndex.size() &&
+           reduced.fullIndex[end] / kBlock == block) {
+      ++end;
+    }
+    ranges.emplace_back(begin, end);
+    begin = end;
+  }
+  return ranges;
+}
+
+/// Scatter a square block of the reduced system into the covariance block of
+/// its aligned surface
+void scatterBlock(const ReducedSystem& reduced, std::size_t begin,
+                  const Acts::DynamicMatrix& reducedBlock,
+                  std::vector<Acts::AlignmentMatrix>& blocks) {
+  auto& block = blocks[reduced.fullIndex[begin] / kBlock];
+  for (Eigen::Index i = 0; i < reducedBlock.rows(); ++i) {
+    for (Eigen::Index j = 0; j < reducedBlock.cols(); ++j) {
+      block(reduced.fullIndex[begin + i] % kBlock,
+            reduced.fullIndex[begin + j] % kBlock) = 2 * reducedBlock(i, j);
+    }
+  }
+}
+
+/// Covariance blocks of the aligned surfaces scattered into a full matrix
+Acts::DynamicMatrix scatterBlocks(
+    const std::vector<Acts::AlignmentMatrix>& blocks) {
+  const auto alignDof = static_cast<Eigen::Index>(blocks.size() * kBlock);
+  Acts::DynamicMatrix covariance =
+      Acts::DynamicMatrix::Zero(alignDof, alignDof);
+  for (std::size_t i = 0; i < blocks.size(); ++i) {
+    covariance.block<kBlock, kBlock>(i * kBlock, i * kBlock) = blocks[i];
+  }
+  return covariance;
+}
+
+}  // namespace
+
+AlignmentAccumulator::AlignmentAccumulator(std::size_t nAlignedSurfaces)
+    : m_blocks(nAlignedSurfaces),
+      m_chi2Derivative(
+          Acts::DynamicVector::Zero(nAlignedSurfaces * Acts::eAlignmentSize)) {}
+
+void AlignmentAccumulator::add(const TrackAlignmentState& alignState) {
+  for (const auto& [rowSurface, rows] : alignState.alignedSurfaces) {
+    const auto& [dstRow, srcRow] = rows;
+    // Fill the results into full chi2 derivative matrix
+    m_chi2Derivative.segment<kBlock>(dstRow * kBlock) +=
+        alignState.alignmentToChi2Derivative.segment(srcRow * kBlock, kBlock);
+
+    auto& blockRow = m_blocks[dstRow];
+    for (const auto& [colSurface, cols] : alignState.alignedSurfaces) {
+      const auto& [dstCol, srcCol] = cols;
+      auto [it, inserted] =
+          blockRow.try_emplace(dstCol, Acts::AlignmentMatrix::Zero());
+      it->second += alignState.alignmentToChi2SecondDerivative.block(
+          srcRow * kBlock, srcCol * kBlock, kBlock, kBlock);
+    }
+  }
+  ++m_numTracks;
+  m_chi2 += alignState.chi2;
+  m_measurementDim += alignState.measurementDim;
+  m_sumChi2ONdf += alignState.chi2 / alignState.measurementDim;
+}
+
+void AlignmentAccumulator::merge(const AlignmentAccumulator& other) {
+  assert(m_blocks.size() == other.m_blocks.size() &&
+         "Inconsistent number of aligned surfaces");
+
+  for (std::size_t row = 0; row < m_blocks.size(); ++row) {
+    for (const auto& [col, block] : other.m_blocks[row]) {
+      auto [it, inserted] = m_blocks[row].try_emplace(col, block);
+      if (!inserted) {
+        it->second += block;
+      }
+    }
+  }
+  m_chi2Derivative += other.m_chi2Derivative;
+  m_numTracks += other.m_numTracks;
+  m_chi2 += other.m_chi2;
+  m_measurementDim += other.m_measurementDim;
+  m_sumChi2ONdf += other.m_sumChi2ONdf;
+}
+
+std::size_t AlignmentAccumulator::numBlocks() const {
+  std::size_t nBlocks = 0;
+  for (const auto& blockRow : m_blocks) {
+    nBlocks += blockRow.size();
+  }
+  return nBlocks;
+}
+
+Acts::DynamicMatrix AlignmentAccumulator::denseChi2SecondDerivative() const {
+  Acts::DynamicMatrix dense =
+      Acts::DynamicMatrix::Zero(alignmentDof(), alignmentDof());
+  for (std::size_t row = 0; row < m_blocks.size(); ++row) {
+    for (const auto& [col, block] : m_blocks[row]) {
+      dense.block<kBlock, kBlock>(row * kBlock, col * kBlock) = block;
+    }
+  }
+  return dense;
+}
+
+AlignmentAccumulator::SparseMatrix
+AlignmentAccumulator::sparseChi2SecondDerivative() const {
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(numBlocks() * kBlock * kBlock);
+  for (std::size_t row = 0; row < m_blocks.size(); ++row) {
+    for (const auto& [col, block] : m_blocks[row]) {
+      for (std::size_t i = 0; i < kBlock; ++i) {
+        for (std::size_t j = 0; j < kBlock; ++j) {
+          // Masked degrees of freedom leave empty rows and columns
+          if (block(i, j) != 0) {
+            triplets.emplace_back(row * kBlock + i, col * kBlock + j,
+                                  block(i, j));
+          }
+        }
+      }
+    }
+  }
+  SparseMatrix sparse(alignmentDof(), alignmentDof());
+  sparse.setFromTriplets(triplets.begin(), triplets.end());
+  return sparse;
+}
+
+AlignmentSolution solveAlignment(const AlignmentAccumulator& accumulator,
+                                 const AlignmentComputeOptions& options) {
+  const std::size_t alignDof = accumulator.alignmentDof();
+  const Acts::DynamicVector& chi2Derivative = accumulator.chi2Derivative();
+
+  AlignmentSolution solution;
+
+  if (options.solver == AlignmentSolver::Dense) {
+    const Acts::DynamicMatrix chi2SecondDerivative =
+        accumulator.denseChi2SecondDerivative();
+    // Solve the linear equation to get alignment parameters change
+    solution.deltaAlignmentParameters =
+        -chi2SecondDerivative.fullPivLu().solve(chi2Derivative);
+    // Alignment parameters covariance
+    solution.alignmentCovariance = 2 * chi2SecondDerivative.inverse();
+    solution.success = !solution.alignmentCovariance.hasNaN();
+    for (std::size_t i = 0; i < alignDof / kBlock; ++i) {
+      solution.alignmentCovarianceBlocks.push_back(
+          solution.alignmentCovariance.block<kBlock, kBlock>(i * kBlock,
+                                                             i * kBlock));
+    }
+    return solution;
+  }
+
+  const ReducedSystem reduced = reduceSystem(
+      accumulator.sparseChi2SecondDerivative(), chi2Derivative);
+  const auto nReduced = static_cast<Eigen::Index>(reduced.fullIndex.size());
+  const auto ranges = surfaceRanges(reduced);
+
+  Acts::DynamicVector reducedDelta;
+  solution.alignmentCovarianceBlocks.assign(alignDof / kBlock,
+                                            Acts::AlignmentMatrix::Zero());
+  if (options.solver == AlignmentSolver::SparseCholesky) {
+    Eigen::SimplicialLDLT<AlignmentAccumulator::SparseMatrix> ldlt(
+        reduced.matrix);
+    solution.success = ldlt.info() == Eigen::Success;
+    if (solution.success) {
+      reducedDelta = -ldlt.solve(reduced.rhs);
+      if (options.fullCovariance) {
+        const Acts::DynamicMatrix reducedInverse =
+            ldlt.solve(Acts::DynamicMatrix::Identity(nReduced, nReduced));
+        solution.alignmentCovariance =
+            Acts::DynamicMatrix::Zero(alignDof, alignDof);
+        for (Eigen::Index i = 0; i < nReduced; ++i) {
+          for (Eigen::Index j = 0; j < nReduced; ++j) {
+            solution.alignmentCovariance(reduced.fullIndex[i],
+                                         reduced.fullIndex[j]) =
+                2 * reducedInverse(i, j);
+          }
+        }
+      }
+      // Solve only for the columns of each aligned surface
+      for (const auto& [begin, end] : ranges) {
+        const auto size = static_cast<Eigen::Index>(end - begin);
+        Acts::DynamicMatrix unitColumns =
+            Acts::DynamicMatrix::Zero(nReduced, size);
+        unitColumns.middleRows(begin, size).setIdentity();
+        const Acts::DynamicMatrix columns = ldlt.solve(unitColumns);
+        scatterBlock(reduced, begin, columns.middleRows(begin, size),
+                     solution.alignmentCovarianceBlocks);
+      }
+    }
+  } else {
+    Eigen::ConjugateGradient<AlignmentAccumulator::SparseMatrix,
+                             Eigen::Lower | Eigen::Upper,
+                             Eigen::DiagonalPreconditioner<double>>
+        cg;
+    cg.setTolerance(options.cgTolerance);
+    if (options.cgMaxIterations > 0) {
+      cg.setMaxIterations(options.cgMaxIterations);
+    }
+    cg.compute(reduced.matrix);
+    reducedDelta = -cg.solve(reduced.rhs);
+    solution.success = cg.info() == Eigen::Success;
+    solution.iterations = cg.iterations();
+    // Inverse of the diagonal blocks, neglecting the correlations
+    for (const auto& [begin, end] : ranges) {
+      const auto size = static_cast<Eigen::Index>(end - begin);
+      const Acts::DynamicMatrix diagonalBlock =
+          reduced.matrix.block(begin, begin, size, size).toDense();
+      scatterBlock(reduced, begin, diagonalBlock.inverse(),
+                   solution.alignmentCovarianceBlocks);
+    }
+    if (options.fullCovariance) {
+      solution.alignmentCovariance =
+          scatterBlocks(solution.alignmentCovarianceBlocks);
+    }
+  }
+
+  solution.deltaAlignmentParameters = Acts::DynamicVector::Zero(alignDof);
+  if (solution.success) {
+    for (Eigen::Index i = 0; i < nReduced; ++i) {
+      solution.deltaAlignmentParameters[reduced.fullIndex[i]] = reducedDelta[i];
+    }
+  }
+  return solution;
+}
+
+}  // namespace ActsAlignment::detail
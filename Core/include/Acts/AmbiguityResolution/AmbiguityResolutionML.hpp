@@ -15,6 +15,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Acts {
@@ -43,6 +44,20 @@ class AmbiguityResolutionML {
         m_duplicateClassifier(m_cfg.inputDuplicateNN.c_str()),
         m_logger{std::move(logger)} {}
 
+  /// Construct the ambiguity resolution algorithm with additional network
+  /// arguments.
+  ///
+  /// @param cfg is the algorithm configuration
+  /// @param logger is the logging instance
+  /// @param networkArgs are passed to the network constructor after the model path
+  template <typename... network_args_t>
+  AmbiguityResolutionML(const Config& cfg, std::unique_ptr<const Logger> logger,
+                        network_args_t&&... networkArgs)
+      : m_cfg{cfg},
+        m_duplicateClassifier(m_cfg.inputDuplicateNN.c_str(),
+                              std::forward<network_args_t>(networkArgs)...),
+        m_logger{std::move(logger)} {}
+
   /// Associate the hits to the tracks
   ///
   /// This algorithm performs the mapping of hits ID to track ID. Our final goal
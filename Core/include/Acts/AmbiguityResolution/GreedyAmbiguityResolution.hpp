@@ -10,6 +10,7 @@
 
 #include "Acts/EventData/TrackContainerFrontendConcept.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <memory>
 
@@ -38,10 +39,19 @@ class GreedyAmbiguityResolution {
     /// Maximum amount of shared hits per track.
     std::uint32_t maximumSharedHits = 1;
     /// Maximum number of iterations
+    ///
+    /// @note resolveComponents applies this limit and the shared hits stop
+    ///       criterion to every group of connected tracks separately. For
+    ///       `maximumSharedHits > 1`, or if the limit is reached, it can
+    ///       therefore select different tracks than resolve.
     std::uint32_t maximumIterations = 1000;
 
     /// Minimum number of measurement to form a track.
     std::size_t nMeasurementsMin = 7;
+
+    /// Optional executor running resolveComponents, without one all groups
+    /// are resolved on the calling thread
+    std::shared_ptr<const ParallelExecutor> executor;
   };
 
   /// Mutable state used by the greedy ambiguity resolution.
@@ -98,6 +108,23 @@ class GreedyAmbiguityResolution {
   /// @param state A state object that was previously filled by the initialization.
   void resolve(State& state) const;
 
+  /// Updates the state like resolve, but splits the tracks into groups that
+  /// are connected by shared measurements and resolves every group on its own.
+  ///
+  /// The measurement to track relations are stored in flat arrays and the
+  /// candidate for eviction is taken from a priority queue that is updated
+  /// whenever a shared count changes, so the cost grows close to linearly with
+  /// the number of tracks. Contiguous ranges of groups are resolved by
+  /// `Config::executor` and the result does not depend on the number of
+  /// chunks.
+  ///
+  /// @note The stop criterion and the iteration limit are applied per group.
+  ///       For `maximumSharedHits <= 1` and an iteration limit that is not
+  ///       reached the selection is identical to the one of resolve.
+  ///
+  /// @param state A state object that was previously filled by the initialization.
+  void resolveComponents(State& state) const;
+
  private:
   Config m_cfg;
 
@@ -15,11 +15,13 @@
 #include "Acts/EventData/TrackStateProxy.hpp"
 #include "Acts/Utilities/Delegate.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <cstddef>
 #include <map>
 #include <memory>
 #include <numbers>
+#include <span>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -140,6 +142,11 @@ class ScoreBasedAmbiguityResolution {
     // if true, the ambiguity score is computed based on a different function.
     /// Flag to enable alternative ambiguity scoring algorithm
     bool useAmbiguityScoring = false;
+
+    /// Optional executor used by solveAmbiguity to compute the features and
+    /// scores and to clean the tracks. The optional functions have to be
+    /// safe to call concurrently if it runs chunks in parallel.
+    std::shared_ptr<const ParallelExecutor> executor;
   };
 
   /// @brief Optionals struct: contains the optional cuts, weights and score to be applied.
@@ -247,6 +254,10 @@ class ScoreBasedAmbiguityResolution {
 
   /// Remove tracks that are bad based on cuts and weighted scores.
   ///
+  /// Every track is judged on its own against the number of tracks per
+  /// measurement, so features, scores and the hit cleaning run in chunks on
+  /// `Config::executor` with a result independent of the number of chunks.
+  ///
   /// @brief Remove tracks that are not good enough
   /// @param tracks is the input track container
   /// @param sourceLinkHash is the  source links
@@ -262,6 +273,37 @@ class ScoreBasedAmbiguityResolution {
           {}) const;
 
  private:
+  /// Count the features of a single track per detector
+  template <TrackProxyConcept track_proxy_t>
+  std::vector<TrackFeatures> computeTrackFeatures(
+      const track_proxy_t& track) const;
+
+  /// Score of a single track as computed by simpleScore
+  template <TrackProxyConcept track_proxy_t>
+  double simpleTrackScore(const track_proxy_t& track,
+                          const std::vector<TrackFeatures>& trackFeaturesVector,
+                          const Optionals<track_proxy_t>& optionals,
+                          std::size_t iTrack) const;
+
+  /// Score of a single track as computed by ambiguityScore
+  template <TrackProxyConcept track_proxy_t>
+  double ambiguityTrackScore(
+      const track_proxy_t& track,
+      const std::vector<TrackFeatures>& trackFeaturesVector,
+      const Optionals<track_proxy_t>& optionals, std::size_t iTrack) const;
+
+  /// Implementation of getCleanedOutTracks for any lookup of the number of
+  /// tracks per measurement, which returns zero for unknown measurements
+  template <TrackProxyConcept track_proxy_t, typename count_lookup_t>
+  bool isCleanTrack(
+      const track_proxy_t& track, const double& trackScore,
+      std::span<const std::size_t> measurementsPerTrack,
+      const count_lookup_t& nTracksPerMeasurement,
+      const std::vector<std::function<
+          void(const track_proxy_t&,
+               const typename track_proxy_t::ConstTrackStateProxy&,
+               TrackStateTypes&)>>& optionalHitSelections) const;
+
   Config m_cfg;
 
   /// Logging instance
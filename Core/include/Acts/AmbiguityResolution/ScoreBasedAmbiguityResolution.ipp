@@ -12,8 +12,12 @@
 
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/TrackContainerFrontendConcept.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <span>
 #include <unordered_map>
 
 namespace Acts {
@@ -31,43 +35,51 @@ ScoreBasedAmbiguityResolution::computeInitialState(
   trackFeaturesVectors.reserve(tracks.size());
 
   for (const auto& track : tracks) {
-    std::size_t numberOfDetectors = m_cfg.detectorConfigs.size();
+    trackFeaturesVectors.push_back(computeTrackFeatures(track));
+  }
 
-    std::vector<TrackFeatures> trackFeaturesVector(numberOfDetectors);
+  return trackFeaturesVectors;
+}
 
-    for (const auto& ts : track.trackStatesReversed()) {
-      if (!ts.hasReferenceSurface()) {
-        ACTS_DEBUG("Track state has no reference surface");
-        continue;
-      }
-      auto iVolume = ts.referenceSurface().geometryId().volume();
-      auto volume_it = m_cfg.volumeMap.find(iVolume);
-      if (volume_it == m_cfg.volumeMap.end()) {
-        ACTS_ERROR("Volume " << iVolume << "not found in the volume map");
-        continue;
-      }
-      auto detectorId = volume_it->second;
+template <TrackProxyConcept track_proxy_t>
+std::vector<ScoreBasedAmbiguityResolution::TrackFeatures>
+ScoreBasedAmbiguityResolution::computeTrackFeatures(
+    const track_proxy_t& track) const {
+  std::size_t numberOfDetectors = m_cfg.detectorConfigs.size();
 
-      if (ts.typeFlags().isHole()) {
-        ACTS_VERBOSE("Track state type is HoleFlag");
-        trackFeaturesVector[detectorId].nHoles++;
-      } else if (ts.typeFlags().isOutlier()) {
-        ACTS_VERBOSE("Track state type is OutlierFlag");
-        trackFeaturesVector[detectorId].nOutliers++;
+  std::vector<TrackFeatures> trackFeaturesVector(numberOfDetectors);
 
-      } else if (ts.typeFlags().isMeasurement()) {
-        ACTS_VERBOSE("Track state type is MeasurementFlag");
+  for (const auto& ts : track.trackStatesReversed()) {
+    if (!ts.hasReferenceSurface()) {
+      ACTS_DEBUG("Track state has no reference surface");
+      continue;
+    }
+    auto iVolume = ts.referenceSurface().geometryId().volume();
+    auto volume_it = m_cfg.volumeMap.find(iVolume);
+    if (volume_it == m_cfg.volumeMap.end()) {
+      ACTS_ERROR("Volume " << iVolume << "not found in the volume map");
+      continue;
+    }
+    auto detectorId = volume_it->second;
 
-        if (ts.typeFlags().isSharedHit()) {
-          trackFeaturesVector[detectorId].nSharedHits++;
-        }
-        trackFeaturesVector[detectorId].nHits++;
+    if (ts.typeFlags().isHole()) {
+      ACTS_VERBOSE("Track state type is HoleFlag");
+      trackFeaturesVector[detectorId].nHoles++;
+    } else if (ts.typeFlags().isOutlier()) {
+      ACTS_VERBOSE("Track state type is OutlierFlag");
+      trackFeaturesVector[detectorId].nOutliers++;
+
+    } else if (ts.typeFlags().isMeasurement()) {
+      ACTS_VERBOSE("Track state type is MeasurementFlag");
+
+      if (ts.typeFlags().isSharedHit()) {
+        trackFeaturesVector[detectorId].nSharedHits++;
       }
+      trackFeaturesVector[detectorId].nHits++;
     }
-    trackFeaturesVectors.push_back(std::move(trackFeaturesVector));
   }
 
-  return trackFeaturesVectors;
+  return trackFeaturesVector;
 }
 
 template <TrackContainerFrontend track_container_t>
@@ -79,112 +91,109 @@ std::vector<double> Acts::ScoreBasedAmbiguityResolution::simpleScore(
   std::vector<double> trackScore;
   trackScore.reserve(tracks.size());
 
-  int iTrack = 0;
-
   ACTS_VERBOSE("Number of detectors: " << m_cfg.detectorConfigs.size());
 
   ACTS_INFO("Starting to score tracks");
 
   // Loop over all the tracks in the container
-  for (const auto& track : tracks) {
-    // get the trackFeatures map for the track
-    const auto& trackFeaturesVector = trackFeaturesVectors[iTrack];
-    double score = 1;
-    auto eta = Acts::VectorHelpers::eta(track.momentum());
-
-    // cuts on optional cuts
-    for (const auto& cutFunction : optionals.cuts) {
-      if (cutFunction(track)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to optional cuts.");
-        break;
-      }
-    }
+  for (std::size_t iTrack = 0; const auto& track : tracks) {
+    trackScore.push_back(simpleTrackScore(track, trackFeaturesVectors[iTrack],
+                                          optionals, iTrack));
+    ++iTrack;
+  }
 
-    if (score == 0) {
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
-    }
+  return trackScore;
+}
 
-    // Reject tracks which didn't pass the detector cuts.
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
-
-      ACTS_VERBOSE("---> Found summary information");
-      ACTS_VERBOSE("---> Detector ID: " << detectorId);
-      ACTS_VERBOSE("---> Number of hits: " << trackFeatures.nHits);
-      ACTS_VERBOSE("---> Number of holes: " << trackFeatures.nHoles);
-      ACTS_VERBOSE("---> Number of outliers: " << trackFeatures.nOutliers);
-
-      // eta based cuts
-      if (etaBasedCuts(detector, trackFeatures, eta)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to detector cuts");
-        break;
-      }
+template <TrackProxyConcept track_proxy_t>
+double ScoreBasedAmbiguityResolution::simpleTrackScore(
+    const track_proxy_t& track,
+    const std::vector<TrackFeatures>& trackFeaturesVector,
+    const Optionals<track_proxy_t>& optionals, std::size_t iTrack) const {
+  double score = 1;
+  auto eta = Acts::VectorHelpers::eta(track.momentum());
+
+  // cuts on optional cuts
+  for (const auto& cutFunction : optionals.cuts) {
+    if (cutFunction(track)) {
+      score = 0;
+      ACTS_DEBUG("Track: " << iTrack
+                           << " has score = 0, due to optional cuts.");
+      break;
     }
+  }
 
-    if (score == 0) {
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
-    }
+  if (score == 0) {
+    ACTS_DEBUG("Track: " << iTrack << " score : " << score);
+    return score;
+  }
 
-    // All cuts passed, now start scoring the track
-
-    ACTS_VERBOSE("Using Simple Scoring function");
-
-    score = 100;
-    // Adding the score for each detector.
-    // detector score is determined by the number of hits/hole/outliers *
-    // hit/hole/outlier scoreWeights in a detector.
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
-
-      score +=
-          static_cast<double>(trackFeatures.nHits * detector.hitsScoreWeight);
-      score +=
-          static_cast<double>(trackFeatures.nHoles * detector.holesScoreWeight);
-      score += static_cast<double>(trackFeatures.nOutliers *
-                                   detector.outliersScoreWeight);
-      score += static_cast<double>(trackFeatures.nSharedHits *
-                                   detector.otherScoreWeight);
-    }
+  // Reject tracks which didn't pass the detector cuts.
+  for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
+       detectorId++) {
+    const auto& detector = m_cfg.detectorConfigs.at(detectorId);
 
-    // Adding scores based on optional weights
-    for (const auto& weightFunction : optionals.weights) {
-      weightFunction(track, score);
-    }
+    const auto& trackFeatures = trackFeaturesVector[detectorId];
 
-    // Adding the score based on the chi2/ndf
-    if (track.chi2() > 0 && track.nDoF() > 0) {
-      double p = 1. / std::log10(10. + 10. * track.chi2() / track.nDoF());
-      if (p > 0) {
-        score += p;
-      } else {
-        score -= 50;
-      }
+    ACTS_VERBOSE("---> Found summary information");
+    ACTS_VERBOSE("---> Detector ID: " << detectorId);
+    ACTS_VERBOSE("---> Number of hits: " << trackFeatures.nHits);
+    ACTS_VERBOSE("---> Number of holes: " << trackFeatures.nHoles);
+    ACTS_VERBOSE("---> Number of outliers: " << trackFeatures.nOutliers);
+
+    // eta based cuts
+    if (etaBasedCuts(detector, trackFeatures, eta)) {
+      score = 0;
+      ACTS_DEBUG("Track: " << iTrack << " has score = 0, due to detector cuts");
+      break;
     }
+  }
 
-    iTrack++;
+  if (score == 0) {
+    ACTS_DEBUG("Track: " << iTrack << " score : " << score);
+    return score;
+  }
 
-    // Add the score to the vector
-    trackScore.push_back(score);
-    ACTS_VERBOSE("Track: " << iTrack << " score: " << score);
+  // All cuts passed, now start scoring the track
+
+  ACTS_VERBOSE("Using Simple Scoring function");
+
+  score = 100;
+  // Adding the score for each detector.
+  // detector score is determined by the number of hits/hole/outliers *
+  // hit/hole/outlier scoreWeights in a detector.
+  for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
+       detectorId++) {
+    const auto& detector = m_cfg.detectorConfigs.at(detectorId);
+    const auto& trackFeatures = trackFeaturesVector[detectorId];
+
+    score +=
+        static_cast<double>(trackFeatures.nHits * detector.hitsScoreWeight);
+    score +=
+        static_cast<double>(trackFeatures.nHoles * detector.holesScoreWeight);
+    score += static_cast<double>(trackFeatures.nOutliers *
+                                 detector.outliersScoreWeight);
+    score += static_cast<double>(trackFeatures.nSharedHits *
+                                 detector.otherScoreWeight);
+  }
 
-  }  // end of loop over tracks
+  // Adding scores based on optional weights
+  for (const auto& weightFunction : optionals.weights) {
+    weightFunction(track, score);
+  }
 
-  return trackScore;
+  // Adding the score based on the chi2/ndf
+  if (track.chi2() > 0 && track.nDoF() > 0) {
+    double p = 1. / std::log10(10. + 10. * track.chi2() / track.nDoF());
+    if (p > 0) {
+      score += p;
+    } else {
+      score -= 50;
+    }
+  }
+
+  ACTS_VERBOSE("Track: " << iTrack << " score: " << score);
+  return score;
 }
 
 template <TrackContainerFrontend track_container_t>
@@ -198,130 +207,127 @@ std::vector<double> Acts::ScoreBasedAmbiguityResolution::ambiguityScore(
 
   ACTS_VERBOSE("Using Ambiguity Scoring function");
 
-  int iTrack = 0;
-
   ACTS_VERBOSE("Number of detectors: " << m_cfg.detectorConfigs.size());
 
   ACTS_INFO("Starting to score tracks");
 
   // Loop over all the tracks in the container
-  for (const auto& track : tracks) {
-    // get the trackFeatures map for the track
-    const auto& trackFeaturesVector = trackFeaturesVectors[iTrack];
-    double score = 1;
-    auto pT = Acts::VectorHelpers::perp(track.momentum());
-    auto eta = Acts::VectorHelpers::eta(track.momentum());
-
-    // cuts on optional cuts
-    for (const auto& cutFunction : optionals.cuts) {
-      if (cutFunction(track)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to optional cuts.");
-        break;
-      }
-    }
+  for (std::size_t iTrack = 0; const auto& track : tracks) {
+    trackScore.push_back(ambiguityTrackScore(
+        track, trackFeaturesVectors[iTrack], optionals, iTrack));
+    ++iTrack;
+  }
 
-    if (score == 0) {
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
-    }
+  return trackScore;
+}
 
-    // Reject tracks which didn't pass the detector cuts.
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
-
-      ACTS_VERBOSE("---> Found summary information");
-      ACTS_VERBOSE("---> Detector ID: " << detectorId);
-      ACTS_VERBOSE("---> Number of hits: " << trackFeatures.nHits);
-      ACTS_VERBOSE("---> Number of holes: " << trackFeatures.nHoles);
-      ACTS_VERBOSE("---> Number of outliers: " << trackFeatures.nOutliers);
-
-      // eta based cuts
-      if (etaBasedCuts(detector, trackFeatures, eta)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to detector cuts");
-        break;
-      }
+template <TrackProxyConcept track_proxy_t>
+double ScoreBasedAmbiguityResolution::ambiguityTrackScore(
+    const track_proxy_t& track,
+    const std::vector<TrackFeatures>& trackFeaturesVector,
+    const Optionals<track_proxy_t>& optionals, std::size_t iTrack) const {
+  double score = 1;
+  auto pT = Acts::VectorHelpers::perp(track.momentum());
+  auto eta = Acts::VectorHelpers::eta(track.momentum());
+
+  // cuts on optional cuts
+  for (const auto& cutFunction : optionals.cuts) {
+    if (cutFunction(track)) {
+      score = 0;
+      ACTS_DEBUG("Track: " << iTrack
+                           << " has score = 0, due to optional cuts.");
+      break;
     }
+  }
 
-    if (score == 0) {
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
+  if (score == 0) {
+    ACTS_DEBUG("Track: " << iTrack << " score : " << score);
+    return score;
+  }
+
+  // Reject tracks which didn't pass the detector cuts.
+  for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
+       detectorId++) {
+    const auto& detector = m_cfg.detectorConfigs.at(detectorId);
+
+    const auto& trackFeatures = trackFeaturesVector[detectorId];
+
+    ACTS_VERBOSE("---> Found summary information");
+    ACTS_VERBOSE("---> Detector ID: " << detectorId);
+    ACTS_VERBOSE("---> Number of hits: " << trackFeatures.nHits);
+    ACTS_VERBOSE("---> Number of holes: " << trackFeatures.nHoles);
+    ACTS_VERBOSE("---> Number of outliers: " << trackFeatures.nOutliers);
+
+    // eta based cuts
+    if (etaBasedCuts(detector, trackFeatures, eta)) {
+      score = 0;
+      ACTS_DEBUG("Track: " << iTrack << " has score = 0, due to detector cuts");
+      break;
     }
+  }
 
-    // All cuts passed, now start scoring the track
+  if (score == 0) {
+    ACTS_DEBUG("Track: " << iTrack << " score : " << score);
+    return score;
+  }
 
-    // start with larger score for tracks with higher pT.
-    score = std::log10(pT / UnitConstants::MeV) - 1.;
-    // pT in GeV, hence 100 MeV is minimum and gets score = 1
-    ACTS_DEBUG("Modifier for pT = " << pT << " GeV is : " << score
-                                    << "  New score now: " << score);
+  // All cuts passed, now start scoring the track
 
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
+  // start with larger score for tracks with higher pT.
+  score = std::log10(pT / UnitConstants::MeV) - 1.;
+  // pT in GeV, hence 100 MeV is minimum and gets score = 1
+  ACTS_DEBUG("Modifier for pT = " << pT << " GeV is : " << score
+                                  << "  New score now: " << score);
 
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
+  for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
+       detectorId++) {
+    const auto& detector = m_cfg.detectorConfigs.at(detectorId);
 
-      // choosing a scaling factor based on the number of hits in a track per
-      // detector.
-      std::size_t nHits = trackFeatures.nHits;
-      if (nHits > detector.maxHits) {
-        score = score * static_cast<double>(nHits - detector.maxHits +
-                                            1);  // hits are good !
-        nHits = detector.maxHits;
-      }
-      score = score * detector.factorHits[nHits];
-      ACTS_DEBUG("Modifier for " << nHits
-                                 << " hits: " << detector.factorHits[nHits]
-                                 << "  New score now: " << score);
-
-      // choosing a scaling factor based on the number of holes in a track per
-      // detector.
-      std::size_t iHoles = trackFeatures.nHoles;
-      if (iHoles > detector.maxHoles) {
-        // holes are bad !
-        score /= static_cast<double>(iHoles - detector.maxHoles + 1);
-        iHoles = detector.maxHoles;
-      }
-      score = score * detector.factorHoles[iHoles];
-      ACTS_DEBUG("Modifier for " << iHoles
-                                 << " holes: " << detector.factorHoles[iHoles]
-                                 << "  New score now: " << score);
-    }
+    const auto& trackFeatures = trackFeaturesVector[detectorId];
 
-    for (const auto& scoreFunction : optionals.scores) {
-      scoreFunction(track, score);
+    // choosing a scaling factor based on the number of hits in a track per
+    // detector.
+    std::size_t nHits = trackFeatures.nHits;
+    if (nHits > detector.maxHits) {
+      score = score * static_cast<double>(nHits - detector.maxHits +
+                                          1);  // hits are good !
+      nHits = detector.maxHits;
     }
-
-    if (track.chi2() > 0 && track.nDoF() > 0) {
-      double chi2 = track.chi2();
-      int indf = track.nDoF();
-      double fac = 1. / std::log10(10. + 10. * chi2 / indf);
-      score = score * fac;
-      ACTS_DEBUG("Modifier for chi2 = " << chi2 << " and NDF = " << indf
-                                        << " is : " << fac
-                                        << "  New score now: " << score);
+    score = score * detector.factorHits[nHits];
+    ACTS_DEBUG("Modifier for " << nHits
+                               << " hits: " << detector.factorHits[nHits]
+                               << "  New score now: " << score);
+
+    // choosing a scaling factor based on the number of holes in a track per
+    // detector.
+    std::size_t iHoles = trackFeatures.nHoles;
+    if (iHoles > detector.maxHoles) {
+      // holes are bad !
+      score /= static_cast<double>(iHoles - detector.maxHoles + 1);
+      iHoles = detector.maxHoles;
     }
+    score = score * detector.factorHoles[iHoles];
+    ACTS_DEBUG("Modifier for " << iHoles
+                               << " holes: " << detector.factorHoles[iHoles]
+                               << "  New score now: " << score);
+  }
 
-    iTrack++;
-
-    // Add the score to the vector
-    trackScore.push_back(score);
-    ACTS_VERBOSE("Track: " << iTrack << " score: " << score);
+  for (const auto& scoreFunction : optionals.scores) {
+    scoreFunction(track, score);
+  }
 
-  }  // end of loop over tracks
+  if (track.chi2() > 0 && track.nDoF() > 0) {
+    double chi2 = track.chi2();
+    int indf = track.nDoF();
+    double fac = 1. / std::log10(10. + 10. * chi2 / indf);
+    score = score * fac;
+    ACTS_DEBUG("Modifier for chi2 = " << chi2 << " and NDF = " << indf
+                                      << " is : " << fac
+                                      << "  New score now: " << score);
+  }
 
-  return trackScore;
+  ACTS_VERBOSE("Track: " << iTrack << " score: " << score);
+  return score;
 }
 
 template <TrackContainerFrontend track_container_t, typename source_link_hash_t,
@@ -332,34 +338,55 @@ std::vector<int> Acts::ScoreBasedAmbiguityResolution::solveAmbiguity(
     const Optionals<typename track_container_t::ConstTrackProxy>& optionals)
     const {
   ACTS_INFO("Number of tracks before Ambiguty Resolution: " << tracks.size());
+
+  using IndexType = typename track_container_t::IndexType;
+  const std::size_t nTracks = tracks.size();
+
+  // Runs fn(begin, end) on contiguous ranges of tracks. Every track only
+  // writes to its own output slot, so the result does not depend on the
+  // number of chunks.
+  auto forEachTrackRange = [&](auto&& fn) {
+    parallelFor(m_cfg.executor.get(), nTracks,
+                [&](std::size_t /*chunk*/, std::size_t begin,
+                    std::size_t end) { fn(begin, end); });
+  };
+
   // vector of trackFeaturesVectors. where each trackFeaturesVector contains the
   // number of hits/hole/outliers for each detector in a track.
+  std::vector<std::vector<TrackFeatures>> trackFeaturesVectors(nTracks);
+  std::vector<double> trackScore(nTracks);
 
-  const std::vector<std::vector<TrackFeatures>> trackFeaturesVectors =
-      computeInitialState<track_container_t>(tracks);
-
-  std::vector<double> trackScore;
-  trackScore.reserve(tracks.size());
-  if (m_cfg.useAmbiguityScoring) {
-    trackScore = ambiguityScore(tracks, trackFeaturesVectors, optionals);
-  } else {
-    trackScore = simpleScore(tracks, trackFeaturesVectors, optionals);
-  }
+  ACTS_VERBOSE("Number of detectors: " << m_cfg.detectorConfigs.size());
+  ACTS_INFO("Starting to score tracks");
+  forEachTrackRange([&](std::size_t begin, std::size_t end) {
+    for (std::size_t iTrack = begin; iTrack < end; ++iTrack) {
+      auto track = tracks.getTrack(static_cast<IndexType>(iTrack));
+      trackFeaturesVectors[iTrack] = computeTrackFeatures(track);
+      trackScore[iTrack] =
+          m_cfg.useAmbiguityScoring
+              ? ambiguityTrackScore(track, trackFeaturesVectors[iTrack],
+                                    optionals, iTrack)
+              : simpleTrackScore(track, trackFeaturesVectors[iTrack],
+                                 optionals, iTrack);
+    }
+  });
 
   auto MeasurementIndexMap =
       std::unordered_map<SourceLink, std::size_t, source_link_hash_t,
                          source_link_equality_t>(0, sourceLinkHash,
                                                  sourceLinkEquality);
 
-  std::vector<std::vector<std::size_t>> measurementsPerTrackVector;
-  std::map<std::size_t, std::size_t> nTracksPerMeasurement;
-
-  // Stores tracks measurement into a vector or vectors
-  // (measurementsPerTrackVector) and counts the number of tracks per
-  // measurement.(nTracksPerMeasurement)
+  // Stores the measurements of all tracks in one flat vector, with the
+  // measurements of track i in [measurementOffsets[i],
+  // measurementOffsets[i + 1]), and counts the number of tracks per
+  // measurement index.
+  std::vector<std::size_t> measurementOffsets;
+  measurementOffsets.reserve(nTracks + 1);
+  measurementOffsets.push_back(0);
+  std::vector<std::size_t> measurementsPerTrack;
+  std::vector<std::size_t> nTracksPerMeasurement;
 
   for (const auto& track : tracks) {
-    std::vector<std::size_t> measurementsPerTrack;
     for (const auto& ts : track.trackStatesReversed()) {
       if (!ts.typeFlags().isOutlier() && !ts.typeFlags().isMeasurement()) {
         continue;
@@ -370,28 +397,43 @@ std::vector<int> Acts::ScoreBasedAmbiguityResolution::solveAmbiguity(
           sourceLink, MeasurementIndexMap.size());
       std::size_t iMeasurement = emplace.first->second;
       measurementsPerTrack.push_back(iMeasurement);
-      if (nTracksPerMeasurement.find(iMeasurement) ==
-          nTracksPerMeasurement.end()) {
-        nTracksPerMeasurement[iMeasurement] = 0;
+      if (emplace.second) {
+        nTracksPerMeasurement.push_back(0);
       }
       nTracksPerMeasurement[iMeasurement]++;
     }
-    measurementsPerTrackVector.push_back(std::move(measurementsPerTrack));
+    measurementOffsets.push_back(measurementsPerTrack.size());
   }
 
-  std::vector<int> goodTracks;
-  int cleanTrackIndex = 0;
-
-  auto optionalHitSelections = optionals.hitSelections;
+  // every known measurement has at least one track, zero marks unknown ones
+  auto nTracksSharing = [&nTracksPerMeasurement](std::size_t iMeasurement) {
+    return iMeasurement < nTracksPerMeasurement.size()
+               ? nTracksPerMeasurement[iMeasurement]
+               : std::size_t{0};
+  };
+
+  // For each track, check if the track has too many shared hits to be
+  // accepted.
+  std::vector<std::uint8_t> cleanTracks(nTracks, 0);
+  forEachTrackRange([&](std::size_t begin, std::size_t end) {
+    for (std::size_t iTrack = begin; iTrack < end; ++iTrack) {
+      auto track = tracks.getTrack(static_cast<IndexType>(iTrack));
+      std::span<const std::size_t> measurements(
+          measurementsPerTrack.data() + measurementOffsets[iTrack],
+          measurementOffsets[iTrack + 1] - measurementOffsets[iTrack]);
+      cleanTracks[iTrack] =
+          isCleanTrack(track, trackScore[iTrack], measurements, nTracksSharing,
+                       optionals.hitSelections)
+              ? 1
+              : 0;
+    }
+  });
 
-  // Loop over all the tracks in the container
-  // For each track, check if the track has too many shared hits to be accepted.
   // If the track is good, add it to the goodTracks
+  std::vector<int> goodTracks;
+  int cleanTrackIndex = 0;
   for (std::size_t iTrack = 0; const auto& track : tracks) {
-    // Check if the track has too many shared hits to be accepted.
-    if (getCleanedOutTracks(track, trackScore[iTrack],
-                            measurementsPerTrackVector[iTrack],
-                            nTracksPerMeasurement, optionalHitSelections)) {
+    if (cleanTracks[iTrack] != 0) {
       cleanTrackIndex++;
       if (trackScore[iTrack] > m_cfg.minScore) {
         goodTracks.push_back(track.index());
@@ -414,6 +456,23 @@ bool Acts::ScoreBasedAmbiguityResolution::getCleanedOutTracks(
         std::function<void(const track_proxy_t&,
                            const typename track_proxy_t::ConstTrackStateProxy&,
                            TrackStateTypes&)>>& optionalHitSelections) const {
+  auto nTracksSharing = [&nTracksPerMeasurement](std::size_t iMeasurement) {
+    auto it = nTracksPerMeasurement.find(iMeasurement);
+    return it == nTracksPerMeasurement.end() ? std::size_t{0} : it->second;
+  };
+  return isCleanTrack(track, trackScore, measurementsPerTrack, nTracksSharing,
+                      optionalHitSelections);
+}
+
+template <TrackProxyConcept track_proxy_t, typename count_lookup_t>
+bool Acts::ScoreBasedAmbiguityResolution::isCleanTrack(
+    const track_proxy_t& track, const double& trackScore,
+    std::span<const std::size_t> measurementsPerTrack,
+    const count_lookup_t& nTracksPerMeasurement,
+    const std::vector<
+        std::function<void(const track_proxy_t&,
+                           const typename track_proxy_t::ConstTrackStateProxy&,
+                           TrackStateTypes&)>>& optionalHitSelections) const {
   // For tracks with shared hits, we need to check and remove bad hits
 
   std::vector<TrackStateTypes> trackStateTypes;
@@ -422,14 +481,12 @@ bool Acts::ScoreBasedAmbiguityResolution::getCleanedOutTracks(
   for (std::size_t index = 0; const auto& ts : track.trackStatesReversed()) {
     if (ts.typeFlags().isOutlier() || ts.typeFlags().isMeasurement()) {
       std::size_t iMeasurement = measurementsPerTrack[index];
-      auto it = nTracksPerMeasurement.find(iMeasurement);
-      if (it == nTracksPerMeasurement.end()) {
+      std::size_t nTracksShared = nTracksPerMeasurement(iMeasurement);
+      if (nTracksShared == 0) {
         trackStateTypes.push_back(TrackStateTypes::OtherTrackStateType);
         index++;
         continue;
       }
-
-      std::size_t nTracksShared = it->second;
       auto isoutliner = ts.typeFlags().isOutlier();
 
       if (isoutliner) {
@@ -476,12 +533,11 @@ bool Acts::ScoreBasedAmbiguityResolution::getCleanedOutTracks(
 
       measurement = measurementsPerTrack[index];
 
-      auto it = nTracksPerMeasurement.find(measurement);
-      if (it == nTracksPerMeasurement.end()) {
+      std::size_t nTracksShared = nTracksPerMeasurement(measurement);
+      if (nTracksShared == 0) {
         index++;
         continue;
       }
-      auto nTracksShared = it->second;
 
       // Loop over all optionalHitSelections and apply them to trackStateType of
       // the TrackState.
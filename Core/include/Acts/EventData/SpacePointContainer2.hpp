@@ -106,6 +106,11 @@ class SpacePointContainer2 {
   /// Clears the container, removing all space points and columns.
   void clear() noexcept;
 
+  /// Releases the memory which is not needed for the current space points.
+  /// Together with `clear` and `reserve` this allows to keep a container
+  /// alive across events and to trim it if it grew too large.
+  void shrinkToFit();
+
   /// Creates a new space point at the end of the container.
   /// @return A mutable proxy to the newly created space point.
   MutableProxy createSpacePoint() noexcept;
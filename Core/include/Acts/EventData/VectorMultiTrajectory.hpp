@@ -26,6 +26,7 @@
 #include <iosfwd>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -183,6 +184,85 @@ class VectorMultiTrajectoryBase {
     return Statistics(std::move(h));
   }
 
+  /// Read-only strided view of a per-state column, for bulk access to all
+  /// track states without going through the track state proxies
+  template <typename T>
+  struct ColumnView {
+    /// Value of the first track state, nullptr if there are no states
+    const T* data = nullptr;
+    /// Number of track states
+    std::size_t size = 0;
+    /// Distance between the values of consecutive track states in bytes
+    std::size_t stride = sizeof(T);
+  };
+
+  /// @return Index of the previous track state of every track state
+  ColumnView<IndexType> previousColumn() const {
+    return {m_previous.data(), m_previous.size(), sizeof(IndexType)};
+  }
+
+  /// @return Chi2 of every track state
+  ColumnView<float> chi2Column() const {
+    return indexDataColumn(&IndexData::chi2);
+  }
+
+  /// @return Path length of every track state
+  ColumnView<double> pathLengthColumn() const {
+    return indexDataColumn(&IndexData::pathLength);
+  }
+
+  /// @return Raw type flags of every track state
+  ColumnView<TrackStateType::raw_type> typeFlagsColumn() const {
+    return indexDataColumn(&IndexData::typeFlags);
+  }
+
+  /// Position of the parameters of every track state in
+  /// @ref parametersPool and @ref covariancePool
+  /// @param component One of the predicted, filtered or smoothed components
+  /// @return Pool indices, @c kInvalid for states without @p component
+  ColumnView<IndexType> parametersIndexColumn(
+      TrackStatePropMask component) const {
+    switch (component) {
+      case TrackStatePropMask::Predicted:
+        return indexDataColumn(&IndexData::ipredicted);
+      case TrackStatePropMask::Filtered:
+        return indexDataColumn(&IndexData::ifiltered);
+      case TrackStatePropMask::Smoothed:
+        return indexDataColumn(&IndexData::ismoothed);
+      default:
+        throw std::invalid_argument(
+            "Parameters index column only exists for the predicted, filtered "
+            "and smoothed components");
+    }
+  }
+
+  /// @return All bound parameter vectors of all track states
+  std::span<
+      const typename detail_tsp::FixedSizeTypes<eBoundSize>::Coefficients>
+  parametersPool() const {
+    return m_params;
+  }
+
+  /// @return All bound covariance matrices of all track states
+  std::span<const typename detail_tsp::FixedSizeTypes<eBoundSize>::Covariance>
+  covariancePool() const {
+    return m_cov;
+  }
+
+  /// Contiguous values of a dynamic column for bulk read access
+  /// @tparam T Value type of the column
+  /// @param key Hashed name of the column
+  /// @return The values of all track states, or an empty optional if the
+  ///         column does not exist or holds values of another type
+  template <typename T>
+  std::optional<std::span<const T>> dynamicColumnData(HashedString key) const {
+    auto it = m_dynamic.find(key);
+    if (it == m_dynamic.end()) {
+      return std::nullopt;
+    }
+    return detail::dynamicColumnData<T>(*it->second);
+  }
+
  protected:
   struct IndexData {
     IndexType ipredicted = kInvalid;
@@ -202,6 +282,14 @@ class VectorMultiTrajectoryBase {
     TrackStatePropMask allocMask = TrackStatePropMask::None;
   };
 
+  template <typename T>
+  ColumnView<T> indexDataColumn(T IndexData::* member) const {
+    if (m_index.empty()) {
+      return {nullptr, 0, sizeof(IndexData)};
+    }
+    return {&(m_index.front().*member), m_index.size(), sizeof(IndexData)};
+  }
+
   VectorMultiTrajectoryBase() noexcept = default;
 
   VectorMultiTrajectoryBase(const VectorMultiTrajectoryBase& other)
@@ -21,6 +21,8 @@
 #include <cassert>
 #include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -179,6 +181,20 @@ class VectorTrackContainerBase {
 
   /// @endcond
 
+  /// Contiguous values of a dynamic column for bulk read access
+  /// @tparam T Value type of the column
+  /// @param key Hashed name of the column
+  /// @return The values of all tracks, or an empty optional if the column
+  ///         does not exist or holds values of another type
+  template <typename T>
+  std::optional<std::span<const T>> dynamicColumnData(HashedString key) const {
+    auto it = m_dynamic.find(key);
+    if (it == m_dynamic.end()) {
+      return std::nullopt;
+    }
+    return detail::dynamicColumnData<T>(*it->second);
+  }
+
   // END INTERFACE HELPER
 
   std::vector<IndexType> m_tipIndex;
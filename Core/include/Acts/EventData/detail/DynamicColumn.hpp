@@ -11,6 +11,9 @@
 #include <any>
 #include <cassert>
 #include <memory>
+#include <optional>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace Acts::detail {
@@ -124,4 +127,20 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
   std::vector<Wrapper> m_vector;
 };
 
+/// Contiguous values of a dynamic column
+/// @tparam T Value type of the column
+/// @param column The column
+/// @return The values, or an empty optional if @p column does not hold
+///         values of type @p T
+template <typename T>
+  requires(!std::is_same_v<T, bool>)
+std::optional<std::span<const T>> dynamicColumnData(
+    const DynamicColumnBase& column) {
+  const auto* typed = dynamic_cast<const DynamicColumn<T>*>(&column);
+  if (typed == nullptr) {
+    return std::nullopt;
+  }
+  return std::span<const T>(typed->m_vector);
+}
+
 }  // namespace Acts::detail
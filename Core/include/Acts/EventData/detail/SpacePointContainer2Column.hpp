@@ -36,6 +36,7 @@ class ColumnHolderBase {
   virtual void reserve(std::size_t size) = 0;
   virtual void resize(std::size_t size) = 0;
   virtual void clear() = 0;
+  virtual void shrinkToFit() = 0;
   virtual void emplace_back() = 0;
   virtual void copyFrom(const ColumnHolderBase &source, std::size_t sourceIndex,
                         std::size_t destinationIndex) = 0;
@@ -67,6 +68,7 @@ class ColumnHolder final : public ColumnHolderBase {
   std::size_t size() const override { return m_data.size(); }
   void reserve(std::size_t size) override { m_data.reserve(size); }
   void clear() override { m_data.clear(); }
+  void shrinkToFit() override { m_data.shrink_to_fit(); }
   void resize(std::size_t size) override { m_data.resize(size, m_default); }
   void emplace_back() override { m_data.emplace_back(m_default); }
   void copyFrom(const ColumnHolderBase &source, std::size_t sourceIndex,
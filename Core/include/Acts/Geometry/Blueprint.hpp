@@ -63,6 +63,11 @@ class Blueprint : public BlueprintNode {
     /// that equivalent bounds are instantiated only once & recycled
     /// across the geometry components
     bool boundDeduplication{true};
+    /// Move the transforms of all surfaces without a placement into one
+    /// contiguous @c SurfaceTransformStore during the geometry closure.
+    /// The surfaces refer to their transform by index afterwards, and the
+    /// store is accessible via @c TrackingGeometry::surfaceTransformStore.
+    bool poolSurfaceTransforms{false};
   };
 
   /// Constructor from a config object
@@ -30,6 +30,11 @@ class IMaterialDecorator;
 class TrackingVolume;
 class TrackingGeometryVisitor;
 class TrackingGeometryMutableVisitor;
+class SurfaceTransformStore;
+
+namespace Experimental {
+class Blueprint;
+}
 
 // Forward declaration only, the implementation is hidden in the .cpp file.
 class Gen1GeometryClosureVisitor;
@@ -45,6 +50,8 @@ class Gen1GeometryClosureVisitor;
 class TrackingGeometry {
   /// Give the GeometryBuilder friend rights
   friend class TrackingGeometryBuilder;
+  /// Give the Blueprint friend rights to attach the surface transform store
+  friend class Experimental::Blueprint;
 
  public:
   /// Constructor
@@ -78,6 +85,12 @@ class TrackingGeometry {
 
   /// return the lowest tracking Volume
   ///
+  /// The search uses a bounding box index of the volume hierarchy that is
+  /// built at construction, so only volumes whose box contains the position
+  /// are tested exactly. The result is identical to
+  /// TrackingVolume::lowestTrackingVolume on the world volume. Geometries
+  /// with alignable volumes fall back to the plain hierarchy walk.
+  ///
   /// @param gctx The current geometry context object, e.g. alignment
   /// @param gp is the global position of the call
   ///
@@ -195,6 +208,18 @@ class TrackingGeometry {
   const std::unordered_map<GeometryIdentifier, const Surface*>&
   geoIdSurfaceMap() const;
 
+  /// Access to the store holding the pooled surface transforms, see
+  /// @c Experimental::Blueprint::Config::poolSurfaceTransforms
+  /// @return pointer to the store, nullptr if the transforms are not pooled
+  const SurfaceTransformStore* surfaceTransformStore() const;
+
+  /// Mutable access to the store holding the pooled surface transforms,
+  /// e.g. to overwrite them in place with an alignment update. The surfaces
+  /// refer to the store entries and pick up the update directly.
+  /// @note Updates must not happen while the geometry is in use
+  /// @return pointer to the store, nullptr if the transforms are not pooled
+  SurfaceTransformStore* surfaceTransformStore();
+
   /// Visualize a tracking geometry including substructure
   /// @param helper The visualization helper that implement the output
   /// @param gctx The geometry context
@@ -214,11 +239,17 @@ class TrackingGeometry {
   GeometryVersion geometryVersion() const;
 
  private:
+  class VolumeLookup;
+
   // the known world
   std::shared_ptr<TrackingVolume> m_world;
+  // accelerated search for the lowest volume, nullptr if not available
+  std::shared_ptr<const VolumeLookup> m_volumeLookup;
   // lookup containers
   std::unordered_map<GeometryIdentifier, const TrackingVolume*> m_volumesById;
   std::unordered_map<GeometryIdentifier, const Surface*> m_surfacesById;
+  // pooled transforms of the surfaces without a placement, can be nullptr
+  std::shared_ptr<SurfaceTransformStore> m_surfaceTransformStore;
 };
 
 }  // namespace Acts
@@ -0,0 +1,46 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometryVisitor.hpp"
+#include "Acts/Surfaces/SurfaceTransformStore.hpp"
+
+#include <memory>
+
+namespace Acts::detail {
+/// @brief Tracking geometry visitor that moves the transforms of all surfaces
+///        without a placement into one contiguous @c SurfaceTransformStore.
+///        Surfaces which are visited more than once, e.g. shared portal
+///        surfaces, are only inserted once. Surfaces with a placement keep
+///        serving their transform through the placement.
+class SurfaceTransformPooler : public TrackingGeometryMutableVisitor {
+ public:
+  /// @brief Constructor
+  /// @param gctx The geometry context used to read out the surface transforms
+  explicit SurfaceTransformPooler(const GeometryContext& gctx)
+      : m_gctx{gctx} {}
+
+  /// @brief Visit and potentially modify a surface
+  /// @param surface The surface being visited
+  /// @note Called for each surface encountered during geometry traversal
+  void visitSurface(Surface& surface) final;
+
+  /// @brief Access the store that is filled by the visitor
+  /// @return Shared pointer to the transform store
+  const std::shared_ptr<SurfaceTransformStore>& store() const {
+    return m_store;
+  }
+
+ private:
+  const GeometryContext m_gctx;
+  std::shared_ptr<SurfaceTransformStore> m_store{
+      std::make_shared<SurfaceTransformStore>()};
+};
+}  // namespace Acts::detail
@@ -0,0 +1,144 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Acts {
+
+class Extent;
+
+/// Magnetic field provider that lazily tabulates another provider.
+///
+/// @ingroup magnetic_field
+///
+/// Analytic field providers such as @ref Acts::SolenoidBField or
+/// @ref Acts::ToroidField are expensive to evaluate. This adapter divides a
+/// cartesian region into a regular grid of bins, which is grouped into cubic
+/// tiles of @c Config::tileSize bins per axis. A tile is filled with the
+/// field values of the wrapped provider at its grid points the first time a
+/// position inside it is requested; later lookups interpolate trilinearly
+/// between the tabulated values, like @ref Acts::InterpolatedBFieldMap.
+///
+/// Filled tiles are published atomically and shared by all threads. If two
+/// threads request the same empty tile concurrently, both fill it and one of
+/// the results is discarded. Tiles can be filled up front with @ref prewarm.
+///
+/// If @c Config::maxError is positive, each tile is checked against the
+/// wrapped provider at the centres of its bins once filled. Tiles in which the
+/// interpolation deviates by more than this bound, or in which the wrapped
+/// provider fails, are not interpolated; lookups inside them are forwarded
+/// to the wrapped provider instead. Positions outside the tabulated region are
+/// forwarded as well.
+class TabulatedBField final : public MagneticFieldProvider {
+ private:
+  struct Tile;
+
+ public:
+  /// Configuration of the tabulation
+  struct Config {
+    /// Lower corner of the tabulated region
+    Vector3 min = Vector3::Zero();
+    /// Upper corner of the tabulated region
+    Vector3 max = Vector3::Zero();
+    /// Distance between the grid points along each axis
+    Vector3 binSize = Vector3::Constant(10 * UnitConstants::mm);
+    /// Number of bins per tile along each axis
+    std::size_t tileSize = 8;
+    /// Maximum allowed deviation of the interpolated from the exact field,
+    /// a non-positive value disables the check
+    double maxError = 0;
+  };
+
+  /// @brief Cache holding the cache of the wrapped provider and the last tile
+  struct Cache {
+    /// @brief Constructor with magnetic field context
+    /// @param mctx Magnetic field context
+    /// @param field Wrapped field provider
+    Cache(const MagneticFieldContext& mctx, const MagneticFieldProvider& field)
+        : fieldCache(std::make_shared<MagneticFieldProvider::Cache>(
+              field.makeCache(mctx))) {}
+
+    /// Cache of the wrapped provider
+    std::shared_ptr<MagneticFieldProvider::Cache> fieldCache;
+    /// Index of the last tile that was accessed
+    std::size_t tileIndex = std::numeric_limits<std::size_t>::max();
+    /// Pointer to the last tile that was accessed
+    const Tile* tile = nullptr;
+  };
+
+  /// Construct the tabulation of a field provider
+  /// @param field The field provider to tabulate
+  /// @param cfg The tabulation configuration
+  TabulatedBField(std::shared_ptr<const MagneticFieldProvider> field,
+                  const Config& cfg);
+
+  TabulatedBField(const TabulatedBField&) = delete;
+  TabulatedBField& operator=(const TabulatedBField&) = delete;
+
+  ~TabulatedBField() override;
+
+  /// @copydoc MagneticFieldProvider::makeCache(const MagneticFieldContext&) const
+  MagneticFieldProvider::Cache makeCache(
+      const MagneticFieldContext& mctx) const override;
+
+  /// @copydoc MagneticFieldProvider::getField(const Vector3&,MagneticFieldProvider::Cache&) const
+  Result<Vector3> getField(const Vector3& position,
+                           MagneticFieldProvider::Cache& cache) const override;
+
+  /// Fill all tiles that overlap with an extent
+  ///
+  /// Directions that are not constrained by @p extent are filled over the
+  /// whole tabulated region.
+  ///
+  /// @param extent The region to fill
+  /// @param mctx The magnetic field context used for the wrapped provider
+  void prewarm(const Extent& extent, const MagneticFieldContext& mctx) const;
+
+  /// Number of tiles that have been filled so far
+  /// @return The number of filled tiles
+  std::size_t numFilledTiles() const;
+
+  /// Number of filled tiles that forward lookups to the wrapped provider
+  /// @return The number of tiles failing the error check
+  std::size_t numExactTiles() const;
+
+  /// Total number of tiles covering the tabulated region
+  /// @return The number of tiles
+  std::size_t numTiles() const;
+
+  /// Access the configuration
+  /// @return The tabulation configuration
+  const Config& config() const { return m_cfg; }
+
+ private:
+  const Tile& tile(std::size_t tileIndex,
+                   MagneticFieldProvider::Cache& fieldCache) const;
+
+  std::unique_ptr<Tile> fillTile(
+      const std::array<std::size_t, 3>& tileCoords,
+      MagneticFieldProvider::Cache& fieldCache) const;
+
+  Config m_cfg;
+  std::shared_ptr<const MagneticFieldProvider> m_field;
+  std::array<std::size_t, 3> m_nTiles{};
+  std::unique_ptr<std::atomic<const Tile*>[]> m_tiles;
+};
+
+}  // namespace Acts
@@ -14,6 +14,7 @@
 #include "Acts/Utilities/BinUtility.hpp"
 
 #include <iosfwd>
+#include <vector>
 
 namespace Acts {
 
@@ -106,6 +107,11 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
 
   using ISurfaceMaterial::materialSlab;
 
+  /// @copydoc ISurfaceMaterial::interactionConstants
+  MaterialInteractionConstants interactionConstants(
+      const Vector3& gp, Direction pDir,
+      MaterialUpdateMode mode) const final;
+
   /// Output Method for std::ostream, to be overloaded by child classes
   /// @param sl The output stream to write to
   /// @return Reference to the output stream after writing
@@ -117,6 +123,12 @@ class BinnedSurfaceMaterial : public ISurfaceMaterial {
 
   /// The five different MaterialSlab
   MaterialSlabMatrix m_fullMaterial;
+
+  /// The precomputed interaction constants, one per material bin
+  std::vector<std::vector<MaterialInteractionConstants>> m_fullConstants;
+
+  /// Recompute the interaction constants from the material bins
+  void updateConstants();
 };
 
 inline const BinUtility& BinnedSurfaceMaterial::binUtility() const {
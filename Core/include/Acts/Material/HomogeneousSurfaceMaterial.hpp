@@ -82,6 +82,13 @@ class HomogeneousSurfaceMaterial : public ISurfaceMaterial {
   // Inherit additional materialSlab overloads from base class
   using ISurfaceMaterial::materialSlab;
 
+  /// @copydoc ISurfaceMaterial::interactionConstants
+  ///
+  /// @note the position is ignored
+  MaterialInteractionConstants interactionConstants(
+      const Vector3& gp, Direction pDir,
+      MaterialUpdateMode mode) const final;
+
   /// The inherited methods - for scale access
   ///
   /// @param pDir Direction through the surface
@@ -99,6 +106,9 @@ class HomogeneousSurfaceMaterial : public ISurfaceMaterial {
   /// The five different MaterialSlab
   MaterialSlab m_fullMaterial = MaterialSlab::Nothing();
 
+  /// The precomputed interaction constants of the full material
+  MaterialInteractionConstants m_fullConstants;
+
   /// @brief Check if two materials are exactly equal.
   ///
   /// This is a strict equality check, i.e. the materials must have identical
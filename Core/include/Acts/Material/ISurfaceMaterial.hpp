@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Common.hpp"
 #include "Acts/Definitions/Direction.hpp"
+#include "Acts/Material/Interactions.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 
 #include <sstream>
@@ -110,6 +111,21 @@ class ISurfaceMaterial {
   virtual MaterialSlab materialSlab(const Vector3& gp, Direction pDir,
                                     MaterialUpdateMode mode) const;
 
+  /// Return method for the fully scaled interaction constants of the Surface
+  /// - from the global coordinates
+  ///
+  /// The default implementation computes the constants from the material
+  /// slab; implementations can override it to return constants that are
+  /// precomputed per material bin.
+  ///
+  /// @param gp is the global position used for the (eventual) lookup
+  /// @param pDir is the positive direction through the surface
+  /// @param mode is the material update directive
+  ///
+  /// @return MaterialInteractionConstants
+  virtual MaterialInteractionConstants interactionConstants(
+      const Vector3& gp, Direction pDir, MaterialUpdateMode mode) const;
+
   /// @brief output stream operator
   ///
   /// Prints information about this object to the output stream using the
@@ -137,6 +153,17 @@ class ISurfaceMaterial {
   }
 
  protected:
+  /// Scale precomputed interaction constants by the update pre factor
+  ///
+  /// @param constants are the unscaled interaction constants
+  /// @param pDir is the positive direction through the surface
+  /// @param mode is the material update directive
+  ///
+  /// @return MaterialInteractionConstants
+  MaterialInteractionConstants scaledConstants(
+      MaterialInteractionConstants constants, Direction pDir,
+      MaterialUpdateMode mode) const;
+
   /// the split factor in favour of oppositePre
   double m_splitFactor{1.};
 
@@ -13,6 +13,60 @@
 
 namespace Acts {
 
+/// Material slab quantities that enter the interaction formulas.
+///
+/// The energy loss and scattering computations below need logarithms of the
+/// mean excitation energy and of the plasma energy of the material, which do
+/// not depend on the particle. This representation holds them precomputed
+/// together with the thickness dependent prefactors, so they can be evaluated
+/// once per material bin instead of at every crossing. Scaling the thickness,
+/// e.g. by the path correction, only rescales the linear prefactors.
+class alignas(32) MaterialInteractionConstants {
+ public:
+  /// Construct constants for vacuum
+  MaterialInteractionConstants() = default;
+
+  /// Precompute the constants of a material slab
+  /// @param slab The material slab
+  explicit MaterialInteractionConstants(const MaterialSlab& slab);
+
+  /// Scale the thickness of the underlying slab
+  /// @param scale Non-negative scale factor
+  void scaleThickness(float scale);
+
+  /// Check if the underlying slab is vacuum or has zero thickness.
+  /// @return True if there are no material interactions
+  bool isVacuum() const { return m_vacuumMaterial || m_thickness <= 0; }
+
+  /// Return the thickness.
+  /// @return Thickness of the slab
+  float thickness() const { return m_thickness; }
+  /// Return the thickness in units of the radiation length.
+  /// @return Thickness in radiation lengths
+  float thicknessInX0() const { return m_thicknessInX0; }
+  /// Return the thickness in units of the nuclear interaction length.
+  /// @return Thickness in nuclear interaction lengths
+  float thicknessInL0() const { return m_thicknessInL0; }
+  /// Return the energy scale of the ionisation loss, i.e. (K/2) * Ne * x.
+  /// @return Energy scale that is multiplied by q²/beta²
+  float epsilonScale() const { return m_epsilonScale; }
+  /// Return the logarithm of the mean excitation energy.
+  /// @return log(I)
+  float logMeanExcitationEnergy() const { return m_logMeanExcitationEnergy; }
+  /// Return the particle independent part of the density correction delta/2.
+  /// @return log(plasmaEnergy / I) - 1/2
+  float deltaHalfOffset() const { return m_deltaHalfOffset; }
+
+ private:
+  float m_thickness = 0.0f;
+  float m_thicknessInX0 = 0.0f;
+  float m_thicknessInL0 = 0.0f;
+  float m_epsilonScale = 0.0f;
+  float m_logMeanExcitationEnergy = 0.0f;
+  float m_deltaHalfOffset = 0.0f;
+  bool m_vacuumMaterial = true;
+};
+
 /// Compute the mean energy loss due to ionisation and excitation.
 ///
 /// @param slab      The traversed material and its properties
@@ -152,6 +206,82 @@ float computeMultipleScatteringTheta0(const MaterialSlab& slab,
                                       PdgParticle absPdg, float m, float qOverP,
                                       float absQ);
 
+/// Compute the mean energy loss due to ionisation and excitation.
+///
+/// @param constants Precomputed constants of the traversed material
+/// @param m         Particle mass
+/// @param qOverP    Particle charge divided by absolute momentum
+/// @param absQ      Absolute particle charge
+/// @return Mean energy loss through the material slab
+float computeEnergyLossBethe(const MaterialInteractionConstants& constants,
+                             float m, float qOverP, float absQ);
+
+/// Compute the most probable energy loss due to ionisation and excitation.
+///
+/// @copydoc computeEnergyLossBethe(const MaterialInteractionConstants&,float,float,float)
+float computeEnergyLossLandau(const MaterialInteractionConstants& constants,
+                              float m, float qOverP, float absQ);
+
+/// Compute the Gaussian-equivalent sigma for the ionisation loss fluctuations.
+///
+/// @param constants Precomputed constants of the traversed material
+/// @param m         Particle mass
+/// @param qOverP    Particle charge divided by absolute momentum
+/// @param absQ      Absolute particle charge
+/// @return Gaussian-equivalent sigma for energy loss fluctuations
+float computeEnergyLossLandauSigma(
+    const MaterialInteractionConstants& constants, float m, float qOverP,
+    float absQ);
+
+/// Compute q/p Gaussian-equivalent sigma due to ionisation loss fluctuations.
+///
+/// @param constants Precomputed constants of the traversed material
+/// @param m         Particle mass
+/// @param qOverP    Particle charge divided by absolute momentum
+/// @param absQ      Absolute particle charge
+/// @return Gaussian-equivalent sigma of q/p
+float computeEnergyLossLandauSigmaQOverP(
+    const MaterialInteractionConstants& constants, float m, float qOverP,
+    float absQ);
+
+/// Compute the mean energy loss due to radiative effects at high energies.
+///
+/// @param constants Precomputed constants of the traversed material
+/// @param absPdg    Absolute particle type PDG identifier
+/// @param m         Particle mass
+/// @param qOverP    Particle charge divided by absolute momentum
+/// @param absQ      Absolute particle charge
+/// @return Mean radiative energy loss through the material slab
+float computeEnergyLossRadiative(const MaterialInteractionConstants& constants,
+                                 PdgParticle absPdg, float m, float qOverP,
+                                 float absQ);
+
+/// Compute the combined mean energy loss.
+///
+/// @copydoc computeEnergyLossRadiative(const MaterialInteractionConstants&,PdgParticle,float,float,float)
+float computeEnergyLossMean(const MaterialInteractionConstants& constants,
+                            PdgParticle absPdg, float m, float qOverP,
+                            float absQ);
+
+/// Compute the combined most probable energy loss.
+///
+/// @copydoc computeEnergyLossRadiative(const MaterialInteractionConstants&,PdgParticle,float,float,float)
+float computeEnergyLossMode(const MaterialInteractionConstants& constants,
+                            PdgParticle absPdg, float m, float qOverP,
+                            float absQ);
+
+/// Compute the core width of the projected planar scattering distribution.
+///
+/// @param constants Precomputed constants of the traversed material
+/// @param absPdg    Absolute particle type PDG identifier
+/// @param m         Particle mass
+/// @param qOverP    Particle charge divided by absolute momentum
+/// @param absQ      Absolute particle charge
+/// @return Core width of the scattering distribution
+float computeMultipleScatteringTheta0(
+    const MaterialInteractionConstants& constants, PdgParticle absPdg, float m,
+    float qOverP, float absQ);
+
 /// Approximate the core width of the projected planar scattering distribution
 /// with highland's formula.
 ///
@@ -18,6 +18,8 @@
 #include "Acts/Propagator/detail/VolumeMaterialInteraction.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 
+#include <optional>
+
 namespace Acts {
 
 /// Material interactor propagator action.
@@ -79,14 +81,26 @@ struct MaterialInteractor {
       ACTS_VERBOSE("MaterialInteractor | " << "Found material on surface "
                                            << surface->geometryId());
 
-      const MaterialSlab slab = detail::evaluateMaterialSlab(
-          state, stepper, *surface,
+      const MaterialUpdateMode updateMode =
           detail::determineMaterialUpdateMode(state, navigator,
-                                              MaterialUpdateMode::FullUpdate));
+                                              MaterialUpdateMode::FullUpdate);
+      // The slab is only needed to record the interaction. Otherwise the
+      // precomputed constants of the surface material are sufficient, so the
+      // material is looked up only once per crossing.
+      std::optional<MaterialSlab> slab;
+      MaterialInteractionConstants constants;
+      if (recordInteractions) {
+        slab =
+            detail::evaluateMaterialSlab(state, stepper, *surface, updateMode);
+        constants = MaterialInteractionConstants(*slab);
+      } else {
+        constants = detail::evaluateMaterialConstants(state, stepper, *surface,
+                                                      updateMode);
+      }
 
       // Determine the effective traversed material and its properties
       // Material exists but it's not real, i.e. vacuum; there is nothing to do
-      if (!slab.isVacuum()) {
+      if (!constants.isVacuum()) {
         // To integrate process noise, we need to transport
         // the covariance to the current position in space
         if (state.stepping.covTransport) {
@@ -97,7 +111,7 @@ struct MaterialInteractor {
 
         // Apply the material interactions
         const detail::PointwiseMaterialEffects effects =
-            detail::performMaterialInteraction(state, stepper, slab,
+            detail::performMaterialInteraction(state, stepper, constants,
                                                noiseUpdateMode,
                                                multipleScattering, energyLoss);
 
@@ -111,15 +125,16 @@ struct MaterialInteractor {
           const double momentum = stepper.absoluteMomentum(state.stepping);
 
           ACTS_VERBOSE("MaterialInteractor | "
-                       << slab << " absPdg=" << absPdg
+                       << "thicknessInX0=" << constants.thicknessInX0()
+                       << " absPdg=" << absPdg
                        << " mass=" << mass / 1_MeV << "MeV"
                        << " momentum=" << momentum / 1_GeV << "GeV"
                        << " energyloss=" << effects.eLoss / 1_MeV << "MeV");
         }
 
         // Record the result
-        recordResult(state, stepper, navigator, slab, initialMomentum, effects,
-                     result);
+        recordResult(state, stepper, navigator, constants, slab,
+                     initialMomentum, effects, result);
       }
     }
 
@@ -162,22 +177,25 @@ struct MaterialInteractor {
   /// @param [in] state The propagator state
   /// @param [in] stepper The stepper instance
   /// @param [in] navigator The navigator instance
-  /// @param [in] slab The material slab
+  /// @param [in] constants The material interaction constants
+  /// @param [in] slab The material slab, only set if interactions are recorded
   /// @param [in] initialMomentum Initial momentum before the interaction
   /// @param [in] effects The material effects
   /// @param [in, out] result Result storage
   template <typename propagator_state_t, typename stepper_t,
             typename navigator_t>
   void recordResult(const propagator_state_t& state, const stepper_t& stepper,
-                    const navigator_t& navigator, const MaterialSlab& slab,
+                    const navigator_t& navigator,
+                    const MaterialInteractionConstants& constants,
+                    const std::optional<MaterialSlab>& slab,
                     double initialMomentum,
                     const detail::PointwiseMaterialEffects& effects,
                     result_type& result) const {
-    result.materialInX0 += slab.thicknessInX0();
-    result.materialInL0 += slab.thicknessInL0();
+    result.materialInX0 += constants.thicknessInX0();
+    result.materialInL0 += constants.thicknessInL0();
 
     // Record the interaction if requested
-    if (!recordInteractions) {
+    if (!recordInteractions || !slab.has_value()) {
       return;
     }
 
@@ -201,7 +219,7 @@ struct MaterialInteractor {
     mi.surface = surface;
     mi.volume = InteractionVolume();
     mi.pathCorrection = pathCorrection;
-    mi.materialSlab = slab;
+    mi.materialSlab = *slab;
     result.materialInteractions.push_back(std::move(mi));
   }
 
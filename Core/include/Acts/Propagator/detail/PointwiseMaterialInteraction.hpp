@@ -15,6 +15,7 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/ParticleHypothesis.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Material/Interactions.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/MathHelpers.hpp"
@@ -101,6 +102,42 @@ MaterialSlab evaluateMaterialSlab(const propagator_state_t& state,
                               position, direction, updateMode);
 }
 
+/// Evaluate the material interaction constants at a given surface, position,
+/// and direction
+/// @param geoContext The geometry context
+/// @param surface The surface at which to evaluate the constants
+/// @param propagationDirection The propagation direction
+/// @param position The position at which to evaluate the constants
+/// @param direction The direction at which to evaluate the constants
+/// @param updateMode The material update mode
+/// @return The evaluated and path corrected interaction constants
+MaterialInteractionConstants evaluateMaterialConstants(
+    const GeometryContext& geoContext, const Surface& surface,
+    Direction propagationDirection, const Vector3& position,
+    const Vector3& direction, MaterialUpdateMode updateMode);
+
+/// Evaluate the material interaction constants at the propagation state and
+/// surface
+/// @tparam propagator_state_t The type of the propagator state
+/// @tparam stepper_t The type of the stepper
+/// @param state The current propagator state
+/// @param stepper The stepper used for the propagation
+/// @param surface The surface at which to evaluate the constants
+/// @param updateMode The material update mode
+/// @return The evaluated and path corrected interaction constants
+template <typename propagator_state_t, typename stepper_t>
+MaterialInteractionConstants evaluateMaterialConstants(
+    const propagator_state_t& state, const stepper_t& stepper,
+    const Surface& surface, MaterialUpdateMode updateMode) {
+  const GeometryContext& geoContext = state.options.geoContext;
+  const Direction propagationDirection = state.options.direction;
+  const Vector3 position = stepper.position(state.stepping);
+  const Vector3 direction = stepper.direction(state.stepping);
+
+  return evaluateMaterialConstants(geoContext, surface, propagationDirection,
+                                   position, direction, updateMode);
+}
+
 /// Struct to hold the material effects computed at a pointwise interaction
 struct PointwiseMaterialEffects {
   double eLoss = 0;
@@ -123,38 +160,54 @@ PointwiseMaterialEffects computeMaterialEffects(
     const Vector3& direction, float qOverP, bool multipleScattering,
     bool energyLoss, bool covTransport);
 
-/// Compute the material effects given the propagation state and material slab
+/// Compute the material effects given precomputed material constants and
+/// particle properties
+/// @param constants The material interaction constants
+/// @param particleHypothesis The particle hypothesis
+/// @param direction The direction of the particle
+/// @param qOverP The charge over momentum of the particle
+/// @param multipleScattering Whether to compute multiple scattering effects
+/// @param energyLoss Whether to compute energy loss effects
+/// @param covTransport Whether to compute covariance transport effects
+/// @return The computed material effects
+PointwiseMaterialEffects computeMaterialEffects(
+    const MaterialInteractionConstants& constants,
+    const ParticleHypothesis& particleHypothesis, const Vector3& direction,
+    float qOverP, bool multipleScattering, bool energyLoss, bool covTransport);
+
+/// Compute the material effects given the propagation state and material
+/// constants
 /// @tparam propagator_state_t The type of the propagator state
 /// @tparam stepper_t The type of the stepper
 /// @param state The current propagator state
 /// @param stepper The stepper used for the propagation
-/// @param slab The material slab
+/// @param constants The material interaction constants
 /// @param multipleScattering Whether to compute multiple scattering effects
 /// @param energyLoss Whether to compute energy loss effects
 /// @return The computed material effects
 template <typename propagator_state_t, typename stepper_t>
-PointwiseMaterialEffects computeMaterialEffects(const propagator_state_t& state,
-                                                const stepper_t& stepper,
-                                                const MaterialSlab& slab,
-                                                bool multipleScattering,
-                                                bool energyLoss) {
+PointwiseMaterialEffects computeMaterialEffects(
+    const propagator_state_t& state, const stepper_t& stepper,
+    const MaterialInteractionConstants& constants, bool multipleScattering,
+    bool energyLoss) {
   const bool covTransport = state.stepping.covTransport;
   const Vector3 direction = stepper.direction(state.stepping);
   const float qOverP = stepper.qOverP(state.stepping);
   const ParticleHypothesis& particleHypothesis =
       stepper.particleHypothesis(state.stepping);
 
-  return computeMaterialEffects(slab, particleHypothesis, direction, qOverP,
-                                multipleScattering, energyLoss, covTransport);
+  return computeMaterialEffects(constants, particleHypothesis, direction,
+                                qOverP, multipleScattering, energyLoss,
+                                covTransport);
 }
 
 /// Perform the material interaction given the propagation state and material
-/// slab
+/// constants
 /// @tparam propagator_state_t The type of the propagator state
 /// @tparam stepper_t The type of the stepper
 /// @param state The current propagator state
 /// @param stepper The stepper used for the propagation
-/// @param slab The material slab
+/// @param constants The material interaction constants
 /// @param noiseUpdateMode The noise update mode
 /// @param multipleScattering Whether to compute multiple scattering effects
 /// @param energyLoss Whether to compute energy loss effects
@@ -162,14 +215,15 @@ PointwiseMaterialEffects computeMaterialEffects(const propagator_state_t& state,
 template <typename propagator_state_t, typename stepper_t>
 PointwiseMaterialEffects performMaterialInteraction(
     propagator_state_t& state, const stepper_t& stepper,
-    const MaterialSlab& slab, NoiseUpdateMode noiseUpdateMode,
-    bool multipleScattering, bool energyLoss) {
-  if (slab.isVacuum()) {
+    const MaterialInteractionConstants& constants,
+    NoiseUpdateMode noiseUpdateMode, bool multipleScattering,
+    bool energyLoss) {
+  if (constants.isVacuum()) {
     return {};
   }
 
   const PointwiseMaterialEffects effects = computeMaterialEffects(
-      state, stepper, slab, multipleScattering, energyLoss);
+      state, stepper, constants, multipleScattering, energyLoss);
 
   const Direction propDir = state.options.direction;
   const ParticleHypothesis& particleHypothesis =
@@ -223,6 +277,28 @@ PointwiseMaterialEffects performMaterialInteraction(
   return effects;
 }
 
+/// Perform the material interaction given the propagation state and material
+/// slab
+/// @tparam propagator_state_t The type of the propagator state
+/// @tparam stepper_t The type of the stepper
+/// @param state The current propagator state
+/// @param stepper The stepper used for the propagation
+/// @param slab The material slab
+/// @param noiseUpdateMode The noise update mode
+/// @param multipleScattering Whether to compute multiple scattering effects
+/// @param energyLoss Whether to compute energy loss effects
+/// @return The computed material effects
+template <typename propagator_state_t, typename stepper_t>
+PointwiseMaterialEffects performMaterialInteraction(
+    propagator_state_t& state, const stepper_t& stepper,
+    const MaterialSlab& slab, NoiseUpdateMode noiseUpdateMode,
+    bool multipleScattering, bool energyLoss) {
+  return performMaterialInteraction(state, stepper,
+                                    MaterialInteractionConstants(slab),
+                                    noiseUpdateMode, multipleScattering,
+                                    energyLoss);
+}
+
 /// Perform the material interaction at the current surface given the
 /// propagation state
 /// @tparam propagator_state_t The type of the propagator state
@@ -241,16 +317,17 @@ PointwiseMaterialEffects performMaterialInteraction(
     propagator_state_t& state, const stepper_t& stepper, const Surface& surface,
     MaterialUpdateMode updateMode, NoiseUpdateMode noiseUpdateMode,
     bool multipleScattering, bool energyLoss, const Logger& logger) {
-  const MaterialSlab slab =
-      evaluateMaterialSlab(state, stepper, surface, updateMode);
-  if (slab.isVacuum()) {
+  const MaterialInteractionConstants constants =
+      evaluateMaterialConstants(state, stepper, surface, updateMode);
+  if (constants.isVacuum()) {
     ACTS_VERBOSE("No material effects on surface: " << surface.geometryId()
                                                     << " with update mode: "
                                                     << updateMode);
   }
 
-  const PointwiseMaterialEffects effects = performMaterialInteraction(
-      state, stepper, slab, noiseUpdateMode, multipleScattering, energyLoss);
+  const PointwiseMaterialEffects effects =
+      performMaterialInteraction(state, stepper, constants, noiseUpdateMode,
+                                 multipleScattering, energyLoss);
 
   const Direction propDir = state.options.direction;
 
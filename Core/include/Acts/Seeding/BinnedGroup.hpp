@@ -92,6 +92,10 @@ class BinnedGroup {
   /// @return The mask
   const std::vector<bool>& mask() const;
 
+  /// @brief Retrieve the local bins visited on each axis, in iteration order
+  /// @return The navigation
+  const std::array<std::vector<std::size_t>, DIM>& navigation() const;
+
   /// @brief Get the begin iterator
   /// @return The iterator
   BinnedGroupIterator<grid_t> begin() const;
@@ -82,6 +82,12 @@ const std::vector<bool>& BinnedGroup<grid_t>::mask() const {
   return m_mask;
 }
 
+template <typename grid_t>
+const std::array<std::vector<std::size_t>, BinnedGroup<grid_t>::DIM>&
+BinnedGroup<grid_t>::navigation() const {
+  return m_bins;
+}
+
 template <typename grid_t>
 BinnedGroupIterator<grid_t> BinnedGroup<grid_t>::begin() const {
   return BinnedGroupIterator<grid_t>(
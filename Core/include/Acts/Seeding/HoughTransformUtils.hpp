@@ -9,11 +9,14 @@
 #pragma once
 
 #include "Acts/Utilities/Grid.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <array>
+#include <cstdint>
 #include <span>
 #include <stdexcept>
 #include <unordered_set>
+#include <vector>
 
 namespace Acts::HoughTransformUtils {
 
@@ -342,6 +345,291 @@ class HoughPlane {
   void checkIndices(std::size_t x, std::size_t y) const;
 };
 
+/// @brief Compact representation of the hough plane.
+/// Instead of one cell object with its own hit and layer vectors per bin,
+/// the plane keeps dense arrays of the (weighted) hit and layer counts and a
+/// bit mask of the layers seen in each cell. The hit identifiers are appended
+/// to a flat arena while filling and arranged into one contiguous list per
+/// cell (CSR layout) by finalize(). Resetting only touches the cells filled
+/// since the last reset.
+/// Provides the same accessors as HoughPlane and can be used with the
+/// LayerGuidedCombinatoric and IslandsAroundMax peak finders. Hits and layers
+/// are counted exactly as in HoughCell::fill, i.e. a hit adds a layer unless
+/// it has the same layer as the previous hit of the cell.
+/// @tparam identifier_t: Type of the identifier to associate to the hits
+template <class identifier_t>
+class CompactHoughPlane {
+ public:
+  /// Type alias for the (x,y) bin index pair
+  using Index = std::array<std::size_t, 2>;
+
+  /// @brief instantiate the (empty) hough plane
+  /// @param cfg: configuration
+  explicit CompactHoughPlane(const HoughPlaneConfig& cfg);
+
+  /// @brief add one measurement to the hough plane
+  /// @tparam PointType: Type of the objects to use when adding measurements (e.g. experiment EDM object)
+  /// @param measurement: The measurement to add
+  /// @param axisRanges: Ranges of the hough axes, used to map the bin numbers to parameter values
+  /// @param linePar: The function y(x) parametrising the hough space line for a given measurement
+  /// @param widthPar: The function dy(x) parametrising the width of the y(x) curve
+  ///                   for a given measurement
+  /// @param identifier: The unique identifier for the given hit
+  /// @param layer: A layer index for this hit
+  /// @param weight: An optional weight to assign to this hit
+  template <class PointType>
+  void fill(const PointType& measurement, const HoughAxisRanges& axisRanges,
+            const LineParametrisation<PointType>& linePar,
+            const LineParametrisation<PointType>& widthPar,
+            const identifier_t& identifier, unsigned layer = 0,
+            YieldType weight = 1.0f);
+
+  /// @brief add a batch of measurements to the hough plane.
+  /// The bins along the first coordinate are split into contiguous ranges
+  /// which are filled with @ref parallelFor. The result does not depend on
+  /// the number of chunks.
+  /// @tparam PointType: Type of the objects to use when adding measurements
+  /// @param measurements: The measurements to add
+  /// @param axisRanges: Ranges of the hough axes
+  /// @param linePar: The function y(x) parametrising the hough space line;
+  ///                 it is called concurrently with an executor
+  /// @param widthPar: The function dy(x) parametrising the width of the line;
+  ///                  it is called concurrently with an executor
+  /// @param identifiers: The unique identifier per measurement
+  /// @param layers: The layer index per measurement; may be empty, in which
+  ///                case all hits are assigned to layer 0
+  /// @param executor: Optional executor running the chunks, without one the
+  ///                  plane is filled on the calling thread
+  /// @param weight: An optional weight to assign to all hits
+  /// @throws std::invalid_argument if the sizes of the inputs do not match
+  /// If a line parametrisation throws, the whole plane is reset before the
+  /// exception is propagated.
+  template <class PointType>
+  void fill(std::span<const PointType> measurements,
+            const HoughAxisRanges& axisRanges,
+            const LineParametrisation<PointType>& linePar,
+            const LineParametrisation<PointType>& widthPar,
+            std::span<const identifier_t> identifiers,
+            std::span<const unsigned> layers,
+            const ParallelExecutor* executor = nullptr,
+            YieldType weight = 1.0f);
+
+  /// @brief Helper method to fill a bin of the hough histogram.
+  /// @param binX: bin number along x
+  /// @param binY: bin number along y
+  /// @param identifier: hit identifier
+  /// @param layer: layer index
+  /// @param w: optional hit weight
+  void fillBin(std::size_t binX, std::size_t binY,
+               const identifier_t& identifier, unsigned layer, double w = 1.0f);
+
+  /// @brief arrange the hit identifiers per cell and determine the maxima.
+  /// Has to be called after filling and before accessing the hit
+  /// identifiers, the non-empty bins or the maxima.
+  void finalize();
+
+  /// @brief resets the contents of the plane, keeping the allocated memory
+  void reset();
+
+  /// @brief check whether finalize() was called after the last fill
+  /// @return True if the hit lists and maxima are up to date
+  bool isFinalized() const { return m_finalized; }
+
+  /// @brief get the (weighted) number of layers  with hits in one cell of the histogram
+  /// @param xBin: bin index in the first coordinate
+  /// @param yBin: bin index in the second coordinate
+  /// @return the (weighed) number of layers that have hits for this cell
+  /// @throws out of range if indices are not within plane limits
+  YieldType nLayers(std::size_t xBin, std::size_t yBin) const {
+    checkIndices(xBin, yBin);
+    return m_nLayers[globalBin({xBin, yBin})];
+  }
+
+  /// @brief get the identifiers of all hits in one cell of the histogram
+  /// @param xBin: bin index in the first coordinate
+  /// @param yBin: bin index in the second coordinate
+  /// @return the list of identifiers of the hits for this cell
+  /// Can include duplicates if a hit was filled more than once
+  /// @throws out of range if indices are not within plane limits
+  /// @throws logic error if the plane is not finalized
+  std::span<const identifier_t, std::dynamic_extent> hitIds(
+      std::size_t xBin, std::size_t yBin) const {
+    checkIndices(xBin, yBin);
+    checkFinalized();
+    const std::size_t bin = globalBin({xBin, yBin});
+    return {m_hits.data() + m_hitOffsets[bin], m_nEntries[bin]};
+  }
+
+  /// @brief get the identifiers of all hits in one cell of the histogram
+  /// @param xBin: bin index in the first coordinate
+  /// @param yBin: bin index in the second coordinate
+  /// @return the list of identifiers of the hits for this cell
+  /// Guaranteed to not duplicate identifiers
+  /// @throws out of range if indices are not within plane limits
+  /// @throws logic error if the plane is not finalized
+  std::unordered_set<identifier_t> uniqueHitIds(std::size_t xBin,
+                                                std::size_t yBin) const {
+    const auto hits = hitIds(xBin, yBin);
+    return std::unordered_set<identifier_t>(hits.begin(), hits.end());
+  }
+
+  /// @brief access the (weighted) number of hits in one cell of the histogram from bin's coordinates
+  /// @param xBin: bin index in the first coordinate
+  /// @param yBin: bin index in the second coordinate
+  /// @return the (weighted) number of hits for this cell
+  /// @throws out of range if indices are not within plane limits
+  YieldType nHits(std::size_t xBin, std::size_t yBin) const {
+    checkIndices(xBin, yBin);
+    return m_nHits[globalBin({xBin, yBin})];
+  }
+
+  /// @brief access the (weighted) number of hits in one cell of the histogram from globalBin index
+  /// @param globalBin: global bin index
+  /// @return the (weighted) number of hits for this cell
+  YieldType nHits(std::size_t globalBin) const { return m_nHits[globalBin]; }
+
+  /// @brief get the number of bins on the first coordinate
+  /// @return Number of bins in the X direction
+  std::size_t nBinsX() const { return m_cfg.nBinsX; }
+  /// @brief get the number of bins on the second coordinate
+  /// @return Number of bins in the Y direction
+  std::size_t nBinsY() const { return m_cfg.nBinsY; }
+
+  /// @brief get the maximum number of (weighted) hits seen in a single
+  /// cell across the entire histrogram.
+  /// @return Maximum number of hits found in any single cell
+  /// @throws logic error if the plane is not finalized
+  YieldType maxHits() const {
+    checkFinalized();
+    return m_maxHits;
+  }
+
+  /// @brief get the bin indices of the cell containing the largest number
+  /// of (weighted) hits across the entire histogram. Ties are resolved
+  /// towards the smallest global bin index.
+  /// @return Pair of (x,y) bin indices where maximum hits are found
+  /// @throws logic error if the plane is not finalized
+  std::pair<std::size_t, std::size_t> locMaxHits() const {
+    checkFinalized();
+    return m_maxLocHits;
+  }
+
+  /// @brief get the maximum number of (weighted) layers with hits  seen
+  /// in a single cell across the entire histrogram.
+  /// @return Maximum number of layers found in any single cell
+  /// @throws logic error if the plane is not finalized
+  YieldType maxLayers() const {
+    checkFinalized();
+    return m_maxLayers;
+  }
+
+  /// @brief get the bin indices of the cell containing the largest number
+  /// of (weighted) layers with hits across the entire histogram. Ties are
+  /// resolved towards the smallest global bin index.
+  /// @return Pair of (x,y) bin indices where maximum layers are found
+  /// @throws logic error if the plane is not finalized
+  std::pair<std::size_t, std::size_t> locMaxLayers() const {
+    checkFinalized();
+    return m_maxLocLayers;
+  }
+
+  /// @brief get the list of cells with non-zero content, sorted by
+  /// global bin index.
+  /// @return Reference to the global bin indices with non-zero content
+  /// @throws logic error if the plane is not finalized
+  const std::vector<std::size_t>& getNonEmptyBins() const {
+    checkFinalized();
+    return m_touchedBins;
+  }
+
+  /// @brief get the coordinates of the bin given the global bin index
+  /// @param globalBin Global bin index to convert to coordinates
+  /// @return Local bin coordinates (x,y) corresponding to global bin index
+  Index axisBins(std::size_t globalBin) const {
+    return {globalBin / m_cfg.nBinsY, globalBin % m_cfg.nBinsY};
+  }
+
+  /// @brief get the globalBin index given the coordinates of the bin
+  /// @param indexBin Bin coordinates to convert to global index
+  /// @return Global bin index corresponding to local bin coordinates
+  std::size_t globalBin(Index indexBin) const {
+    return indexBin[0] * m_cfg.nBinsY + indexBin[1];
+  }
+
+ private:
+  /// @brief hit identifier filled into a cell, before the CSR arrangement
+  struct Entry {
+    std::size_t bin = 0;
+    identifier_t identifier{};
+  };
+
+  /// @brief fill buffer used by one thread. Cells are only ever filled
+  /// through one arena per fill call, so the per-cell order of the hits is
+  /// kept when the arenas are concatenated in order.
+  struct Arena {
+    std::vector<Entry> entries;
+    std::vector<std::size_t> touchedBins;
+  };
+
+  /// @brief fill the line of one measurement into the x bins [xBegin, xEnd)
+  template <class PointType>
+  void fillLine(Arena& arena, const PointType& measurement,
+                const HoughAxisRanges& axisRanges,
+                const LineParametrisation<PointType>& linePar,
+                const LineParametrisation<PointType>& widthPar,
+                const identifier_t& identifier, unsigned layer,
+                YieldType weight, std::size_t xBegin, std::size_t xEnd);
+
+  /// @brief add a hit to one cell
+  void fillCell(Arena& arena, std::size_t bin, const identifier_t& identifier,
+                unsigned layer, YieldType weight);
+
+  /// @brief the arena to be used by serial fills
+  Arena& serialArena();
+
+  /// @brief clear the cells and the fill buffers
+  /// @param allCells: clear every cell instead of the ones recorded in the
+  ///                  arenas in use
+  void clearCells(bool allCells);
+
+  HoughPlaneConfig m_cfg;  // the configuration object
+
+  /// (weighted) number of unique hits per cell
+  std::vector<YieldType> m_nHits;
+  /// (weighted) number of layers with hits per cell
+  std::vector<YieldType> m_nLayers;
+  /// layer of the last hit per cell, used to count the layers
+  std::vector<unsigned> m_lastLayer;
+  /// number of hit identifiers per cell
+  std::vector<std::uint32_t> m_nEntries;
+  /// last hit identifier per cell, used to skip repeated fills of a hit
+  std::vector<identifier_t> m_lastHit;
+  /// offset of the hit identifiers of each cell in m_hits
+  std::vector<std::size_t> m_hitOffsets;
+
+  /// fill buffers, the first m_nArenas are in use
+  std::vector<Arena> m_arenas;
+  std::size_t m_nArenas = 0;
+
+  /// hit identifiers of all cells in CSR layout
+  std::vector<identifier_t> m_hits;
+  /// bins with non-trivial content, sorted
+  std::vector<std::size_t> m_touchedBins;
+  bool m_finalized = true;
+
+  YieldType m_maxHits = 0.0f;    // track the maximum number of hits seen
+  YieldType m_maxLayers = 0.0f;  // track the maximum number of layers seen
+  /// location of the maximum in hits
+  std::pair<std::size_t, std::size_t> m_maxLocHits = {0, 0};
+  /// location of the maximum in layers
+  std::pair<std::size_t, std::size_t> m_maxLocLayers = {0, 0};
+
+  /// @brief check if indices are are valid
+  void checkIndices(std::size_t x, std::size_t y) const;
+  /// @brief check that finalize was called after the last fill
+  void checkFinalized() const;
+};
+
 /// example peak finders.
 namespace PeakFinders {
 /// configuration for the LayerGuidedCombinatoric peak finder
@@ -373,9 +661,11 @@ class LayerGuidedCombinatoric {
   explicit LayerGuidedCombinatoric(const LayerGuidedCombinatoricConfig& cfg);
 
   /// @brief main peak finder method.
+  /// @tparam plane_t: HoughPlane or CompactHoughPlane filled with identifier_t
   /// @param plane: Filled hough plane to search
   /// @return vector of found maxima
-  std::vector<Maximum> findPeaks(const HoughPlane<identifier_t>& plane) const;
+  template <class plane_t>
+  std::vector<Maximum> findPeaks(const plane_t& plane) const;
 
  private:
   /// @brief check if a given bin is a local maximum.
@@ -383,7 +673,8 @@ class LayerGuidedCombinatoric {
   /// @param xBin: x bin index
   /// @param yBin: y bin index
   /// @return true if a maximum, false otherwise
-  bool passThreshold(const HoughPlane<identifier_t>& plane, std::size_t xBin,
+  template <class plane_t>
+  bool passThreshold(const plane_t& plane, std::size_t xBin,
                      std::size_t yBin) const;  // did we pass extensions?
 
   LayerGuidedCombinatoricConfig m_cfg;  // configuration data object
@@ -430,10 +721,12 @@ class IslandsAroundMax {
   explicit IslandsAroundMax(const IslandsAroundMaxConfig& cfg);
 
   /// @brief main peak finder method.
+  /// @tparam plane_t: HoughPlane or CompactHoughPlane filled with identifier_t
   /// @param plane: The filled hough plane to search
   /// @param ranges: The axis ranges used for mapping between parameter space and bins.
   /// @return List of the found maxima
-  std::vector<Maximum> findPeaks(const HoughPlane<identifier_t>& plane,
+  template <class plane_t>
+  std::vector<Maximum> findPeaks(const plane_t& plane,
                                  const HoughAxisRanges& ranges);
 
  private:
@@ -445,7 +738,8 @@ class IslandsAroundMax {
   /// @param toExplore: List of the global Bin indices of neighbour cell candidates left to explore. Method will not do anything once this is empty
   /// @param threshold: the threshold to apply to check if a cell should be added to an island
   /// @param yieldMap: A map of the hit content of above-threshold cells. Used cells will be set to empty content to avoid reuse by subsequent calls
-  void extendMaximum(const HoughPlane<identifier_t>& houghPlane,
+  template <class plane_t>
+  void extendMaximum(const plane_t& houghPlane,
                      std::vector<std::array<std::size_t, 2>>& inMaximum,
                      std::vector<std::size_t>& toExplore, YieldType threshold,
                      std::unordered_map<std::size_t, YieldType>& yieldMap);
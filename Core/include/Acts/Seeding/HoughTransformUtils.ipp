@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Acts/Seeding/HoughTransformUtils.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <algorithm>
 #include <tuple>
@@ -162,16 +163,267 @@ void Acts::HoughTransformUtils::HoughPlane<identifier_t>::checkIndices(
   }
 }
 
+template <class identifier_t>
+Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::
+    CompactHoughPlane(const HoughPlaneConfig& cfg)
+    : m_cfg(cfg) {
+  const std::size_t nCells = m_cfg.nBinsX * m_cfg.nBinsY;
+  m_nHits.resize(nCells, 0.0f);
+  m_nLayers.resize(nCells, 0.0f);
+  m_lastLayer.resize(nCells, 0);
+  m_nEntries.resize(nCells, 0);
+  m_lastHit.resize(nCells);
+  m_hitOffsets.resize(nCells, 0);
+}
+
+template <class identifier_t>
+template <class PointType>
+void Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::
+    fill(const PointType& measurement, const HoughAxisRanges& axisRanges,
+         const LineParametrisation<PointType>& linePar,
+         const LineParametrisation<PointType>& widthPar,
+         const identifier_t& identifier, unsigned layer, YieldType weight) {
+  m_finalized = false;
+  fillLine(serialArena(), measurement, axisRanges, linePar, widthPar,
+           identifier, layer, weight, 0, m_cfg.nBinsX);
+}
+
+template <class identifier_t>
+template <class PointType>
+void Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::
+    fill(std::span<const PointType> measurements,
+         const HoughAxisRanges& axisRanges,
+         const LineParametrisation<PointType>& linePar,
+         const LineParametrisation<PointType>& widthPar,
+         std::span<const identifier_t> identifiers,
+         std::span<const unsigned> layers, const ParallelExecutor* executor,
+         YieldType weight) {
+  if (identifiers.size() != measurements.size() ||
+      (!layers.empty() && layers.size() != measurements.size())) {
+    throw std::invalid_argument(
+        "When filling CompactHoughPlane, got " +
+        std::to_string(measurements.size()) + " measurements but " +
+        std::to_string(identifiers.size()) + " identifiers and " +
+        std::to_string(layers.size()) + " layers");
+  }
+  m_finalized = false;
+
+  // every chunk owns a contiguous range of x bins and fills its own arena
+  const std::size_t maxChunks = std::min(
+      maxParallelChunks(executor), std::max<std::size_t>(1, m_cfg.nBinsX));
+  if (m_arenas.size() < m_nArenas + maxChunks) {
+    m_arenas.resize(m_nArenas + maxChunks);
+  }
+  std::size_t nChunks = 0;
+  try {
+    nChunks = parallelFor(
+        executor, m_cfg.nBinsX,
+        [&](std::size_t chunk, std::size_t xBegin, std::size_t xEnd) {
+          Arena& arena = m_arenas[m_nArenas + chunk];
+          for (std::size_t i = 0; i < measurements.size(); ++i) {
+            fillLine(arena, measurements[i], axisRanges, linePar, widthPar,
+                     identifiers[i], layers.empty() ? 0u : layers[i], weight,
+                     xBegin, xEnd);
+          }
+        });
+  } catch (...) {
+    // the cells filled by the failed call are only recorded in arenas which
+    // are not in use yet, so clear the whole plane
+    clearCells(true);
+    throw;
+  }
+  m_nArenas += nChunks;
+}
+
+template <class identifier_t>
+template <class PointType>
+void Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::
+    fillLine(Arena& arena, const PointType& measurement,
+             const HoughAxisRanges& axisRanges,
+             const LineParametrisation<PointType>& linePar,
+             const LineParametrisation<PointType>& widthPar,
+             const identifier_t& identifier, unsigned layer, YieldType weight,
+             std::size_t xBegin, std::size_t xEnd) {
+  // same binning logic as HoughPlane::fill
+  for (std::size_t xBin = xBegin; xBin < xEnd; xBin++) {
+    auto x = binCenter(axisRanges.xMin, axisRanges.xMax, m_cfg.nBinsX, xBin);
+    CoordType y = linePar(x, measurement);
+    CoordType dy = widthPar(x, measurement);
+    int yBinDown = std::max(
+        binIndex(axisRanges.yMin, axisRanges.yMax, m_cfg.nBinsY, y - dy), 0);
+    int yBinUp = std::min(
+        binIndex(axisRanges.yMin, axisRanges.yMax, m_cfg.nBinsY, y + dy),
+        static_cast<int>(m_cfg.nBinsY) - 1);
+    for (int yBin = yBinDown; yBin <= yBinUp; ++yBin) {
+      fillCell(arena, xBin * m_cfg.nBinsY + yBin, identifier, layer, weight);
+    }
+  }
+}
+
+template <class identifier_t>
+void Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::
+    fillBin(std::size_t binX, std::size_t binY, const identifier_t& identifier,
+            unsigned layer, double w) {
+  checkIndices(binX, binY);
+  m_finalized = false;
+  fillCell(serialArena(), globalBin({binX, binY}), identifier, layer,
+           static_cast<YieldType>(w));
+}
+
+template <class identifier_t>
+void Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::
+    fillCell(Arena& arena, std::size_t bin, const identifier_t& identifier,
+             unsigned layer, YieldType weight) {
+  std::uint32_t& nEntries = m_nEntries[bin];
+  // skip a hit filled repeatedly into the same cell
+  if (nEntries != 0 && m_lastHit[bin] == identifier) {
+    return;
+  }
+  if (nEntries == 0) {
+    arena.touchedBins.push_back(bin);
+  }
+  ++nEntries;
+  m_lastHit[bin] = identifier;
+  arena.entries.push_back({bin, identifier});
+  m_nHits[bin] += weight;
+
+  // same layer counting as HoughCell::fill
+  if (nEntries == 1 || m_lastLayer[bin] != layer) {
+    m_lastLayer[bin] = layer;
+    m_nLayers[bin] += weight;
+  }
+}
+
+template <class identifier_t>
+auto Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::serialArena()
+    -> Arena& {
+  if (m_nArenas == 0) {
+    if (m_arenas.empty()) {
+      m_arenas.emplace_back();
+    }
+    m_nArenas = 1;
+  }
+  // appending to the last arena keeps the fill order of every cell
+  return m_arenas[m_nArenas - 1];
+}
+
+template <class identifier_t>
+void Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::finalize() {
+  m_touchedBins.clear();
+  for (std::size_t a = 0; a < m_nArenas; ++a) {
+    m_touchedBins.insert(m_touchedBins.end(), m_arenas[a].touchedBins.begin(),
+                         m_arenas[a].touchedBins.end());
+  }
+  std::ranges::sort(m_touchedBins);
+
+  std::size_t nHits = 0;
+  for (std::size_t bin : m_touchedBins) {
+    m_hitOffsets[bin] = nHits;
+    nHits += m_nEntries[bin];
+  }
+  // scatter the identifiers using the offsets as cursors
+  m_hits.resize(nHits);
+  for (std::size_t a = 0; a < m_nArenas; ++a) {
+    for (const Entry& entry : m_arenas[a].entries) {
+      m_hits[m_hitOffsets[entry.bin]++] = entry.identifier;
+    }
+  }
+
+  m_maxHits = 0.0f;
+  m_maxLayers = 0.0f;
+  m_maxLocHits = {0, 0};
+  m_maxLocLayers = {0, 0};
+  for (std::size_t bin : m_touchedBins) {
+    m_hitOffsets[bin] -= m_nEntries[bin];
+    if (m_nHits[bin] > m_maxHits) {
+      m_maxHits = m_nHits[bin];
+      m_maxLocHits = {bin / m_cfg.nBinsY, bin % m_cfg.nBinsY};
+    }
+    if (m_nLayers[bin] > m_maxLayers) {
+      m_maxLayers = m_nLayers[bin];
+      m_maxLocLayers = {bin / m_cfg.nBinsY, bin % m_cfg.nBinsY};
+    }
+  }
+  m_finalized = true;
+}
+
+template <class identifier_t>
+void Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::reset() {
+  std::size_t nTouched = 0;
+  for (std::size_t a = 0; a < m_nArenas; ++a) {
+    nTouched += m_arenas[a].touchedBins.size();
+  }
+  // clearing the whole arrays is cheaper once a sizeable part is filled
+  clearCells(4 * nTouched > m_nHits.size());
+}
+
+template <class identifier_t>
+void Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::clearCells(
+    bool allCells) {
+  if (allCells) {
+    std::ranges::fill(m_nHits, 0.0f);
+    std::ranges::fill(m_nLayers, 0.0f);
+    std::ranges::fill(m_nEntries, 0u);
+  } else {
+    for (std::size_t a = 0; a < m_nArenas; ++a) {
+      for (std::size_t bin : m_arenas[a].touchedBins) {
+        m_nHits[bin] = 0.0f;
+        m_nLayers[bin] = 0.0f;
+        m_nEntries[bin] = 0;
+      }
+    }
+  }
+  // keep the capacity of the buffers for the next fill, arenas past the ones
+  // in use may still hold entries of a failed fill
+  for (Arena& arena : m_arenas) {
+    arena.entries.clear();
+    arena.touchedBins.clear();
+  }
+  m_nArenas = 0;
+  m_hits.clear();
+  m_touchedBins.clear();
+  m_maxHits = 0.0f;
+  m_maxLayers = 0.0f;
+  m_maxLocHits = {0, 0};
+  m_maxLocLayers = {0, 0};
+  m_finalized = true;
+}
+
+template <class identifier_t>
+void Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::
+    checkIndices(std::size_t xBin, std::size_t yBin) const {
+  if (xBin >= nBinsX()) {
+    throw std::out_of_range("When accessing CompactHoughPlane, X index " +
+                            std::to_string(xBin) +
+                            " is >= " + std::to_string(nBinsX()));
+  }
+  if (yBin >= nBinsY()) {
+    throw std::out_of_range("When accessing CompactHoughPlane, Y index " +
+                            std::to_string(yBin) +
+                            " is >= " + std::to_string(nBinsY()));
+  }
+}
+
+template <class identifier_t>
+void Acts::HoughTransformUtils::CompactHoughPlane<identifier_t>::
+    checkFinalized() const {
+  if (!m_finalized) {
+    throw std::logic_error(
+        "CompactHoughPlane has been filled since the last call to finalize()");
+  }
+}
+
 template <class identifier_t>
 Acts::HoughTransformUtils::PeakFinders::LayerGuidedCombinatoric<identifier_t>::
     LayerGuidedCombinatoric(const LayerGuidedCombinatoricConfig& cfg)
     : m_cfg(cfg) {}
 
 template <class identifier_t>
+template <class plane_t>
 std::vector<typename Acts::HoughTransformUtils::PeakFinders::
                 LayerGuidedCombinatoric<identifier_t>::Maximum>
 Acts::HoughTransformUtils::PeakFinders::LayerGuidedCombinatoric<
-    identifier_t>::findPeaks(const HoughPlane<identifier_t>& plane) const {
+    identifier_t>::findPeaks(const plane_t& plane) const {
   // book the vector for the maxima
   std::vector<PeakFinders::LayerGuidedCombinatoric<identifier_t>::Maximum>
       maxima;
@@ -194,9 +446,10 @@ Acts::HoughTransformUtils::PeakFinders::LayerGuidedCombinatoric<
 }
 
 template <class identifier_t>
+template <class plane_t>
 bool Acts::HoughTransformUtils::PeakFinders::LayerGuidedCombinatoric<
-    identifier_t>::passThreshold(const HoughPlane<identifier_t>& plane,
-                                 std::size_t xBin, std::size_t yBin) const {
+    identifier_t>::passThreshold(const plane_t& plane, std::size_t xBin,
+                                 std::size_t yBin) const {
   // Check if we have sufficient layers for a maximum
   if (plane.nLayers(xBin, yBin) < m_cfg.threshold) {
     return false;
@@ -258,17 +511,18 @@ Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
     : m_cfg(cfg) {}
 
 template <class identifier_t>
+template <class plane_t>
 std::vector<typename Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
     identifier_t>::Maximum>
 Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
-    identifier_t>::findPeaks(const HoughPlane<identifier_t>& plane,
+    identifier_t>::findPeaks(const plane_t& plane,
                              const HoughAxisRanges& ranges) {
   // check the global maximum hit count in the plane
   YieldType max = plane.maxHits();
   // and obtain the fraction of the max that is our cutoff for island formation
   YieldType min = std::max(m_cfg.threshold, m_cfg.fractionCutoff * max);
   // book a list for the candidates and the maxima
-  const std::unordered_set<std::size_t>& nonEmptyBins{plane.getNonEmptyBins()};
+  const auto& nonEmptyBins = plane.getNonEmptyBins();
   std::vector<std::size_t> candidates;
   candidates.reserve(nonEmptyBins.size());
   std::vector<Maximum> maxima;
@@ -389,9 +643,10 @@ Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
 }
 
 template <class identifier_t>
+template <class plane_t>
 void Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<identifier_t>::
     extendMaximum(
-        const Acts::HoughTransformUtils::HoughPlane<identifier_t>& houghPlane,
+        const plane_t& houghPlane,
         std::vector<std::array<std::size_t, 2>>& inMaximum,
         std::vector<std::size_t>& toExplore, YieldType threshold,
         std::unordered_map<std::size_t, YieldType>& yieldMap) {
@@ -0,0 +1,120 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+class Surface;
+
+/// Grid based estimation of initial track parameters
+///
+/// The table holds one equidistant 2D grid in local coordinates per reference
+/// surface. Each bin stores the mean direction and q/p of the tracks crossing
+/// the surface in this bin, e.g. accumulated from simulation. The track
+/// parameters of a seed are estimated by bilinear interpolation at the local
+/// position of its bottom space point. This is an alternative to the
+/// analytical @ref estimateTrackParamsFromSeed which does not need any
+/// magnetic field information and stays well conditioned in inhomogeneous
+/// field regions.
+///
+/// The table is immutable after construction and can be shared between
+/// threads without synchronisation.
+class TrackParamsLookupTable {
+ public:
+  /// Per bin content: global direction (x, y, z) and q/p in single precision.
+  /// Bins with a zero direction are empty and ignored in the interpolation.
+  using BinContent = Eigen::Array4f;
+
+  /// Lookup grid on a single reference surface
+  struct SurfaceGrid {
+    /// Lower edges of the two local axes
+    std::array<double, 2> min{};
+    /// Upper edges of the two local axes
+    std::array<double, 2> max{};
+    /// Number of bins of the two local axes
+    std::array<std::size_t, 2> nBins{};
+    /// Bin contents, the first local axis runs fastest
+    std::vector<BinContent> bins{};
+
+    /// Access the content of a bin
+    /// @param i0 Bin index along the first local axis
+    /// @param i1 Bin index along the second local axis
+    /// @return Reference to the bin content
+    BinContent& at(std::size_t i0, std::size_t i1) {
+      return bins[i1 * nBins[0] + i0];
+    }
+    /// @copydoc at
+    const BinContent& at(std::size_t i0, std::size_t i1) const {
+      return bins[i1 * nBins[0] + i0];
+    }
+  };
+
+  /// Empty table
+  TrackParamsLookupTable() = default;
+
+  /// Add the grid of a reference surface
+  /// @param geoId The geometry identifier of the reference surface
+  /// @param grid The lookup grid
+  /// @throw std::invalid_argument if the grid is inconsistent
+  void addGrid(GeometryIdentifier geoId, SurfaceGrid grid);
+
+  /// Access the grid of a reference surface
+  /// @param geoId The geometry identifier of the reference surface
+  /// @return Pointer to the grid, nullptr if there is none
+  const SurfaceGrid* grid(GeometryIdentifier geoId) const;
+
+  /// @return The number of reference surfaces in the table
+  std::size_t size() const { return m_grids.size(); }
+
+  /// Interpolate the bin contents at a local position
+  /// @param geoId The geometry identifier of the reference surface
+  /// @param localPosition The local position on the reference surface
+  /// @return The interpolated direction and q/p, or nullopt if the surface
+  ///         is not in the table or all neighbouring bins are empty
+  std::optional<std::pair<Vector3, double>> interpolate(
+      GeometryIdentifier geoId, const Vector2& localPosition) const;
+
+  /// Estimate free track parameters at the bottom space point of a seed
+  /// @param gctx The geometry context
+  /// @param surface The surface of the bottom space point
+  /// @param sp0 The position of the bottom space point
+  /// @param t0 The time of the bottom space point
+  /// @return The free parameters, or nullopt if there is no estimate
+  std::optional<FreeVector> estimate(const GeometryContext& gctx,
+                                     const Surface& surface,
+                                     const Vector3& sp0, double t0) const;
+
+  /// Serialise the table into a compact binary representation
+  /// @param os The output stream, should be opened in binary mode
+  /// @note The format uses the native byte order
+  void toBinaryStream(std::ostream& os) const;
+
+  /// Deserialise a table written with @ref toBinaryStream
+  /// @param is The input stream, should be opened in binary mode
+  /// @return The lookup table
+  /// @throw std::runtime_error if the stream is not a valid table
+  static TrackParamsLookupTable fromBinaryStream(std::istream& is);
+
+ private:
+  std::unordered_map<GeometryIdentifier, SurfaceGrid> m_grids;
+};
+
+}  // namespace Acts
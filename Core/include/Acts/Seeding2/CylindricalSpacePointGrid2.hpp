@@ -10,12 +10,14 @@
 
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/SpacePointContainer2.hpp"
+#include "Acts/EventData/Types.hpp"
 #include "Acts/Seeding/BinnedGroup.hpp"
 #include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/RangeXD.hpp"
 
 #include <numbers>
+#include <span>
 #include <vector>
 
 namespace Acts {
@@ -99,6 +101,49 @@ class CylindricalSpacePointGrid2 {
     std::array<std::vector<std::size_t>, 3ul> navigation;
   };
 
+  /// Contiguous layout of the space points in the grid as an alternative to
+  /// the per bin vectors, filled by `fillContiguous`. Bins are addressed by
+  /// their global bin index in the grid.
+  struct ContiguousBins {
+    /// Indices of the space points inside the grid ordered by global bin and
+    /// within each bin by radius
+    std::vector<SpacePointIndex> spacePoints;
+    /// Range of each global bin in `spacePoints`
+    std::vector<SpacePointIndexRange2> binRanges;
+    /// Non-empty middle bins in the iteration order of the binned group
+    std::vector<std::uint32_t> middleBins;
+    /// Bottom and top neighbour bins of all middle bins
+    std::vector<std::uint32_t> neighbourBins;
+    /// Offsets into `neighbourBins`, two per middle bin plus the end
+    std::vector<std::uint32_t> neighbourOffsets;
+    /// Global bin of each input space point. Only kept to reuse the memory.
+    std::vector<std::uint32_t> spacePointBins;
+
+    /// Number of groups, i.e. non-empty middle bins
+    /// @return The number of groups
+    std::size_t numberOfGroups() const { return middleBins.size(); }
+    /// Bottom neighbour bins of a group
+    /// @param group The group index
+    /// @return The global indices of the bottom bins
+    std::span<const std::uint32_t> bottomBins(std::size_t group) const {
+      return neighbours(neighbourOffsets[2 * group],
+                        neighbourOffsets[2 * group + 1]);
+    }
+    /// Top neighbour bins of a group
+    /// @param group The group index
+    /// @return The global indices of the top bins
+    std::span<const std::uint32_t> topBins(std::size_t group) const {
+      return neighbours(neighbourOffsets[2 * group + 1],
+                        neighbourOffsets[2 * group + 2]);
+    }
+
+   private:
+    std::span<const std::uint32_t> neighbours(std::uint32_t begin,
+                                              std::uint32_t end) const {
+      return std::span(neighbourBins).subspan(begin, end - begin);
+    }
+  };
+
   /// Construct a cylindrical space point grid with the given configuration and
   /// an optional logger.
   /// @param config Configuration for the cylindrical grid
@@ -160,6 +205,22 @@ class CylindricalSpacePointGrid2 {
   /// @param spacePoints The space point container to sort the bins by radius
   void sortBinsByR(const SpacePointContainer2& spacePoints);
 
+  /// Sort space points into the grid bins without filling the per bin vectors.
+  /// A counting sort by global bin places the indices of all space points in
+  /// one contiguous array, so that a consumer can store the space points
+  /// themselves in the same order and stream through a bin linearly. Space
+  /// points outside of the grid are dropped. The groups of non-empty middle
+  /// bins and their neighbours are precomputed in the same order as the
+  /// binned group would visit them.
+  /// @param phi The azimuthal angle of each space point
+  /// @param z The z-coordinate of each space point
+  /// @param r The radial distance of each space point, also used to sort the
+  ///          space points within a bin
+  /// @param bins The output layout, previous content is overwritten
+  /// @throws std::invalid_argument if the coordinate spans differ in size
+  void fillContiguous(std::span<const float> phi, std::span<const float> z,
+                      std::span<const float> r, ContiguousBins& bins) const;
+
   /// Compute the range of radii in the grid. This requires the grid to be
   /// filled with space points and sorted by radius. The sorting can be done
   /// with the `sortBinsByR` method.
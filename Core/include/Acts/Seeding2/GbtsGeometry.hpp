@@ -10,6 +10,7 @@
 
 #include "Acts/Seeding2/GbtsLayerConnection.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <unordered_map>
@@ -137,6 +138,15 @@ class GbtsGeometry final {
     return m_binGroups;
   }
 
+  /// Get the stages of the bin groups. The groups of stage `i` are
+  /// `binGroups()[stages[i], stages[i + 1])`. No bin1 of a stage is used as
+  /// bin2 by another group of the same stage, so the groups of one stage only
+  /// depend on the edges built in previous stages.
+  /// @return Offsets of the stages into the bin groups, plus the end
+  const std::vector<std::size_t>& binGroupStages() const {
+    return m_binGroupStages;
+  }
+
   /// Get layer by ID
   /// @param id Layer ID
   /// @return Pointer to layer or nullptr
@@ -173,6 +183,8 @@ class GbtsGeometry final {
 
   /// Bin groups
   std::vector<std::pair<std::uint32_t, std::vector<std::uint32_t>>> m_binGroups;
+  /// Offsets of the bin group stages
+  std::vector<std::size_t> m_binGroupStages;
 };
 
 }  // namespace Acts::Experimental
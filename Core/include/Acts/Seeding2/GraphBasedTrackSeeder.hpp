@@ -16,6 +16,7 @@
 #include "Acts/Seeding2/GbtsRoiDescriptor.hpp"
 #include "Acts/Seeding2/GbtsTrackingFilter.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <cstdint>
 #include <memory>
@@ -85,6 +86,9 @@ class GraphBasedTrackSeeder {
     bool doubletFilterRZ = true;
     /// Maximum number of Gbts edges/doublets.
     std::uint32_t nMaxEdges = 2000000;
+    /// Optional executor building the graph edges. The bin groups of one
+    /// stage are processed in chunks, the graph does not depend on them.
+    std::shared_ptr<const ParallelExecutor> executor;
     /// Minimum delta radius between layers.
     float minDeltaRadius = 2.0 * Acts::UnitConstants::mm;
     /// Maximum d0 impact parameter when validating edge connection triplet
@@ -12,6 +12,10 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <cstdint>
+#include <span>
+#include <vector>
+
 namespace Acts {
 
 class GeometryContext;
@@ -55,6 +59,58 @@ struct StripEnds final {
   Vector3 bottom = Vector3::Zero();
 };
 
+/// @brief Geometry of a strip module
+///
+/// The strip ends are linear in the local strip coordinate, so they are
+/// stored for a local coordinate of zero together with the global direction
+/// of the local strip coordinate.
+struct StripModuleGeometry final {
+  /// Top end of the strip at local coordinate zero
+  Vector3 top = Vector3::Zero();
+  /// Bottom end of the strip at local coordinate zero
+  Vector3 bottom = Vector3::Zero();
+  /// Global direction of the local strip coordinate
+  Vector3 localAxis = Vector3::UnitX();
+  /// Rotation from the local plane into global coordinates
+  Matrix<3, 2> rotation = Matrix<3, 2>::Identity();
+
+  /// @param loc0 Local strip coordinate of the cluster
+  /// @return The ends of the strip at the given local coordinate
+  StripEnds stripEnds(double loc0) const {
+    return {top + loc0 * localAxis, bottom + loc0 * localAxis};
+  }
+};
+
+/// @brief Cached geometry of a stereo module pair
+struct StripModulePairGeometry final {
+  /// Geometry of the first module
+  StripModuleGeometry first;
+  /// Geometry of the second module
+  StripModuleGeometry second;
+  /// Angle between the strips of both modules
+  double stereoAngle = 0;
+};
+
+/// @brief Strip cluster on a module
+struct StripCluster final {
+  /// Local strip coordinate
+  double loc0 = 0;
+  /// Variance of the local strip coordinate
+  double variance = 0;
+};
+
+/// @brief Space point formed from a cluster pair of a module pair
+struct StripPairSpacePoint final {
+  /// Index of the cluster on the first module
+  std::uint32_t cluster1 = 0;
+  /// Index of the cluster on the second module
+  std::uint32_t cluster2 = 0;
+  /// Global position of the space point
+  Vector3 position = Vector3::Zero();
+  /// (z, r) components of the global covariance
+  Vector2 varianceZR = Vector2::Zero();
+};
+
 /// @brief Calculates (Delta theta)^2 + (Delta phi)^2 between two measurements
 ///
 /// @param globalCluster1 Global position of the measurements on the first strip
@@ -98,6 +154,44 @@ Vector2 computeVarianceZR(const GeometryContext& gctx, const Surface& surface1,
                           const Vector3& spacePoint, double localCov1,
                           double localCov2, double theta);
 
+/// @brief Compute the geometry of a stereo module pair
+///
+/// The strip ends are taken from the bounding box of the planar bounds.
+///
+/// @param gctx The current geometry context object, e.g. alignment
+/// @param surface1 The surface of the first module
+/// @param surface2 The surface of the second module
+///
+/// @throws std::invalid_argument if a surface does not have planar bounds
+///
+/// @return The cached geometry of the module pair
+StripModulePairGeometry computeModulePairGeometry(const GeometryContext& gctx,
+                                                  const Surface& surface1,
+                                                  const Surface& surface2);
+
+/// @brief Form the space points of all clusters of a stereo module pair
+///
+/// Every cluster on the first module is paired with the cluster on the
+/// second module that has the smallest computeClusterPairDistance between
+/// the strip centres. The clusters of the second module are sorted in phi,
+/// so only clusters within `maxAnglePhi` are tested. The constrained
+/// positions of all pairs are then solved in one pass, pairs without a
+/// solution are dropped.
+///
+/// @param geometry The cached geometry of the module pair
+/// @param clusters1 The clusters of the first module
+/// @param clusters2 The clusters of the second module
+/// @param pairingOptions The cluster pairing options
+/// @param options The constrained options
+/// @param spacePoints The container the space points are appended to
+void computeModulePairSpacePoints(
+    const StripModulePairGeometry& geometry,
+    std::span<const StripCluster> clusters1,
+    std::span<const StripCluster> clusters2,
+    const ClusterPairingOptions& pairingOptions,
+    const ConstrainedOptions& options,
+    std::vector<StripPairSpacePoint>& spacePoints);
+
 }  // namespace StripSpacePointBuilder
 
 }  // namespace Acts
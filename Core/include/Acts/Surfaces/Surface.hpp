@@ -18,6 +18,7 @@
 #include "Acts/Surfaces/BoundaryTolerance.hpp"
 #include "Acts/Surfaces/SurfaceBounds.hpp"
 #include "Acts/Surfaces/SurfacePlacementBase.hpp"
+#include "Acts/Surfaces/SurfaceTransformStore.hpp"
 #include "Acts/Utilities/CloneablePtr.hpp"
 #include "Acts/Utilities/Intersection.hpp"
 #include "Acts/Utilities/Result.hpp"
@@ -236,6 +237,26 @@ class Surface : public virtual GeometryObject,
   /// @param placement: Placement object defining the surface's position
   void assignSurfacePlacement(const SurfacePlacementBase& placement);
 
+  /// Move the transform of the surface into a shared transform store
+  ///
+  /// The surface releases its own transform and refers to the entry
+  /// @p index of the @p store afterwards. Alignment updates of the store
+  /// are directly picked up by the surface.
+  ///
+  /// @param store The transform store holding the surface transform
+  /// @param index The index of the surface transform inside the store
+  /// @throw logic_error if the surface is associated to a placement
+  void assignTransformStore(std::shared_ptr<const SurfaceTransformStore> store,
+                            std::size_t index);
+
+  /// Return the transform store the surface refers to, if any
+  /// @return Pointer to the transform store, can be nullptr
+  const SurfaceTransformStore* transformStore() const;
+
+  /// Return the index of the surface transform inside the transform store
+  /// @return The index, only meaningful if @ref transformStore is set
+  std::size_t transformStoreIndex() const;
+
   /// Assign the surface material description
   ///
   /// The material is usually derived in a complicated way and loaded from
@@ -534,6 +555,12 @@ class Surface : public virtual GeometryObject,
   virtual std::ostream& toStreamImpl(const GeometryContext& gctx,
                                      std::ostream& sl) const;
 
+  /// Return the transform which is held by the surface itself, i.e. either
+  /// the owned transform or the entry in the transform store
+  /// @note Must not be called for surfaces associated to a placement
+  /// @return Reference to the transform
+  const Transform3& ownTransform() const;
+
   /// Transform3 definition that positions
   /// (translation, rotation) the surface in global space
   CloneablePtr<const Transform3> m_transform{};
@@ -542,6 +569,12 @@ class Surface : public virtual GeometryObject,
   /// Pointer to the a SurfacePlacement
   const SurfacePlacementBase* m_placement{nullptr};
 
+  /// Optional shared store holding the transform instead of @c m_transform
+  std::shared_ptr<const SurfaceTransformStore> m_transformStore{};
+
+  /// Index of the transform inside @c m_transformStore
+  std::size_t m_transformStoreIndex{0};
+
   /// The associated layer Layer - layer in which the Surface is be embedded,
   /// nullptr if not associated
   const Layer* m_associatedLayer{nullptr};
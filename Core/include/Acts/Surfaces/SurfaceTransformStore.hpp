@@ -0,0 +1,71 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Contiguous storage of surface transforms
+///
+/// Surfaces that are not attached to a @c SurfacePlacementBase own their
+/// transform through an individual heap allocation. For geometries with
+/// O(10^5) surfaces these allocations end up scattered across memory. The
+/// store keeps all transforms in a single aligned array and surfaces refer
+/// to their entry by index, see @c Surface::assignTransformStore.
+///
+/// @note The store is filled during geometry closure. Updating an entry,
+///       e.g. to apply an alignment correction, is not synchronised and must
+///       not happen while the geometry is in use.
+class SurfaceTransformStore {
+ public:
+  /// Reserve space for a number of transforms
+  /// @param size The number of transforms to reserve
+  void reserve(std::size_t size) { m_transforms.reserve(size); }
+
+  /// Append a transform to the store
+  /// @param transform The transform to be stored
+  /// @return The index of the transform inside the store
+  std::size_t insert(const Transform3& transform) {
+    m_transforms.push_back(transform);
+    return m_transforms.size() - 1;
+  }
+
+  /// Access a stored transform
+  /// @param index The index of the transform
+  /// @return Reference to the transform
+  const Transform3& transform(std::size_t index) const {
+    assert(index < m_transforms.size());
+    return m_transforms[index];
+  }
+
+  /// Overwrite a stored transform in place, e.g. for an alignment update
+  /// @param index The index of the transform
+  /// @param transform The new transform
+  void setTransform(std::size_t index, const Transform3& transform) {
+    assert(index < m_transforms.size());
+    m_transforms[index] = transform;
+  }
+
+  /// @return The number of stored transforms
+  std::size_t size() const { return m_transforms.size(); }
+
+  /// @return View on the contiguous transform array
+  std::span<const Transform3> transforms() const { return m_transforms; }
+
+ private:
+  std::vector<Transform3> m_transforms{};
+};
+
+}  // namespace Acts
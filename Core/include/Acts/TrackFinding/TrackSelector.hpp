@@ -12,12 +12,16 @@
 #include "Acts/Geometry/GeometryHierarchyMap.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Utilities/AngleHelpers.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <ostream>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
@@ -46,6 +50,18 @@ class TrackSelector {
     template <TrackProxyConcept track_proxy_t>
     bool isValidTrack(const track_proxy_t& track) const;
 
+    /// Bit mask of the counters matching a geometry identifier, keyed by the
+    /// identifier
+    using LookupCache = std::unordered_map<GeometryIdentifier, std::uint64_t>;
+
+    /// Check if track satisfies all measurement requirements, caching the
+    /// hierarchy map lookups of the measurement surfaces
+    /// @param track The track to check
+    /// @param cache Lookup results of previous calls with the same counters
+    /// @return True if track satisfies all counter thresholds
+    template <TrackProxyConcept track_proxy_t>
+    bool isValidTrack(const track_proxy_t& track, LookupCache& cache) const;
+
     /// Add a new counter with threshold for specified geometry
     /// @param identifiers Geometry identifiers to count measurements in
     /// @param threshold Minimum number of required measurements
@@ -245,6 +261,43 @@ class TrackSelector {
     const Config& getCuts(double eta) const;
   };
 
+  /// Quantities of all tracks in a container that the cuts are applied to,
+  /// stored column-wise and indexed by track
+  struct TrackSummaries {
+    /// Pseudorapidity computed from theta
+    std::vector<double> eta;
+    /// Azimuthal angle
+    std::vector<double> phi;
+    /// Transverse momentum
+    std::vector<double> pt;
+    /// First local coordinate
+    std::vector<double> loc0;
+    /// Second local coordinate
+    std::vector<double> loc1;
+    /// Track time
+    std::vector<double> time;
+    /// Track chi2
+    std::vector<float> chi2;
+    /// Number of measurements
+    std::vector<unsigned int> nMeasurements;
+    /// Number of holes
+    std::vector<unsigned int> nHoles;
+    /// Number of outliers
+    std::vector<unsigned int> nOutliers;
+    /// Number of shared hits
+    std::vector<unsigned int> nSharedHits;
+    /// Whether the track has a reference surface
+    std::vector<std::uint8_t> hasReferenceSurface;
+
+    /// Get the number of tracks
+    /// @return Number of tracks
+    std::size_t size() const { return eta.size(); }
+
+    /// Resize all columns
+    /// @param n Number of tracks
+    void resize(std::size_t n);
+  };
+
   /// Constructor from a single cut config object
   /// @param config is the configuration object
   explicit TrackSelector(const Config& config);
@@ -259,9 +312,38 @@ class TrackSelector {
   /// @tparam output_tracks_t is the type of the output track container
   /// @param inputTracks is the input track container
   /// @param outputTracks is the output track container
+  /// @param executor is the optional executor used to evaluate the
+  ///        selection, see @ref selectionMask
   template <typename input_tracks_t, typename output_tracks_t>
   void selectTracks(const input_tracks_t& inputTracks,
-                    output_tracks_t& outputTracks) const;
+                    output_tracks_t& outputTracks,
+                    const ParallelExecutor* executor = nullptr) const;
+
+  /// Compute the summaries of all tracks in a container in one pass
+  /// @tparam track_container_t is the type of the track container
+  /// @param tracks is the track container
+  /// @return the track summaries
+  template <typename track_container_t>
+  static TrackSummaries makeSummaries(const track_container_t& tracks);
+
+  /// Evaluate the selection for all tracks in a container at once.
+  ///
+  /// The track summaries are computed first, then the eta bin and all cuts
+  /// except the measurement counters are applied column-wise. Only tracks
+  /// passing these are checked against the measurement counters, whose
+  /// geometry lookups are cached. The tracks are split into contiguous chunks
+  /// which are processed with @ref parallelFor. The result is identical to
+  /// calling @ref isValidTrack for every track.
+  ///
+  /// @tparam track_container_t is the type of the track container
+  /// @param tracks is the track container
+  /// @param executor is the optional executor running the chunks, without
+  ///        one all tracks are processed on the calling thread
+  /// @return one entry per track, 1 if the track is selected and 0 otherwise
+  template <typename track_container_t>
+  std::vector<std::uint8_t> selectionMask(
+      const track_container_t& tracks,
+      const ParallelExecutor* executor = nullptr) const;
 
   /// Helper function to check if a track is valid
   /// @tparam track_proxy_t is the type of the track proxy
@@ -275,6 +357,15 @@ class TrackSelector {
   const EtaBinnedConfig& config() const { return m_cfg; }
 
  private:
+  template <typename track_container_t>
+  static void fillSummaries(const track_container_t& tracks,
+                            TrackSummaries& summaries, std::size_t begin,
+                            std::size_t end);
+
+  void applyCuts(const TrackSummaries& summaries, std::size_t begin,
+                 std::size_t end, std::vector<std::size_t>& bins,
+                 std::vector<std::uint8_t>& mask) const;
+
   EtaBinnedConfig m_cfg;
   bool m_isUnbinned = false;
 };
@@ -430,11 +521,28 @@ inline std::ostream& operator<<(std::ostream& os,
   return os;
 }
 
+inline void TrackSelector::TrackSummaries::resize(std::size_t n) {
+  eta.resize(n);
+  phi.resize(n);
+  pt.resize(n);
+  loc0.resize(n);
+  loc1.resize(n);
+  time.resize(n);
+  chi2.resize(n);
+  nMeasurements.resize(n);
+  nHoles.resize(n);
+  nOutliers.resize(n);
+  nSharedHits.resize(n);
+  hasReferenceSurface.resize(n);
+}
+
 template <typename input_tracks_t, typename output_tracks_t>
 void TrackSelector::selectTracks(const input_tracks_t& inputTracks,
-                                 output_tracks_t& outputTracks) const {
+                                 output_tracks_t& outputTracks,
+                                 const ParallelExecutor* executor) const {
+  const std::vector<std::uint8_t> mask = selectionMask(inputTracks, executor);
   for (auto track : inputTracks) {
-    if (!isValidTrack(track)) {
+    if (mask[track.index()] == 0) {
       continue;
     }
     auto destProxy = outputTracks.makeTrack();
@@ -442,6 +550,131 @@ void TrackSelector::selectTracks(const input_tracks_t& inputTracks,
   }
 }
 
+template <typename track_container_t>
+void TrackSelector::fillSummaries(const track_container_t& tracks,
+                                  TrackSummaries& summaries, std::size_t begin,
+                                  std::size_t end) {
+  for (std::size_t i = begin; i < end; ++i) {
+    const auto track = tracks.getTrack(i);
+    summaries.eta[i] = AngleHelpers::etaFromTheta(track.theta());
+    summaries.phi[i] = track.phi();
+    summaries.pt[i] = track.transverseMomentum();
+    summaries.loc0[i] = track.loc0();
+    summaries.loc1[i] = track.loc1();
+    summaries.time[i] = track.time();
+    summaries.chi2[i] = track.chi2();
+    summaries.nMeasurements[i] = track.nMeasurements();
+    summaries.nHoles[i] = track.nHoles();
+    summaries.nOutliers[i] = track.nOutliers();
+    summaries.nSharedHits[i] = track.nSharedHits();
+    summaries.hasReferenceSurface[i] = track.hasReferenceSurface() ? 1 : 0;
+  }
+}
+
+template <typename track_container_t>
+TrackSelector::TrackSummaries TrackSelector::makeSummaries(
+    const track_container_t& tracks) {
+  TrackSummaries summaries;
+  summaries.resize(tracks.size());
+  fillSummaries(tracks, summaries, 0, tracks.size());
+  return summaries;
+}
+
+inline void TrackSelector::applyCuts(const TrackSummaries& summaries,
+                                     std::size_t begin, std::size_t end,
+                                     std::vector<std::size_t>& bins,
+                                     std::vector<std::uint8_t>& mask) const {
+  const std::size_t nBins = m_cfg.nEtaBins();
+
+  // Eta bin of every track, nBins if it is outside the eta range
+  for (std::size_t i = begin; i < end; ++i) {
+    const double absEta = std::abs(summaries.eta[i]);
+    if (m_isUnbinned) {
+      bins[i] = 0;
+    } else if (!(absEta >= m_cfg.absEtaEdges.front() &&
+                 absEta < m_cfg.absEtaEdges.back())) {
+      bins[i] = nBins;
+    } else {
+      bins[i] = nBins == 1 ? 0 : m_cfg.binIndexNoCheck(summaries.eta[i]);
+    }
+  }
+
+  // The cuts are combined without short-circuiting, so that the loop does
+  // not branch on the individual cuts
+  auto within = [](double x, double min, double max) {
+    return (min <= x) & (x < max);
+  };
+  for (std::size_t i = begin; i < end; ++i) {
+    if (bins[i] == nBins) {
+      mask[i] = 0;
+      continue;
+    }
+    const Config& cuts = m_cfg.cutSets[bins[i]];
+
+    const unsigned int nHoles = summaries.nHoles[i];
+    const unsigned int nOutliers = summaries.nOutliers[i];
+    const bool trackCuts =
+        (cuts.minMeasurements <= summaries.nMeasurements[i]) &
+        (nHoles <= cuts.maxHoles) & (nOutliers <= cuts.maxOutliers) &
+        (nHoles + nOutliers <= cuts.maxHolesAndOutliers) &
+        (summaries.nSharedHits[i] <= cuts.maxSharedHits) &
+        (summaries.chi2[i] <= cuts.maxChi2);
+
+    const double eta = summaries.eta[i];
+    const bool etaCuts = !m_isUnbinned ||
+                         (within(std::abs(eta), cuts.absEtaMin,
+                                 cuts.absEtaMax) &
+                          within(eta, cuts.etaMin, cuts.etaMax));
+    const bool parameterCuts =
+        (summaries.hasReferenceSurface[i] != 0) &
+        within(summaries.pt[i], cuts.ptMin, cuts.ptMax) & etaCuts &
+        within(summaries.phi[i], cuts.phiMin, cuts.phiMax) &
+        within(summaries.loc0[i], cuts.loc0Min, cuts.loc0Max) &
+        within(summaries.loc1[i], cuts.loc1Min, cuts.loc1Max) &
+        within(summaries.time[i], cuts.timeMin, cuts.timeMax);
+
+    mask[i] = (trackCuts & (parameterCuts | !cuts.requireReferenceSurface))
+                  ? 1
+                  : 0;
+  }
+}
+
+template <typename track_container_t>
+std::vector<std::uint8_t> TrackSelector::selectionMask(
+    const track_container_t& tracks, const ParallelExecutor* executor) const {
+  const std::size_t n = tracks.size();
+  TrackSummaries summaries;
+  summaries.resize(n);
+  std::vector<std::size_t> bins(n);
+  std::vector<std::uint8_t> mask(n, 0);
+
+  auto run = [&](std::size_t begin, std::size_t end) {
+    fillSummaries(tracks, summaries, begin, end);
+    applyCuts(summaries, begin, end, bins, mask);
+
+    // The measurement counters walk the track states, so they are evaluated
+    // last and only for the remaining tracks
+    std::vector<MeasurementCounter::LookupCache> caches(m_cfg.cutSets.size());
+    for (std::size_t i = begin; i < end; ++i) {
+      if (mask[i] == 0) {
+        continue;
+      }
+      const MeasurementCounter& counter =
+          m_cfg.cutSets[bins[i]].measurementCounter;
+      if (!counter.counters.empty() &&
+          !counter.isValidTrack(tracks.getTrack(i), caches[bins[i]])) {
+        mask[i] = 0;
+      }
+    }
+  };
+
+  parallelFor(executor, n,
+              [&](std::size_t /*chunk*/, std::size_t begin, std::size_t end) {
+                run(begin, end);
+              });
+  return mask;
+}
+
 template <TrackProxyConcept track_proxy_t>
 bool TrackSelector::isValidTrack(const track_proxy_t& track) const {
   auto checkMin = [](auto x, auto min) { return min <= x; };
@@ -572,4 +805,50 @@ bool TrackSelector::MeasurementCounter::isValidTrack(
 
   return true;
 }
+
+template <TrackProxyConcept track_proxy_t>
+bool TrackSelector::MeasurementCounter::isValidTrack(
+    const track_proxy_t& track, LookupCache& cache) const {
+  // No hit cuts, accept everything
+  if (counters.empty()) {
+    return true;
+  }
+  // Matches are cached as a bit mask
+  if (counters.size() > 64) {
+    return isValidTrack(track);
+  }
+
+  boost::container::small_vector<unsigned int, 4> counterValues;
+  counterValues.resize(counters.size(), 0);
+
+  for (const auto& ts : track.trackStatesReversed()) {
+    if (!ts.typeFlags().isMeasurement()) {
+      continue;
+    }
+
+    const auto geoId = ts.referenceSurface().geometryId();
+
+    auto [it, inserted] = cache.try_emplace(geoId, 0);
+    if (inserted) {
+      for (std::size_t i = 0; i < counters.size(); i++) {
+        if (counters[i].first.contains(geoId)) {
+          it->second |= std::uint64_t{1} << i;
+        }
+      }
+    }
+
+    for (std::uint64_t matches = it->second; matches != 0;
+         matches &= matches - 1) {
+      counterValues[std::countr_zero(matches)]++;
+    }
+  }
+
+  for (std::size_t i = 0; i < counters.size(); i++) {
+    if (counterValues[i] < counters[i].second) {
+      return false;
+    }
+  }
+
+  return true;
+}
 }  // namespace Acts
@@ -15,6 +15,7 @@
 #include "Acts/Utilities/detail/periodic.hpp"
 
 #include <iosfwd>
+#include <span>
 #include <stdexcept>
 #include <tuple>
 
@@ -388,4 +389,58 @@ class SymmetricKLDistanceMatrix {
   }
 };
 
+/// @brief Symmetric KL distance cache with incremental minimum search
+///
+/// Same packed lower-triangular layout as @c SymmetricKLDistanceMatrix, but
+/// the q/p means and variances are kept in SoA layout so that the distances
+/// of one component to all others are evaluated in a single vectorised pass.
+/// In addition, the minimum of each row is cached and a tournament tree over
+/// the row minima yields the global minimum in constant time. After a merge
+/// only the rows whose cached minimum was invalidated are rescanned, which
+/// reduces the greedy reduction from cubic to quadratic complexity.
+///
+/// The selected pairs are identical to the ones of
+/// @c SymmetricKLDistanceMatrix, including the tie-breaking.
+class SymmetricKLDistanceQueue {
+  using Array = Eigen::Array<double, Eigen::Dynamic, 1>;
+  using Mask = Eigen::Array<bool, Eigen::Dynamic, 1>;
+
+  Array m_qop;
+  Array m_var;
+  Array m_invVar;
+  Mask m_active;
+
+  Array m_distances;
+  Array m_buffer;
+
+  std::vector<double> m_rowMin;
+  std::vector<std::size_t> m_rowMinIdx;
+  std::vector<std::size_t> m_tree;
+  std::size_t m_numberLeaves{};
+  std::size_t m_numberComponents{};
+
+  void setComponent(std::size_t n, const GsfComponent &cmp);
+  void computeDistancesTo(std::size_t n);
+  void rescanRow(std::size_t i);
+  void updateTree(std::size_t i);
+  bool isBetterRow(std::size_t a, std::size_t b) const;
+
+ public:
+  explicit SymmetricKLDistanceQueue(std::span<const GsfComponent> cmps);
+
+  double at(std::size_t i, std::size_t j) const;
+
+  /// Recompute the distances after component @p n has been replaced
+  /// @param n The index of the component
+  /// @param cmp The new component
+  void updateComponent(std::size_t n, const GsfComponent &cmp);
+
+  /// Exclude component @p n from all further minimum searches
+  /// @param n The index of the component
+  void removeComponent(std::size_t n);
+
+  /// @return The pair (i, j) with i > j of the closest components
+  std::pair<std::size_t, std::size_t> minDistancePair() const;
+};
+
 }  // namespace Acts::detail::Gsf
@@ -0,0 +1,103 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <vector>
+
+namespace Acts {
+
+/// Interface to run independent chunks of work, possibly concurrently.
+///
+/// Core never starts threads itself. Algorithms that can split their work
+/// into independent chunks accept an executor, and the application decides
+/// how the chunks are scheduled, e.g. in the task arena of its event loop.
+class ParallelExecutor {
+ public:
+  virtual ~ParallelExecutor() = default;
+
+  /// Number of chunks the work should be split into
+  /// @return the maximum number of chunks that can run concurrently
+  virtual std::size_t concurrency() const = 0;
+
+  /// Call @p task for every chunk in [0, nChunks) and return once all of
+  /// them have finished
+  /// @param nChunks number of chunks
+  /// @param task callable invoked with the chunk index, it does not throw
+  virtual void run(std::size_t nChunks,
+                   const std::function<void(std::size_t)>& task) const = 0;
+};
+
+/// Upper bound of the number of chunks used by @ref parallelFor
+/// @param executor executor running the chunks, may be nullptr
+/// @return the number of chunks per-chunk buffers have to provide
+inline std::size_t maxParallelChunks(const ParallelExecutor* executor) {
+  return executor != nullptr
+             ? std::max<std::size_t>(1, executor->concurrency())
+             : 1;
+}
+
+/// Split the index range [0, n) into contiguous chunks and call
+/// @p fn(chunk, begin, end) for each of them.
+///
+/// The range is split into at most @p executor->concurrency() chunks which
+/// are handed to the executor. Without an executor, or with a single chunk,
+/// @p fn is called once for the whole range on the calling thread. The chunk
+/// boundaries only depend on @p n, the number of chunks and
+/// @p minChunkSize, so callers can combine per-chunk results
+/// deterministically. Ranges are not split below @p minChunkSize entries
+/// per chunk.
+///
+/// Exceptions thrown by @p fn are rethrown on the calling thread after all
+/// chunks have finished; if several chunks throw, the exception of the
+/// lowest chunk is propagated.
+///
+/// @param executor executor running the chunks, may be nullptr
+/// @param n number of indices to process
+/// @param fn callable invoked as fn(chunk, begin, end)
+/// @param minChunkSize minimum number of indices per chunk
+///
+/// @return the number of chunks
+template <typename fn_t>
+std::size_t parallelFor(const ParallelExecutor* executor, std::size_t n,
+                        fn_t&& fn, std::size_t minChunkSize = 1) {
+  if (n == 0) {
+    return 0;
+  }
+  const std::size_t minChunk = std::max<std::size_t>(1, minChunkSize);
+  const std::size_t maxChunks = (n + minChunk - 1) / minChunk;
+  const std::size_t nChunks =
+      std::min(maxParallelChunks(executor), maxChunks);
+
+  if (nChunks == 1) {
+    fn(std::size_t{0}, std::size_t{0}, n);
+    return 1;
+  }
+
+  std::vector<std::exception_ptr> errors(nChunks);
+  executor->run(nChunks, [&](std::size_t chunk) {
+    try {
+      fn(chunk, n * chunk / nChunks, n * (chunk + 1) / nChunks);
+    } catch (...) {
+      errors[chunk] = std::current_exception();
+    }
+  });
+
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  return nChunks;
+}
+
+}  // namespace Acts
@@ -29,10 +29,16 @@ namespace Acts {
 /// with the highest track density is returned as a vertex candidate.
 /// Unlike the GridDensityVertexFinder, this seeder implements an adaptive
 /// version where the density grid grows bigger with added tracks.
+/// Optionally, the densities are accumulated on a dense grid covering the
+/// whole spatial window instead, which is faster for large numbers of tracks.
 class AdaptiveGridDensityVertexFinder final : public IVertexFinder {
  public:
   /// Type alias for the density map used in adaptive grid vertex finding
   using DensityMap = AdaptiveGridTrackDensity::DensityMap;
+  /// Type alias for the dense density grid
+  using DenseDensityMap = AdaptiveGridTrackDensity::DenseDensityMap;
+  /// Type alias for the density of a single track on the dense grid
+  using DenseTrackDensity = AdaptiveGridTrackDensity::DenseTrackDensity;
 
   /// @brief The Config struct
   struct Config {
@@ -66,6 +72,9 @@ class AdaptiveGridDensityVertexFinder final : public IVertexFinder {
     double z0SignificanceCut = maxZ0TrackSignificance * maxZ0TrackSignificance;
     /// Flag indicating whether to estimate seed width
     bool estimateSeedWidth = false;
+    /// Flag to accumulate the track densities on a dense grid covering the
+    /// spatial window instead of a sparse map
+    bool useDenseDensityMap = false;
 
     // Function to extract parameters from InputTrack
     /// Function to extract track parameters from InputTrack
@@ -84,6 +93,12 @@ class AdaptiveGridDensityVertexFinder final : public IVertexFinder {
     /// Map storing individual track density contributions
     std::unordered_map<InputTrack, DensityMap> trackDensities;
 
+    /// Main density grid, used if useDenseDensityMap == true
+    DenseDensityMap mainDenseDensityMap;
+
+    /// Individual track density contributions to the dense grid
+    std::unordered_map<InputTrack, DenseTrackDensity> denseTrackDensities;
+
     // Store tracks that have been removed from track collection. These
     // tracks will be removed from the main grid
     /// Vector of tracks to be removed from density calculation
@@ -133,6 +148,22 @@ class AdaptiveGridDensityVertexFinder final : public IVertexFinder {
   /// @return Bool track passes selection
   bool doesPassTrackSelection(const BoundTrackParameters& trk) const;
 
+  /// @brief Fills the density map and finds the seed position
+  ///
+  /// @param trackVector Input track collection
+  /// @param vertexingOptions Vertexing options
+  /// @param state The state object
+  /// @param mainDensityMap Map of the overall density
+  /// @param trackDensities Density contributions of the single tracks
+  ///
+  /// @return Vector of vertices, filled with a single vertex
+  template <typename density_map_t, typename track_density_t>
+  Result<std::vector<Vertex>> findSeed(
+      const std::vector<InputTrack>& trackVector,
+      const VertexingOptions& vertexingOptions, State& state,
+      density_map_t& mainDensityMap,
+      std::unordered_map<InputTrack, track_density_t>& trackDensities) const;
+
   // The configuration object
   const Config m_cfg;
 };
@@ -13,6 +13,9 @@
 #include "Acts/EventData/BoundTrackParameters.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <cstdint>
+#include <vector>
+
 #include <boost/container/flat_map.hpp>  // TODO use flat unordered map
 #include <boost/functional/hash.hpp>
 
@@ -29,6 +32,8 @@ namespace Acts {
 /// Single tracks can be cached and removed from the overall density.
 /// Unlike in the GaussianGridTrackDensity, the overall density map
 /// grows adaptively when tracks densities are added to the grid.
+/// Alternatively, the densities can be accumulated on a dense grid covering
+/// the whole spatial window, see @ref DenseDensityMap.
 class AdaptiveGridTrackDensity {
  public:
   /// The first (second) integer indicates the bin's z (t) position
@@ -44,6 +49,98 @@ class AdaptiveGridTrackDensity {
   using GridSizeRange =
       std::pair<std::optional<std::uint32_t>, std::optional<std::uint32_t>>;
 
+  /// Density contribution of a single track to a @ref DenseDensityMap
+  struct DenseTrackDensity {
+    /// First z bin covered by the track
+    std::int32_t firstZBin = 0;
+    /// First t bin covered by the track
+    std::int32_t firstTBin = 0;
+    /// Number of z bins covered by the track
+    std::uint32_t nZBins = 0;
+    /// Densities of the covered bins, the z bin runs fastest
+    std::vector<float> values;
+
+    /// @return Whether the track does not contribute to the density
+    bool empty() const { return values.empty(); }
+  };
+
+  /// Dense alternative to @ref DensityMap
+  ///
+  /// The grid covers the spatial and temporal windows, but only the filled
+  /// part is stored: each t bin is a contiguous slice over the z range its
+  /// tracks touched so far, and the range of filled t bins is tracked as
+  /// well. Slices grow when a track extends them. Adding a track density is
+  /// a sum of contiguous rows and the maximum is found with a linear scan
+  /// of the filled bins instead of sorted map insertions.
+  class DenseDensityMap {
+   public:
+    DenseDensityMap() = default;
+
+    /// Constructor
+    /// @param firstZBin First z bin of the grid
+    /// @param nZBins Number of z bins
+    /// @param firstTBin First t bin of the grid
+    /// @param nTBins Number of t bins
+    DenseDensityMap(std::int32_t firstZBin, std::uint32_t nZBins,
+                    std::int32_t firstTBin, std::uint32_t nTBins);
+
+    /// @return Whether no track density has been added yet
+    bool empty() const { return m_empty; }
+
+    /// Whether a bin has a positive density
+    /// @param bin The bin
+    /// @return True if the bin lies inside the grid and is filled
+    bool contains(const Bin& bin) const;
+
+    /// Density of a bin, zero for bins that were never filled
+    /// @param bin The bin
+    /// @return The density
+    float at(const Bin& bin) const;
+
+    /// Mutable access to the density of a bin inside the grid
+    /// @param bin The bin
+    /// @return Reference to the density
+    float& operator[](const Bin& bin);
+
+    /// Reset all densities, the memory of the slices is kept for reuse
+    void clear();
+
+    /// @return First z bin of the grid
+    std::int32_t firstZBin() const { return m_firstZBin; }
+    /// @return Number of z bins of the grid
+    std::uint32_t nZBins() const { return m_nZBins; }
+    /// @return First t bin of the grid
+    std::int32_t firstTBin() const { return m_firstTBin; }
+    /// @return Number of t bins of the grid
+    std::uint32_t nTBins() const { return m_nTBins; }
+
+   private:
+    friend class AdaptiveGridTrackDensity;
+
+    /// Filled z range of a single t bin
+    struct Slice {
+      /// Offset of the first stored z bin w.r.t. the first grid z bin
+      std::uint32_t zOffset = 0;
+      /// Densities of the stored z bins
+      std::vector<float> values;
+    };
+
+    /// Densities of the z bins [firstZBin, firstZBin + nZBins) of a t bin,
+    /// the slice is extended to cover them if necessary
+    float* row(std::int32_t tBin, std::int32_t firstZBin,
+               std::uint32_t nZBins);
+
+    std::int32_t m_firstZBin = 0;
+    std::uint32_t m_nZBins = 0;
+    std::int32_t m_firstTBin = 0;
+    std::uint32_t m_nTBins = 0;
+    std::vector<Slice> m_slices;
+    /// Range of t bin indices with a non-empty slice
+    std::uint32_t m_firstFilledT = 0;
+    std::uint32_t m_endFilledT = 0;
+    bool m_empty = true;
+  };
+
   /// The configuration struct
   struct Config {
     /// Spatial extent of a bin in d0 and z0 direction, should always be set to
@@ -105,6 +202,9 @@ class AdaptiveGridTrackDensity {
   /// @return The z and t coordinates of maximum track density
   Result<ZTPosition> getMaxZTPosition(DensityMap& densityMap) const;
 
+  /// @copydoc getMaxZTPosition(DensityMap&) const
+  Result<ZTPosition> getMaxZTPosition(DenseDensityMap& densityMap) const;
+
   /// @brief Returns the z-t position of maximum track density
   /// and the estimated z-width of the maximum
   ///
@@ -116,6 +216,16 @@ class AdaptiveGridTrackDensity {
   Result<ZTPositionAndWidth> getMaxZTPositionAndWidth(
       DensityMap& densityMap) const;
 
+  /// @copydoc getMaxZTPositionAndWidth(DensityMap&) const
+  Result<ZTPositionAndWidth> getMaxZTPositionAndWidth(
+      DenseDensityMap& densityMap) const;
+
+  /// @brief Creates an empty dense density map covering the spatial and
+  /// temporal windows
+  ///
+  /// @return The dense density map
+  DenseDensityMap makeDenseDensityMap() const;
+
   /// @brief Adds a single track to the overall grid density
   ///
   /// @param trk The track to be added
@@ -125,6 +235,15 @@ class AdaptiveGridTrackDensity {
   DensityMap addTrack(const BoundTrackParameters& trk,
                       DensityMap& mainDensityMap) const;
 
+  /// @brief Adds a single track to a dense grid density
+  ///
+  /// @param trk The track to be added
+  /// @param mainDensityMap Dense grid of the overall density
+  ///
+  /// @return The density of the track that was added
+  DenseTrackDensity addTrack(const BoundTrackParameters& trk,
+                             DenseDensityMap& mainDensityMap) const;
+
   /// @brief Removes a track from the overall grid density.
   ///
   /// @param trackDensityMap Map between bins and corresponding density
@@ -134,6 +253,13 @@ class AdaptiveGridTrackDensity {
   void subtractTrack(const DensityMap& trackDensityMap,
                      DensityMap& mainDensityMap) const;
 
+  /// @brief Removes a track from a dense grid density.
+  ///
+  /// @param trackDensity Density of a single track
+  /// @param mainDensityMap Dense grid of the overall density
+  void subtractTrack(const DenseTrackDensity& trackDensity,
+                     DenseDensityMap& mainDensityMap) const;
+
   // TODO this should not be public
   /// @brief Calculates the bin center from the bin number
   /// @param bin Bin number
@@ -189,12 +315,37 @@ class AdaptiveGridTrackDensity {
   /// @return Grid size
   std::uint32_t getTemporalTrkGridSize(double sigma) const;
 
+  /// @brief Calculates the range of bins whose centers lie in a window
+  /// @param window Lower and upper edge of the window
+  /// @param binExtent Bin extent
+  /// @return First bin and number of bins
+  static std::pair<std::int32_t, std::uint32_t> getWindowBins(
+      const std::pair<double, double>& window, double binExtent);
+
   /// @brief Finds the maximum density of a DensityMap
   /// @param densityMap Map between bins and corresponding density
   /// values
-  /// @return Iterator of the map entry with the highest density
-  DensityMap::const_iterator highestDensityEntry(
-      const DensityMap& densityMap) const;
+  /// @return Bin and value of the map entry with the highest density
+  std::pair<Bin, float> highestDensityEntry(const DensityMap& densityMap) const;
+
+  /// @brief Finds the maximum density of a DenseDensityMap
+  /// @param densityMap Dense grid of densities
+  /// @return Bin and value of the highest density
+  std::pair<Bin, float> highestDensityEntry(
+      const DenseDensityMap& densityMap) const;
+
+  /// @brief Implementation of getMaxZTPosition for both map types
+  /// @param densityMap Map between bins and corresponding density
+  /// @return The z and t coordinates of maximum track density
+  template <typename density_map_t>
+  Result<ZTPosition> getMaxZTPositionImpl(density_map_t& densityMap) const;
+
+  /// @brief Implementation of getMaxZTPositionAndWidth for both map types
+  /// @param densityMap Map between bins and corresponding density
+  /// @return The z-t position of the maximum track density and its width
+  template <typename density_map_t>
+  Result<ZTPositionAndWidth> getMaxZTPositionAndWidthImpl(
+      density_map_t& densityMap) const;
 
   /// @brief Function that creates a track density map, i.e., a map from bins
   /// to the corresponding density values for a single track.
@@ -213,6 +364,26 @@ class AdaptiveGridTrackDensity {
                              std::uint32_t spatialTrkGridSize,
                              std::uint32_t temporalTrkGridSize) const;
 
+  /// @brief Function that creates the dense density of a single track,
+  /// restricted to the bins of @p mainDensityMap
+  ///
+  /// The Gaussian is evaluated for a whole z row of bins at once from a
+  /// quadratic form whose coefficients are computed once per row.
+  ///
+  /// @param impactParams vector containing d0, z0, and t0 of the track
+  /// @param centralBin Central z and t bin of the track
+  /// @param cov 3x3 impact parameter covariance matrix
+  /// @param spatialTrkGridSize Number of bins in z direction
+  /// @param temporalTrkGridSize Number of bins in time direction
+  /// @param mainDensityMap Dense grid the track will be added to
+  ///
+  /// @return The track density
+  DenseTrackDensity createDenseTrackGrid(
+      const Acts::Vector3& impactParams, const Bin& centralBin,
+      const Acts::SquareMatrix3& cov, std::uint32_t spatialTrkGridSize,
+      std::uint32_t temporalTrkGridSize,
+      const DenseDensityMap& mainDensityMap) const;
+
   /// @brief Function that estimates the seed width in z direction based
   /// on the full width at half maximum (FWHM) of the maximum density peak
   /// @note This only works if the maximum is sufficiently isolated since
@@ -223,7 +394,8 @@ class AdaptiveGridTrackDensity {
   /// @param maxZT z-t position of the maximum density value
   ///
   /// @return The width
-  Result<double> estimateSeedWidth(const DensityMap& densityMap,
+  template <typename density_map_t>
+  Result<double> estimateSeedWidth(const density_map_t& densityMap,
                                    const ZTPosition& maxZT) const;
 
   /// @brief Checks (up to) first three density maxima that have a
@@ -234,7 +406,8 @@ class AdaptiveGridTrackDensity {
   /// @param densityMap Map between bins and corresponding density values
   ///
   /// @return The bin corresponding to the highest surrounding density
-  Bin highestDensitySumBin(DensityMap& densityMap) const;
+  template <typename density_map_t>
+  Bin highestDensitySumBin(density_map_t& densityMap) const;
 
   /// @brief Calculates the density sum of a bin and its two neighboring bins
   /// in z direction
@@ -244,6 +417,10 @@ class AdaptiveGridTrackDensity {
   ///
   /// @return The density sum
   double getDensitySum(const DensityMap& densityMap, const Bin& bin) const;
+
+  /// @copydoc getDensitySum(const DensityMap&, const Bin&) const
+  double getDensitySum(const DenseDensityMap& densityMap,
+                       const Bin& bin) const;
 };
 
 }  // namespace Acts
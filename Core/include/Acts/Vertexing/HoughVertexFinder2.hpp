@@ -12,8 +12,10 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/SpacePointContainer2.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -90,6 +92,10 @@ class HoughVertexFinder2 {
     /// Default position of the vertex in X, Y, and Z coordinates
     Vector3 defVtxPosition{0. * UnitConstants::mm, 0. * UnitConstants::mm,
                            0. * UnitConstants::mm};
+
+    /// Optional executor used to fill the Hough plane; each chunk fills its
+    /// own range of z bins, so the result does not depend on it.
+    std::shared_ptr<const ParallelExecutor> executor;
   };
 
   /// @brief Constructor
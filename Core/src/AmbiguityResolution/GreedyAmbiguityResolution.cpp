@@ -8,7 +8,14 @@
 
 #include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
 
+#include "Acts/Utilities/ParallelFor.hpp"
+
 #include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <queue>
+#include <span>
+#include <vector>
 
 namespace Acts {
 
@@ -30,6 +37,110 @@ static void removeTrack(GreedyAmbiguityResolution::State& state,
   state.selectedTracks.erase(iTrack);
 }
 
+/// Flat measurement and track relations of the selected tracks, grouped into
+/// sets of tracks that are connected by shared measurements.
+struct ComponentGraph {
+  // distinct measurements per track
+  std::vector<std::uint32_t> trackOffsets;
+  std::vector<std::uint32_t> trackMeasurements;
+  // tracks per measurement in increasing order
+  std::vector<std::uint32_t> measurementOffsets;
+  std::vector<std::uint32_t> measurementTracks;
+  // tracks per component in increasing order
+  std::vector<std::uint32_t> componentOffsets;
+  std::vector<std::uint32_t> componentTracks;
+
+  explicit ComponentGraph(const GreedyAmbiguityResolution::State& state);
+};
+
+ComponentGraph::ComponentGraph(const GreedyAmbiguityResolution::State& state) {
+  const std::size_t nTracks = state.numberOfTracks;
+
+  std::vector<bool> selected(nTracks, false);
+  for (std::size_t iTrack : state.selectedTracks) {
+    selected[iTrack] = true;
+  }
+
+  trackOffsets.reserve(nTracks + 1);
+  trackOffsets.push_back(0);
+  std::size_t nMeasurements = 0;
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    if (selected[iTrack]) {
+      auto begin = trackMeasurements.end() - trackMeasurements.begin();
+      for (std::size_t iMeasurement : state.measurementsPerTrack[iTrack]) {
+        trackMeasurements.push_back(static_cast<std::uint32_t>(iMeasurement));
+        nMeasurements = std::max(nMeasurements, iMeasurement + 1);
+      }
+      // a measurement used twice by one track is only counted once
+      std::sort(trackMeasurements.begin() + begin, trackMeasurements.end());
+      trackMeasurements.erase(
+          std::unique(trackMeasurements.begin() + begin,
+                      trackMeasurements.end()),
+          trackMeasurements.end());
+    }
+    trackOffsets.push_back(
+        static_cast<std::uint32_t>(trackMeasurements.size()));
+  }
+
+  measurementOffsets.assign(nMeasurements + 1, 0);
+  for (std::uint32_t iMeasurement : trackMeasurements) {
+    ++measurementOffsets[iMeasurement + 1];
+  }
+  std::partial_sum(measurementOffsets.begin(), measurementOffsets.end(),
+                   measurementOffsets.begin());
+
+  // tracks are visited in increasing order, which keeps the lists sorted
+  measurementTracks.resize(measurementOffsets.back());
+  std::vector<std::uint32_t> fill(measurementOffsets.begin(),
+                                  measurementOffsets.end() - 1);
+  std::vector<std::uint32_t> parent(nTracks);
+  std::iota(parent.begin(), parent.end(), 0u);
+  auto findRoot = [&parent](std::uint32_t i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+  for (std::size_t iTrack : state.selectedTracks) {
+    for (std::uint32_t k = trackOffsets[iTrack]; k < trackOffsets[iTrack + 1];
+         ++k) {
+      std::uint32_t iMeasurement = trackMeasurements[k];
+      std::uint32_t first = measurementOffsets[iMeasurement];
+      measurementTracks[fill[iMeasurement]++] =
+          static_cast<std::uint32_t>(iTrack);
+      // join the track with the first user of the measurement
+      std::uint32_t a = findRoot(measurementTracks[first]);
+      std::uint32_t b = findRoot(static_cast<std::uint32_t>(iTrack));
+      if (a != b) {
+        parent[std::max(a, b)] = std::min(a, b);
+      }
+    }
+  }
+
+  // the smallest track of every component is its root
+  std::vector<std::uint32_t> componentIndex(nTracks, 0);
+  componentOffsets.push_back(0);
+  for (std::size_t iTrack : state.selectedTracks) {
+    std::uint32_t root = findRoot(static_cast<std::uint32_t>(iTrack));
+    if (root == iTrack) {
+      componentIndex[iTrack] =
+          static_cast<std::uint32_t>(componentOffsets.size() - 1);
+      componentOffsets.push_back(0);
+    }
+    ++componentOffsets[componentIndex[root] + 1];
+  }
+  std::partial_sum(componentOffsets.begin(), componentOffsets.end(),
+                   componentOffsets.begin());
+  componentTracks.resize(componentOffsets.back());
+  fill.assign(componentOffsets.begin(), componentOffsets.end() - 1);
+  for (std::size_t iTrack : state.selectedTracks) {
+    std::uint32_t component =
+        componentIndex[findRoot(static_cast<std::uint32_t>(iTrack))];
+    componentTracks[fill[component]++] = static_cast<std::uint32_t>(iTrack);
+  }
+}
+
 }  // namespace
 
 void GreedyAmbiguityResolution::resolve(State& state) const {
@@ -99,4 +210,135 @@ void GreedyAmbiguityResolution::resolve(State& state) const {
   }
 }
 
+void GreedyAmbiguityResolution::resolveComponents(State& state) const {
+  const ComponentGraph graph(state);
+  const std::size_t nComponents = graph.componentOffsets.size() - 1;
+
+  std::vector<std::size_t> shared(state.numberOfTracks, 0);
+  // number of selected tracks per measurement
+  std::vector<std::uint32_t> users(graph.measurementOffsets.size() - 1);
+  for (std::size_t i = 0; i < users.size(); ++i) {
+    users[i] = graph.measurementOffsets[i + 1] - graph.measurementOffsets[i];
+  }
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    for (std::uint32_t k = graph.trackOffsets[iTrack];
+         k < graph.trackOffsets[iTrack + 1]; ++k) {
+      shared[iTrack] += users[graph.trackMeasurements[k]] > 1 ? 1 : 0;
+    }
+  }
+  // components only write to their own tracks and measurements
+  std::vector<std::uint8_t> removed(state.numberOfTracks, 0);
+
+  /// Queue entry with the eviction key at the time it was pushed
+  struct Candidate {
+    double relativeShared = 0;
+    std::size_t nMeasurements = 0;
+    float chi2 = 0;
+    std::uint32_t track = 0;
+    std::size_t shared = 0;
+  };
+  /// Same ordering as in resolve, the worst track ends up on top and ties are
+  /// broken towards the lowest track index
+  auto lessBad = [](const Candidate& a, const Candidate& b) {
+    if (a.relativeShared != b.relativeShared) {
+      return a.relativeShared < b.relativeShared;
+    }
+    if (a.nMeasurements == b.nMeasurements) {
+      if (a.chi2 != b.chi2) {
+        return a.chi2 < b.chi2;
+      }
+      return a.track > b.track;
+    }
+    return a.nMeasurements > b.nMeasurements;
+  };
+  auto makeCandidate = [&](std::uint32_t iTrack) {
+    std::size_t nMeasurements = state.measurementsPerTrack[iTrack].size();
+    return Candidate{1.0 * shared[iTrack] / nMeasurements, nMeasurements,
+                     state.trackChi2[iTrack], iTrack, shared[iTrack]};
+  };
+
+  auto resolveComponent = [&](std::size_t iComponent) {
+    std::span<const std::uint32_t> tracks(
+        graph.componentTracks.data() + graph.componentOffsets[iComponent],
+        graph.componentOffsets[iComponent + 1] -
+            graph.componentOffsets[iComponent]);
+
+    // number of tracks that still violate the shared hits criterion
+    std::size_t nViolating = 0;
+    for (std::uint32_t iTrack : tracks) {
+      nViolating += shared[iTrack] >= m_cfg.maximumSharedHits ? 1 : 0;
+    }
+    if (nViolating == 0) {
+      return;
+    }
+
+    std::priority_queue<Candidate, std::vector<Candidate>, decltype(lessBad)>
+        queue(lessBad);
+    for (std::uint32_t iTrack : tracks) {
+      queue.push(makeCandidate(iTrack));
+    }
+
+    for (std::uint32_t i = 0; i < m_cfg.maximumIterations; ++i) {
+      if (nViolating == 0 || queue.empty()) {
+        break;
+      }
+      // skip entries of removed tracks and outdated shared counts
+      Candidate bad = queue.top();
+      queue.pop();
+      while (removed[bad.track] != 0 || bad.shared != shared[bad.track]) {
+        bad = queue.top();
+        queue.pop();
+      }
+
+      std::uint32_t badTrack = bad.track;
+      removed[badTrack] = 1;
+      nViolating -= shared[badTrack] >= m_cfg.maximumSharedHits ? 1 : 0;
+      for (std::uint32_t k = graph.trackOffsets[badTrack];
+           k < graph.trackOffsets[badTrack + 1]; ++k) {
+        std::uint32_t iMeasurement = graph.trackMeasurements[k];
+        if (--users[iMeasurement] != 1) {
+          continue;
+        }
+        // the measurement is no longer shared by the remaining track
+        for (std::uint32_t j = graph.measurementOffsets[iMeasurement];
+             j < graph.measurementOffsets[iMeasurement + 1]; ++j) {
+          std::uint32_t jTrack = graph.measurementTracks[j];
+          if (removed[jTrack] != 0) {
+            continue;
+          }
+          nViolating -= shared[jTrack] == m_cfg.maximumSharedHits ? 1 : 0;
+          --shared[jTrack];
+          queue.push(makeCandidate(jTrack));
+          break;
+        }
+      }
+    }
+  };
+
+  // components only touch their own tracks and measurements, so contiguous
+  // ranges of them can be resolved concurrently
+  parallelFor(m_cfg.executor.get(), nComponents,
+              [&](std::size_t /*chunk*/, std::size_t begin, std::size_t end) {
+                for (std::size_t iComponent = begin; iComponent < end;
+                     ++iComponent) {
+                  resolveComponent(iComponent);
+                }
+              });
+
+  // write the result back so the state looks like after resolve
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    if (removed[iTrack] == 0) {
+      state.sharedMeasurementsPerTrack[iTrack] = shared[iTrack];
+      continue;
+    }
+    ACTS_VERBOSE("remove track " << iTrack << " nMeas "
+                                 << state.measurementsPerTrack[iTrack].size()
+                                 << " chi2 " << state.trackChi2[iTrack]);
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      state.tracksPerMeasurement[iMeasurement].erase(iTrack);
+    }
+    state.selectedTracks.erase(iTrack);
+  }
+}
+
 }  // namespace Acts
@@ -161,6 +161,14 @@ void SpacePointContainer2::clear() noexcept {
   }
 }
 
+void SpacePointContainer2::shrinkToFit() {
+  m_sourceLinks.shrink_to_fit();
+
+  for (const auto &[name, column] : m_allColumns) {
+    column->shrinkToFit();
+  }
+}
+
 MutableSpacePointProxy2 SpacePointContainer2::createSpacePoint() noexcept {
   ++m_size;
 
@@ -18,6 +18,7 @@
 #include "Acts/Geometry/VolumeBounds.hpp"
 #include "Acts/Geometry/detail/AlignablePortalVisitor.hpp"
 #include "Acts/Geometry/detail/BoundDeduplicator.hpp"
+#include "Acts/Geometry/detail/SurfaceTransformPooler.hpp"
 #include "Acts/Navigation/INavigationPolicy.hpp"
 #include "Acts/Navigation/TryAllNavigationPolicy.hpp"
 #include "Acts/Utilities/GraphViz.hpp"
@@ -313,8 +314,20 @@ std::unique_ptr<TrackingGeometry> Blueprint::construct(
   Acts::detail::AlignablePortalVisitor alignPortals{gctx, logger};
   world->apply(alignPortals);
 
-  return std::make_unique<TrackingGeometry>(
+  std::shared_ptr<SurfaceTransformStore> transformStore;
+  if (m_cfg.poolSurfaceTransforms) {
+    detail::SurfaceTransformPooler pooler{gctx};
+    world->apply(pooler);
+    ACTS_DEBUG(prefix() << "Moved " << pooler.store()->size()
+                        << " surface transforms into contiguous storage");
+    transformStore = pooler.store();
+  }
+
+  auto trackingGeometry = std::make_unique<TrackingGeometry>(
       std::move(world), nullptr, GeometryIdentifierHook{}, logger, false);
+  // the geometry keeps the only mutable handle on the pooled transforms
+  trackingGeometry->m_surfaceTransformStore = std::move(transformStore);
+  return trackingGeometry;
 }
 
 }  // namespace Acts::Experimental
@@ -0,0 +1,26 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/detail/SurfaceTransformPooler.hpp"
+
+#include "Acts/Surfaces/Surface.hpp"
+
+namespace Acts::detail {
+
+void SurfaceTransformPooler::visitSurface(Surface& surface) {
+  if (surface.surfacePlacement() != nullptr ||
+      surface.transformStore() == m_store.get()) {
+    return;
+  }
+  // The transform has to be copied before the surface releases it
+  const std::size_t index =
+      m_store->insert(surface.localToGlobalTransform(m_gctx));
+  surface.assignTransformStore(m_store, index);
+}
+
+}  // namespace Acts::detail
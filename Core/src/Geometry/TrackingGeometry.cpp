@@ -9,6 +9,8 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 
 #include "Acts/Definitions/Tolerance.hpp"
+#include "Acts/Geometry/CutoutCylinderVolumeBounds.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Geometry/GeometryObject.hpp"
@@ -16,8 +18,17 @@
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Material/ProtoVolumeMaterial.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceTransformStore.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+#include <boost/container/small_vector.hpp>
 
 namespace Acts {
 
@@ -201,6 +212,355 @@ class GeometryIdMapVisitor : public TrackingGeometryVisitor {
 };
 
 }  // namespace
+
+/// Flattened copy of the volume hierarchy for the lowest volume search.
+///
+/// Every tracking volume becomes a node that lists its dense volumes and its
+/// child volumes in the order in which TrackingVolume::lowestTrackingVolume
+/// visits them. Each child carries a conservative axis aligned box in global
+/// coordinates. Nodes with few children test the boxes linearly, larger ones
+/// get a small bounding volume hierarchy, so the exact inside check only runs
+/// for the children whose box contains the position.
+class TrackingGeometry::VolumeLookup {
+ public:
+  /// Build the lookup, returns nullptr if the hierarchy is not supported
+  static std::shared_ptr<const VolumeLookup> build(const TrackingVolume& world,
+                                                   const Logger& logger);
+
+  const TrackingVolume* find(const GeometryContext& gctx,
+                             const Vector3& position) const;
+
+ private:
+  /// Children up to this number are checked without a hierarchy
+  static constexpr std::size_t s_linearChildren = 8;
+  /// Maximum number of children in a hierarchy leaf
+  static constexpr std::uint32_t s_leafSize = 4;
+  /// Maximum depth of the per node hierarchies
+  static constexpr std::size_t s_maxDepth = 64;
+
+  struct Child {
+    const TrackingVolume* volume = nullptr;
+    // index of the child node, unused for dense volumes
+    std::uint32_t node = 0;
+    bool dense = false;
+    bool bounded = true;
+    Vector3 min = Vector3::Zero();
+    Vector3 max = Vector3::Zero();
+
+    bool contains(const Vector3& position) const {
+      return (position.array() >= min.array()).all() &&
+             (position.array() <= max.array()).all();
+    }
+  };
+
+  struct BvhNode {
+    Vector3 min = Vector3::Zero();
+    Vector3 max = Vector3::Zero();
+    // leaf: first item, inner: index of the right child
+    std::uint32_t first = 0;
+    // number of items, zero for inner nodes
+    std::uint32_t count = 0;
+  };
+
+  struct Node {
+    const TrackingVolume* volume = nullptr;
+    const TrackingVolumeArray* confined = nullptr;
+    std::uint32_t childBegin = 0;
+    std::uint32_t childEnd = 0;
+    // index of the hierarchy root or -1 for a linear search
+    std::int32_t bvhRoot = -1;
+    // children without a usable bounding box
+    std::uint32_t unboundedBegin = 0;
+    std::uint32_t unboundedEnd = 0;
+  };
+
+  bool addNode(const TrackingVolume& volume, std::uint32_t& index);
+
+  Child makeChild(const TrackingVolume& volume, bool dense) const;
+
+  std::uint32_t buildBvh(std::uint32_t begin, std::uint32_t end);
+
+  const Child* firstChild(const GeometryContext& gctx, const Node& node,
+                          const Vector3& position) const;
+
+  std::vector<Node> m_nodes;
+  std::vector<Child> m_children;
+  std::vector<BvhNode> m_bvh;
+  // child indices referenced by the hierarchy leaves
+  std::vector<std::uint32_t> m_bvhItems;
+  std::vector<std::uint32_t> m_unbounded;
+  std::unordered_map<const TrackingVolume*, std::uint32_t> m_nodeIndex;
+};
+
+std::shared_ptr<const TrackingGeometry::VolumeLookup>
+TrackingGeometry::VolumeLookup::build(const TrackingVolume& world,
+                                      const Logger& logger) {
+  auto lookup = std::make_shared<VolumeLookup>();
+  std::uint32_t root = 0;
+  if (!lookup->addNode(world, root)) {
+    ACTS_DEBUG("Alignable volumes found, no accelerated volume lookup");
+    return nullptr;
+  }
+  ACTS_DEBUG("Volume lookup built with "
+             << lookup->m_nodes.size() << " nodes and "
+             << lookup->m_bvh.size() << " hierarchy nodes");
+  return lookup;
+}
+
+bool TrackingGeometry::VolumeLookup::addNode(const TrackingVolume& volume,
+                                             std::uint32_t& index) {
+  if (auto it = m_nodeIndex.find(&volume); it != m_nodeIndex.end()) {
+    index = it->second;
+    return true;
+  }
+  // the boxes are computed once, which requires static placements
+  if (volume.isAlignable()) {
+    return false;
+  }
+  index = static_cast<std::uint32_t>(m_nodes.size());
+  m_nodeIndex.emplace(&volume, index);
+  m_nodes.emplace_back();
+  m_nodes[index].volume = &volume;
+
+  auto confined = volume.confinedVolumes();
+  if (confined != nullptr) {
+    m_nodes[index].confined = confined.get();
+    for (const auto& object : confined->arrayObjects()) {
+      std::uint32_t childIndex = 0;
+      if (object != nullptr && !addNode(*object, childIndex)) {
+        return false;
+      }
+    }
+  }
+
+  std::vector<Child> children;
+  for (const auto& dense : volume.denseVolumes()) {
+    if (dense->isAlignable()) {
+      return false;
+    }
+    children.push_back(makeChild(*dense, true));
+  }
+  for (const auto& child : volume.volumes()) {
+    Child entry = makeChild(child, false);
+    if (!addNode(child, entry.node)) {
+      return false;
+    }
+    children.push_back(entry);
+  }
+
+  Node& node = m_nodes[index];
+  node.childBegin = static_cast<std::uint32_t>(m_children.size());
+  m_children.insert(m_children.end(), children.begin(), children.end());
+  node.childEnd = static_cast<std::uint32_t>(m_children.size());
+
+  if (children.size() > s_linearChildren) {
+    auto itemBegin = static_cast<std::uint32_t>(m_bvhItems.size());
+    node.unboundedBegin = static_cast<std::uint32_t>(m_unbounded.size());
+    for (std::uint32_t c = node.childBegin; c < node.childEnd; ++c) {
+      if (m_children[c].bounded) {
+        m_bvhItems.push_back(c);
+      } else {
+        m_unbounded.push_back(c);
+      }
+    }
+    node.unboundedEnd = static_cast<std::uint32_t>(m_unbounded.size());
+    auto itemEnd = static_cast<std::uint32_t>(m_bvhItems.size());
+    if (itemBegin < itemEnd) {
+      std::uint32_t root = buildBvh(itemBegin, itemEnd);
+      m_nodes[index].bvhRoot = static_cast<std::int32_t>(root);
+    }
+  }
+  return true;
+}
+
+TrackingGeometry::VolumeLookup::Child
+TrackingGeometry::VolumeLookup::makeChild(const TrackingVolume& volume,
+                                          bool dense) const {
+  // widen the boxes well beyond the tolerance of the inside check
+  const Vector3 envelope = Vector3::Constant(10. * s_onSurfaceTolerance);
+
+  Child child;
+  child.volume = &volume;
+  child.dense = dense;
+
+  const VolumeBounds& bounds = volume.volumeBounds();
+  std::optional<Volume::BoundingBox> box;
+  switch (bounds.type()) {
+    case VolumeBounds::eCuboid:
+    case VolumeBounds::eGenericCuboid:
+    case VolumeBounds::eTrapezoid:
+      box = volume.boundingBox(envelope);
+      break;
+    case VolumeBounds::eCylinder: {
+      // the cylinder box ignores the average phi and the bevels, use the
+      // full circle and only accept cylinders with flat ends
+      const auto& cylinder = static_cast<const CylinderVolumeBounds&>(bounds);
+      if (cylinder.get(CylinderVolumeBounds::eBevelMinZ) == 0. &&
+          cylinder.get(CylinderVolumeBounds::eBevelMaxZ) == 0.) {
+        double r = cylinder.get(CylinderVolumeBounds::eMaxR);
+        double z = cylinder.get(CylinderVolumeBounds::eHalfLengthZ);
+        box = Volume::BoundingBox(&volume, Vector3(-r, -r, -z) - envelope,
+                                  Vector3(r, r, z) + envelope);
+      }
+      break;
+    }
+    case VolumeBounds::eCutoutCylinder: {
+      const auto& cutout =
+          static_cast<const CutoutCylinderVolumeBounds&>(bounds);
+      double r = cutout.get(CutoutCylinderVolumeBounds::eMaxR);
+      double z = cutout.get(CutoutCylinderVolumeBounds::eHalfLengthZ);
+      box = Volume::BoundingBox(&volume, Vector3(-r, -r, -z) - envelope,
+                                Vector3(r, r, z) + envelope);
+      break;
+    }
+    default:
+      break;
+  }
+
+  if (!box.has_value()) {
+    child.bounded = false;
+    return child;
+  }
+  if (bounds.type() == VolumeBounds::eCylinder ||
+      bounds.type() == VolumeBounds::eCutoutCylinder) {
+    box = box->transformed(volume.localToGlobalTransform(
+        GeometryContext::dangerouslyDefaultConstruct()));
+  }
+  child.min = box->min();
+  child.max = box->max();
+  return child;
+}
+
+std::uint32_t TrackingGeometry::VolumeLookup::buildBvh(std::uint32_t begin,
+                                                       std::uint32_t end) {
+  auto index = static_cast<std::uint32_t>(m_bvh.size());
+  m_bvh.emplace_back();
+
+  Vector3 min = Vector3::Constant(std::numeric_limits<double>::max());
+  Vector3 max = Vector3::Constant(std::numeric_limits<double>::lowest());
+  Vector3 cmin = min;
+  Vector3 cmax = max;
+  for (std::uint32_t i = begin; i < end; ++i) {
+    const Child& child = m_children[m_bvhItems[i]];
+    min = min.cwiseMin(child.min);
+    max = max.cwiseMax(child.max);
+    Vector3 center = 0.5 * (child.min + child.max);
+    cmin = cmin.cwiseMin(center);
+    cmax = cmax.cwiseMax(center);
+  }
+  m_bvh[index].min = min;
+  m_bvh[index].max = max;
+
+  if (end - begin <= s_leafSize) {
+    m_bvh[index].first = begin;
+    m_bvh[index].count = end - begin;
+    return index;
+  }
+
+  // median split along the longest extent of the box centers
+  Eigen::Index axis = 0;
+  (cmax - cmin).maxCoeff(&axis);
+  std::uint32_t middle = begin + (end - begin) / 2;
+  std::nth_element(m_bvhItems.begin() + begin, m_bvhItems.begin() + middle,
+                   m_bvhItems.begin() + end,
+                   [&](std::uint32_t a, std::uint32_t b) {
+                     const Child& ca = m_children[a];
+                     const Child& cb = m_children[b];
+                     return ca.min[axis] + ca.max[axis] <
+                            cb.min[axis] + cb.max[axis];
+                   });
+
+  buildBvh(begin, middle);
+  std::uint32_t right = buildBvh(middle, end);
+  m_bvh[index].first = right;
+  m_bvh[index].count = 0;
+  return index;
+}
+
+const TrackingGeometry::VolumeLookup::Child*
+TrackingGeometry::VolumeLookup::firstChild(const GeometryContext& gctx,
+                                           const Node& node,
+                                           const Vector3& position) const {
+  if (node.bvhRoot < 0 && node.unboundedBegin == node.unboundedEnd) {
+    for (std::uint32_t c = node.childBegin; c < node.childEnd; ++c) {
+      const Child& child = m_children[c];
+      if ((!child.bounded || child.contains(position)) &&
+          child.volume->inside(gctx, position, s_onSurfaceTolerance)) {
+        return &child;
+      }
+    }
+    return nullptr;
+  }
+
+  boost::container::small_vector<std::uint32_t, 8> candidates(
+      m_unbounded.begin() + node.unboundedBegin,
+      m_unbounded.begin() + node.unboundedEnd);
+  if (node.bvhRoot >= 0) {
+    std::array<std::uint32_t, s_maxDepth> stack{};
+    std::size_t depth = 0;
+    stack[depth++] = static_cast<std::uint32_t>(node.bvhRoot);
+    while (depth > 0) {
+      const BvhNode& bvh = m_bvh[stack[--depth]];
+      if ((position.array() < bvh.min.array()).any() ||
+          (position.array() > bvh.max.array()).any()) {
+        continue;
+      }
+      if (bvh.count > 0) {
+        for (std::uint32_t i = bvh.first; i < bvh.first + bvh.count; ++i) {
+          if (m_children[m_bvhItems[i]].contains(position)) {
+            candidates.push_back(m_bvhItems[i]);
+          }
+        }
+        continue;
+      }
+      std::uint32_t left = static_cast<std::uint32_t>(&bvh - m_bvh.data()) + 1;
+      stack[depth++] = bvh.first;
+      stack[depth++] = left;
+    }
+  }
+
+  // keep the order of the hierarchy walk for overlapping children
+  std::ranges::sort(candidates);
+  for (std::uint32_t c : candidates) {
+    const Child& child = m_children[c];
+    if (child.volume->inside(gctx, position, s_onSurfaceTolerance)) {
+      return &child;
+    }
+  }
+  return nullptr;
+}
+
+const TrackingVolume* TrackingGeometry::VolumeLookup::find(
+    const GeometryContext& gctx, const Vector3& position) const {
+  std::uint32_t current = 0;
+  bool checked = false;
+  while (true) {
+    const Node& node = m_nodes[current];
+    if (!checked &&
+        !node.volume->inside(gctx, position, s_onSurfaceTolerance)) {
+      return nullptr;
+    }
+    // confined static volumes - highest hierarchy
+    if (node.confined != nullptr) {
+      const TrackingVolume* confined = node.confined->object(position).get();
+      if (confined != nullptr) {
+        current = m_nodeIndex.at(confined);
+        checked = false;
+        continue;
+      }
+    }
+    const Child* child = firstChild(gctx, node, position);
+    if (child == nullptr) {
+      return node.volume;
+    }
+    if (child->dense) {
+      return child->volume;
+    }
+    current = child->node;
+    checked = true;
+  }
+}
+
 TrackingGeometry::TrackingGeometry(
     const MutableTrackingVolumePtr& highestVolume,
     const IMaterialDecorator* materialDecorator,
@@ -223,12 +583,17 @@ TrackingGeometry::TrackingGeometry(
 
   m_volumesById.rehash(0);
   m_surfacesById.rehash(0);
+
+  m_volumeLookup = VolumeLookup::build(*m_world, logger);
 }
 
 TrackingGeometry::~TrackingGeometry() = default;
 
 const TrackingVolume* TrackingGeometry::lowestTrackingVolume(
     const GeometryContext& gctx, const Vector3& gp) const {
+  if (m_volumeLookup != nullptr) {
+    return m_volumeLookup->find(gctx, gp);
+  }
   return m_world->lowestTrackingVolume(gctx, gp, s_onSurfaceTolerance);
 }
 
@@ -276,6 +641,14 @@ TrackingGeometry::geoIdSurfaceMap() const {
   return m_surfacesById;
 }
 
+const SurfaceTransformStore* TrackingGeometry::surfaceTransformStore() const {
+  return m_surfaceTransformStore.get();
+}
+
+SurfaceTransformStore* TrackingGeometry::surfaceTransformStore() {
+  return m_surfaceTransformStore.get();
+}
+
 void TrackingGeometry::visualize(IVisualization3D& helper,
                                  const GeometryContext& gctx,
                                  const ViewConfig& viewConfig,
@@ -0,0 +1,272 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/MagneticField/TabulatedBField.hpp"
+
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Utilities/AxisDefinitions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Acts {
+
+/// Field values at the (tileSize + 1)^3 grid points of a tile, the first axis
+/// runs fastest
+struct TabulatedBField::Tile {
+  std::vector<Vector3> values;
+  /// Lookups inside this tile are forwarded to the wrapped provider
+  bool exact = false;
+};
+
+namespace {
+
+/// Trilinear interpolation inside the bin with lower grid point @p base
+Vector3 interpolateBin(const std::vector<Vector3>& values, std::size_t nNodes,
+                       const std::array<std::size_t, 3>& base,
+                       const Vector3& frac) {
+  const std::size_t strideY = nNodes;
+  const std::size_t strideZ = nNodes * nNodes;
+  const std::size_t i000 = base[0] + base[1] * strideY + base[2] * strideZ;
+
+  const Vector3 c00 =
+      values[i000] * (1 - frac.x()) + values[i000 + 1] * frac.x();
+  const Vector3 c10 = values[i000 + strideY] * (1 - frac.x()) +
+                      values[i000 + strideY + 1] * frac.x();
+  const Vector3 c01 = values[i000 + strideZ] * (1 - frac.x()) +
+                      values[i000 + strideZ + 1] * frac.x();
+  const Vector3 c11 = values[i000 + strideY + strideZ] * (1 - frac.x()) +
+                      values[i000 + strideY + strideZ + 1] * frac.x();
+
+  const Vector3 c0 = c00 * (1 - frac.y()) + c10 * frac.y();
+  const Vector3 c1 = c01 * (1 - frac.y()) + c11 * frac.y();
+  return c0 * (1 - frac.z()) + c1 * frac.z();
+}
+
+}  // namespace
+
+TabulatedBField::TabulatedBField(
+    std::shared_ptr<const MagneticFieldProvider> field, const Config& cfg)
+    : m_cfg(cfg), m_field(std::move(field)) {
+  if (m_field == nullptr) {
+    throw std::invalid_argument("TabulatedBField: missing field provider");
+  }
+  if (m_cfg.tileSize == 0) {
+    throw std::invalid_argument("TabulatedBField: tile size must be > 0");
+  }
+  if ((m_cfg.binSize.array() <= 0).any()) {
+    throw std::invalid_argument("TabulatedBField: bin size must be > 0");
+  }
+  if ((m_cfg.max.array() <= m_cfg.min.array()).any()) {
+    throw std::invalid_argument(
+        "TabulatedBField: max must be larger than min in all directions");
+  }
+
+  std::size_t nTilesTotal = 1;
+  for (std::size_t i = 0; i < 3; ++i) {
+    const auto nBins = static_cast<std::size_t>(
+        std::ceil((m_cfg.max[i] - m_cfg.min[i]) / m_cfg.binSize[i]));
+    m_nTiles[i] = (nBins + m_cfg.tileSize - 1) / m_cfg.tileSize;
+    nTilesTotal *= m_nTiles[i];
+  }
+
+  m_tiles = std::make_unique<std::atomic<const Tile*>[]>(nTilesTotal);
+  for (std::size_t i = 0; i < nTilesTotal; ++i) {
+    m_tiles[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+TabulatedBField::~TabulatedBField() {
+  for (std::size_t i = 0; i < numTiles(); ++i) {
+    delete m_tiles[i].load(std::memory_order_acquire);
+  }
+}
+
+MagneticFieldProvider::Cache TabulatedBField::makeCache(
+    const MagneticFieldContext& mctx) const {
+  return MagneticFieldProvider::Cache(std::in_place_type<Cache>, mctx,
+                                      *m_field);
+}
+
+Result<Vector3> TabulatedBField::getField(
+    const Vector3& position, MagneticFieldProvider::Cache& cache) const {
+  Cache& lCache = cache.as<Cache>();
+
+  if ((position.array() < m_cfg.min.array()).any() ||
+      (position.array() >= m_cfg.max.array()).any()) {
+    return m_field->getField(position, *lCache.fieldCache);
+  }
+
+  const Vector3 local = (position - m_cfg.min).cwiseQuotient(m_cfg.binSize);
+  std::array<std::size_t, 3> tileCoords{};
+  std::array<std::size_t, 3> base{};
+  Vector3 frac;
+  for (std::size_t i = 0; i < 3; ++i) {
+    // Guard against rounding up to the upper edge of the region
+    const std::size_t bin =
+        std::min(static_cast<std::size_t>(local[i]),
+                 m_nTiles[i] * m_cfg.tileSize - 1);
+    tileCoords[i] = bin / m_cfg.tileSize;
+    base[i] = bin - tileCoords[i] * m_cfg.tileSize;
+    frac[i] = local[i] - static_cast<double>(bin);
+  }
+  const std::size_t tileIndex =
+      tileCoords[0] +
+      m_nTiles[0] * (tileCoords[1] + m_nTiles[1] * tileCoords[2]);
+
+  if (lCache.tileIndex != tileIndex) {
+    lCache.tile = &tile(tileIndex, *lCache.fieldCache);
+    lCache.tileIndex = tileIndex;
+  }
+
+  if (lCache.tile->exact) {
+    return m_field->getField(position, *lCache.fieldCache);
+  }
+  return Result<Vector3>::success(
+      interpolateBin(lCache.tile->values, m_cfg.tileSize + 1, base, frac));
+}
+
+const TabulatedBField::Tile& TabulatedBField::tile(
+    std::size_t tileIndex, MagneticFieldProvider::Cache& fieldCache) const {
+  std::atomic<const Tile*>& slot = m_tiles[tileIndex];
+  if (const Tile* filled = slot.load(std::memory_order_acquire);
+      filled != nullptr) {
+    return *filled;
+  }
+
+  const std::array<std::size_t, 3> tileCoords = {
+      tileIndex % m_nTiles[0], (tileIndex / m_nTiles[0]) % m_nTiles[1],
+      tileIndex / (m_nTiles[0] * m_nTiles[1])};
+  std::unique_ptr<Tile> newTile = fillTile(tileCoords, fieldCache);
+
+  // Publish the tile unless another thread was faster
+  const Tile* expected = nullptr;
+  if (slot.compare_exchange_strong(expected, newTile.get(),
+                                   std::memory_order_acq_rel)) {
+    return *newTile.release();
+  }
+  return *expected;
+}
+
+std::unique_ptr<TabulatedBField::Tile> TabulatedBField::fillTile(
+    const std::array<std::size_t, 3>& tileCoords,
+    MagneticFieldProvider::Cache& fieldCache) const {
+  const std::size_t n = m_cfg.tileSize;
+  const std::size_t nNodes = n + 1;
+
+  Vector3 origin;
+  for (std::size_t i = 0; i < 3; ++i) {
+    origin[i] = m_cfg.min[i] + tileCoords[i] * n * m_cfg.binSize[i];
+  }
+
+  auto newTile = std::make_unique<Tile>();
+  newTile->values.reserve(nNodes * nNodes * nNodes);
+  for (std::size_t k = 0; k < nNodes; ++k) {
+    for (std::size_t j = 0; j < nNodes; ++j) {
+      for (std::size_t i = 0; i < nNodes; ++i) {
+        const Vector3 node =
+            origin + Vector3(i, j, k).cwiseProduct(m_cfg.binSize);
+        auto field = m_field->getField(node, fieldCache);
+        if (!field.ok()) {
+          newTile->values.clear();
+          newTile->exact = true;
+          return newTile;
+        }
+        newTile->values.push_back(*field);
+      }
+    }
+  }
+
+  if (m_cfg.maxError <= 0) {
+    return newTile;
+  }
+
+  // Compare the interpolation with the exact field at the bin centres, where
+  // the deviation of a trilinear interpolation is typically largest
+  const Vector3 half = Vector3::Constant(0.5);
+  for (std::size_t k = 0; k < n; ++k) {
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t i = 0; i < n; ++i) {
+        const Vector3 center =
+            origin + (Vector3(i, j, k) + half).cwiseProduct(m_cfg.binSize);
+        auto field = m_field->getField(center, fieldCache);
+        if (!field.ok() ||
+            (interpolateBin(newTile->values, nNodes, {i, j, k}, half) - *field)
+                    .norm() > m_cfg.maxError) {
+          newTile->values.clear();
+          newTile->exact = true;
+          return newTile;
+        }
+      }
+    }
+  }
+  return newTile;
+}
+
+void TabulatedBField::prewarm(const Extent& extent,
+                              const MagneticFieldContext& mctx) const {
+  static constexpr std::array<AxisDirection, 3> axes = {
+      AxisDirection::AxisX, AxisDirection::AxisY, AxisDirection::AxisZ};
+
+  std::array<std::size_t, 3> first{};
+  std::array<std::size_t, 3> last{};
+  for (std::size_t i = 0; i < 3; ++i) {
+    first[i] = 0;
+    last[i] = m_nTiles[i] - 1;
+    if (!extent.constrains(axes[i])) {
+      continue;
+    }
+    const double tileLength = m_cfg.tileSize * m_cfg.binSize[i];
+    const double lo = std::max(extent.min(axes[i]), m_cfg.min[i]);
+    const double hi = std::min(extent.max(axes[i]), m_cfg.max[i]);
+    if (hi < lo) {
+      return;
+    }
+    first[i] = static_cast<std::size_t>((lo - m_cfg.min[i]) / tileLength);
+    last[i] = std::min(
+        m_nTiles[i] - 1,
+        static_cast<std::size_t>((hi - m_cfg.min[i]) / tileLength));
+  }
+
+  auto fieldCache = m_field->makeCache(mctx);
+  for (std::size_t k = first[2]; k <= last[2]; ++k) {
+    for (std::size_t j = first[1]; j <= last[1]; ++j) {
+      for (std::size_t i = first[0]; i <= last[0]; ++i) {
+        tile(i + m_nTiles[0] * (j + m_nTiles[1] * k), fieldCache);
+      }
+    }
+  }
+}
+
+std::size_t TabulatedBField::numFilledTiles() const {
+  std::size_t nFilled = 0;
+  for (std::size_t i = 0; i < numTiles(); ++i) {
+    if (m_tiles[i].load(std::memory_order_acquire) != nullptr) {
+      ++nFilled;
+    }
+  }
+  return nFilled;
+}
+
+std::size_t TabulatedBField::numExactTiles() const {
+  std::size_t nExact = 0;
+  for (std::size_t i = 0; i < numTiles(); ++i) {
+    const Tile* filled = m_tiles[i].load(std::memory_order_acquire);
+    if (filled != nullptr && filled->exact) {
+      ++nExact;
+    }
+  }
+  return nExact;
+}
+
+std::size_t TabulatedBField::numTiles() const {
+  return m_nTiles[0] * m_nTiles[1] * m_nTiles[2];
+}
+
+}  // namespace Acts
@@ -20,6 +20,7 @@ Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
     : ISurfaceMaterial(splitFactor, mappingType), m_binUtility(binUtility) {
   // fill the material with deep copy
   m_fullMaterial.push_back(std::move(fullProperties));
+  updateConstants();
 }
 
 Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
@@ -27,7 +28,9 @@ Acts::BinnedSurfaceMaterial::BinnedSurfaceMaterial(
     double splitFactor, Acts::MappingType mappingType)
     : ISurfaceMaterial(splitFactor, mappingType),
       m_binUtility(binUtility),
-      m_fullMaterial(std::move(fullProperties)) {}
+      m_fullMaterial(std::move(fullProperties)) {
+  updateConstants();
+}
 
 Acts::BinnedSurfaceMaterial& Acts::BinnedSurfaceMaterial::scale(double factor) {
   for (auto& materialVector : m_fullMaterial) {
@@ -35,6 +38,11 @@ Acts::BinnedSurfaceMaterial& Acts::BinnedSurfaceMaterial::scale(double factor) {
       materialBin.scaleThickness(factor);
     }
   }
+  for (auto& constantsVector : m_fullConstants) {
+    for (auto& constantsBin : constantsVector) {
+      constantsBin.scaleThickness(factor);
+    }
+  }
   return (*this);
 }
 
@@ -54,6 +62,26 @@ const Acts::MaterialSlab& Acts::BinnedSurfaceMaterial::materialSlab(
   return m_fullMaterial[ibin1][ibin0];
 }
 
+Acts::MaterialInteractionConstants
+Acts::BinnedSurfaceMaterial::interactionConstants(
+    const Acts::Vector3& gp, Direction pDir, MaterialUpdateMode mode) const {
+  std::size_t ibin0 = m_binUtility.bin(gp, 0);
+  std::size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(gp, 1) : 0;
+  return scaledConstants(m_fullConstants[ibin1][ibin0], pDir, mode);
+}
+
+void Acts::BinnedSurfaceMaterial::updateConstants() {
+  m_fullConstants.clear();
+  m_fullConstants.reserve(m_fullMaterial.size());
+  for (const auto& materialVector : m_fullMaterial) {
+    auto& constantsVector = m_fullConstants.emplace_back();
+    constantsVector.reserve(materialVector.size());
+    for (const auto& materialBin : materialVector) {
+      constantsVector.emplace_back(materialBin);
+    }
+  }
+}
+
 std::ostream& Acts::BinnedSurfaceMaterial::toStream(std::ostream& sl) const {
   sl << "Acts::BinnedSurfaceMaterial : " << std::endl;
   sl << "   - Number of Material bins [0,1] : " << m_binUtility.max(0) + 1
@@ -17,10 +17,13 @@ namespace Acts {
 HomogeneousSurfaceMaterial::HomogeneousSurfaceMaterial(const MaterialSlab& full,
                                                        double splitFactor,
                                                        MappingType mappingType)
-    : ISurfaceMaterial(splitFactor, mappingType), m_fullMaterial(full) {}
+    : ISurfaceMaterial(splitFactor, mappingType),
+      m_fullMaterial(full),
+      m_fullConstants(full) {}
 
 HomogeneousSurfaceMaterial& HomogeneousSurfaceMaterial::scale(double factor) {
   m_fullMaterial.scaleThickness(factor);
+  m_fullConstants.scaleThickness(factor);
   return *this;
 }
 
@@ -34,6 +37,11 @@ const MaterialSlab& HomogeneousSurfaceMaterial::materialSlab(
   return m_fullMaterial;
 }
 
+MaterialInteractionConstants HomogeneousSurfaceMaterial::interactionConstants(
+    const Vector3& /*gp*/, Direction pDir, MaterialUpdateMode mode) const {
+  return scaledConstants(m_fullConstants, pDir, mode);
+}
+
 std::ostream& HomogeneousSurfaceMaterial::toStream(std::ostream& sl) const {
   sl << "HomogeneousSurfaceMaterial : " << std::endl;
   sl << "   - fullMaterial : " << m_fullMaterial << std::endl;
@@ -59,4 +59,23 @@ MaterialSlab ISurfaceMaterial::materialSlab(const Vector3& gp, Direction pDir,
   return plainMatProp;
 }
 
+MaterialInteractionConstants ISurfaceMaterial::interactionConstants(
+    const Vector3& gp, Direction pDir, MaterialUpdateMode mode) const {
+  return MaterialInteractionConstants(materialSlab(gp, pDir, mode));
+}
+
+MaterialInteractionConstants ISurfaceMaterial::scaledConstants(
+    MaterialInteractionConstants constants, Direction pDir,
+    MaterialUpdateMode mode) const {
+  // Scale if you have material to scale
+  if (!constants.isVacuum()) {
+    double scaleFactor = factor(pDir, mode);
+    if (scaleFactor == 0.) {
+      return MaterialInteractionConstants();
+    }
+    constants.scaleThickness(scaleFactor);
+  }
+  return constants;
+}
+
 }  // namespace Acts
@@ -15,6 +15,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <stdexcept>
 
 using namespace Acts::UnitLiterals;
 
@@ -169,8 +170,62 @@ inline float computeEnergyLossLandauFwhm(const Acts::MaterialSlab& slab,
 
 }  // namespace detail
 
+/// Compute the density correction factor delta/2 from precomputed constants.
+inline float computeDeltaHalf(const Acts::MaterialInteractionConstants& c,
+                              const RelativisticQuantities& rq) {
+  // same as above with the material dependent terms precomputed
+  if (rq.betaGamma < 10.0f) {
+    return 0.0f;
+  }
+  return std::log(rq.betaGamma) + c.deltaHalfOffset();
+}
+
+inline float computeBetheLoss(const Acts::MaterialInteractionConstants& c,
+                              float m, const RelativisticQuantities& rq) {
+  const float eps = c.epsilonScale() * rq.q2OverBeta2;
+  const float dhalf = computeDeltaHalf(c, rq);
+  const float u = computeMassTerm(Me, rq);
+  const float wmax = computeWMax(m, rq);
+  // same as the slab version with log(u/I) + log(wmax/I) combined into a
+  // single logarithm
+  const float running = std::log(u * wmax) -
+                        2.0f * c.logMeanExcitationEnergy() - 2.0f * rq.beta2 -
+                        2.0f * dhalf;
+  return eps * running;
+}
+
 }  // namespace
 
+Acts::MaterialInteractionConstants::MaterialInteractionConstants(
+    const MaterialSlab& slab)
+    : m_thickness(slab.thickness()),
+      m_thicknessInX0(slab.thicknessInX0()),
+      m_thicknessInL0(slab.thicknessInL0()),
+      m_vacuumMaterial(slab.material().isVacuum()) {
+  if (m_vacuumMaterial) {
+    return;
+  }
+  const float I = slab.material().meanExcitationEnergy();
+  const float Ne = slab.material().molarElectronDensity();
+  // see computeEpsilon and computeDeltaHalf
+  m_epsilonScale = 0.5f * K * Ne * m_thickness;
+  m_logMeanExcitationEnergy = std::log(I);
+  const float plasmaEnergy =
+      PlasmaEnergyScale * std::sqrt(Ne / static_cast<float>(1 / 1_cm3));
+  m_deltaHalfOffset = std::log(plasmaEnergy / I) - 0.5f;
+}
+
+void Acts::MaterialInteractionConstants::scaleThickness(float scale) {
+  if (scale < 0) {
+    throw std::runtime_error("scale < 0");
+  }
+
+  m_thickness *= scale;
+  m_thicknessInX0 *= scale;
+  m_thicknessInL0 *= scale;
+  m_epsilonScale *= scale;
+}
+
 float Acts::computeEnergyLossBethe(const MaterialSlab& slab, float m,
                                    float qOverP, float absQ) {
   // return early in case of vacuum or zero thickness
@@ -328,6 +383,68 @@ float Acts::computeEnergyLossLandauSigmaQOverP(const MaterialSlab& slab,
   return qOverBeta * pInv * pInv * sigmaE;
 }
 
+float Acts::computeEnergyLossBethe(
+    const MaterialInteractionConstants& constants, float m, float qOverP,
+    float absQ) {
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum()) {
+    return 0.0f;
+  }
+
+  const RelativisticQuantities rq{m, qOverP, absQ};
+  return computeBetheLoss(constants, m, rq);
+}
+
+float Acts::computeEnergyLossLandau(
+    const MaterialInteractionConstants& constants, float m, float qOverP,
+    float absQ) {
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum()) {
+    return 0.0f;
+  }
+
+  const RelativisticQuantities rq{m, qOverP, absQ};
+  const float eps = constants.epsilonScale() * rq.q2OverBeta2;
+  const float dhalf = computeDeltaHalf(constants, rq);
+  const float u = computeMassTerm(Me, rq);
+  // uses RPP2018 eq. 33.12 with log(u/I) + log(eps/I) combined
+  const float running = std::log(u * eps) -
+                        2.0f * constants.logMeanExcitationEnergy() + 0.2f -
+                        rq.beta2 - 2 * dhalf;
+  return eps * running;
+}
+
+float Acts::computeEnergyLossLandauSigma(
+    const MaterialInteractionConstants& constants, float m, float qOverP,
+    float absQ) {
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum()) {
+    return 0.0f;
+  }
+
+  const RelativisticQuantities rq{m, qOverP, absQ};
+  // the Landau-Vavilov fwhm is 4*eps (see RPP2018 fig. 33.7)
+  const float fwhm = 4 * constants.epsilonScale() * rq.q2OverBeta2;
+  return convertLandauFwhmToGaussianSigma(fwhm);
+}
+
+float Acts::computeEnergyLossLandauSigmaQOverP(
+    const MaterialInteractionConstants& constants, float m, float qOverP,
+    float absQ) {
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum()) {
+    return 0.0f;
+  }
+
+  const RelativisticQuantities rq{m, qOverP, absQ};
+  const float fwhm = 4 * constants.epsilonScale() * rq.q2OverBeta2;
+  const float sigmaE = convertLandauFwhmToGaussianSigma(fwhm);
+  // see the slab version for the conversion to q/p
+  const float pInv = qOverP / absQ;
+  const float qOverBeta = std::sqrt(rq.q2OverBeta2);
+  return qOverBeta * pInv * pInv * sigmaE;
+}
+
 namespace {
 
 /// Compute mean energy loss from bremsstrahlung per radiation length.
@@ -381,6 +498,26 @@ inline float deriveMuonDirectPairPhotoNuclearLossMeanE(double energy) {
   }
 }
 
+/// Compute the mean radiative energy loss for a thickness @p x in units of
+/// the radiation length.
+inline float computeRadiativeLoss(float x, Acts::PdgParticle absPdg, float m,
+                                  float qOverP, float absQ) {
+  // particle momentum and energy
+  // do not need to care about the sign since it is only used squared
+  const float momentum = absQ / qOverP;
+  const float energy = Acts::fastHypot(m, momentum);
+
+  float dEdx = computeBremsstrahlungLossMean(m, energy);
+
+  // muon- or muon+
+  // TODO magic number 8_GeV
+  if ((absPdg == Acts::PdgParticle::eMuon) && (energy > 8_GeV)) {
+    dEdx += computeMuonDirectPairPhotoNuclearLossMean(energy);
+  }
+  // scale from energy loss per unit radiation length to total energy
+  return dEdx * x;
+}
+
 }  // namespace
 
 float Acts::computeEnergyLossRadiative(const MaterialSlab& slab,
@@ -396,20 +533,22 @@ float Acts::computeEnergyLossRadiative(const MaterialSlab& slab,
 
   // relative radiation length
   const float x = slab.thicknessInX0();
-  // particle momentum and energy
-  // do not need to care about the sign since it is only used squared
-  const float momentum = absQ / qOverP;
-  const float energy = fastHypot(m, momentum);
+  return computeRadiativeLoss(x, absPdg, m, qOverP, absQ);
+}
 
-  float dEdx = computeBremsstrahlungLossMean(m, energy);
+float Acts::computeEnergyLossRadiative(
+    const MaterialInteractionConstants& constants, PdgParticle absPdg, float m,
+    float qOverP, float absQ) {
+  assert((absPdg == Acts::makeAbsolutePdgParticle(absPdg)) &&
+         "pdg is not absolute");
 
-  // muon- or muon+
-  // TODO magic number 8_GeV
-  if ((absPdg == PdgParticle::eMuon) && (energy > 8_GeV)) {
-    dEdx += computeMuonDirectPairPhotoNuclearLossMean(energy);
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum()) {
+    return 0.0f;
   }
-  // scale from energy loss per unit radiation length to total energy
-  return dEdx * x;
+
+  return computeRadiativeLoss(constants.thicknessInX0(), absPdg, m, qOverP,
+                              absQ);
 }
 
 float Acts::deriveEnergyLossRadiativeQOverP(const MaterialSlab& slab,
@@ -478,6 +617,35 @@ float Acts::deriveEnergyLossModeQOverP(const MaterialSlab& slab,
          0.15f * deriveEnergyLossRadiativeQOverP(slab, absPdg, m, qOverP, absQ);
 }
 
+float Acts::computeEnergyLossMean(const MaterialInteractionConstants& constants,
+                                  PdgParticle absPdg, float m, float qOverP,
+                                  float absQ) {
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum()) {
+    return 0.0f;
+  }
+
+  const RelativisticQuantities rq{m, qOverP, absQ};
+  return computeBetheLoss(constants, m, rq) +
+         computeRadiativeLoss(constants.thicknessInX0(), absPdg, m, qOverP,
+                              absQ);
+}
+
+float Acts::computeEnergyLossMode(const MaterialInteractionConstants& constants,
+                                  PdgParticle absPdg, float m, float qOverP,
+                                  float absQ) {
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum()) {
+    return 0.0f;
+  }
+
+  // see the slab version for the relative fractions
+  const RelativisticQuantities rq{m, qOverP, absQ};
+  return 0.9f * computeBetheLoss(constants, m, rq) +
+         0.15f * computeRadiativeLoss(constants.thicknessInX0(), absPdg, m,
+                                      qOverP, absQ);
+}
+
 namespace {
 
 /// Multiple scattering theta0 for minimum ionizing particles.
@@ -499,6 +667,22 @@ inline float theta0RossiGreisen(float xOverX0, float momentumInv,
          (1.0f + 0.125f * std::log10(10.0f * xOverX0));
 }
 
+/// Compute theta0 for a thickness @p xOverX0 in units of the radiation length.
+inline float computeTheta0(float xOverX0, Acts::PdgParticle absPdg, float m,
+                           float qOverP, float absQ) {
+  // 1/p = q/(pq) = (q/p)/q
+  const float momentumInv = std::abs(qOverP / absQ);
+  // q²/beta²; a smart compiler should be able to remove the unused computations
+  const float q2OverBeta2 = RelativisticQuantities(m, qOverP, absQ).q2OverBeta2;
+
+  // electron or positron
+  if (absPdg == Acts::PdgParticle::eElectron) {
+    return theta0RossiGreisen(xOverX0, momentumInv, q2OverBeta2);
+  } else {
+    return theta0Highland(xOverX0, momentumInv, q2OverBeta2);
+  }
+}
+
 }  // namespace
 
 float Acts::computeMultipleScatteringTheta0(const MaterialSlab& slab,
@@ -514,17 +698,21 @@ float Acts::computeMultipleScatteringTheta0(const MaterialSlab& slab,
 
   // relative radiation length
   const float xOverX0 = slab.thicknessInX0();
-  // 1/p = q/(pq) = (q/p)/q
-  const float momentumInv = std::abs(qOverP / absQ);
-  // q²/beta²; a smart compiler should be able to remove the unused computations
-  const float q2OverBeta2 = RelativisticQuantities(m, qOverP, absQ).q2OverBeta2;
+  return computeTheta0(xOverX0, absPdg, m, qOverP, absQ);
+}
 
-  // electron or positron
-  if (absPdg == PdgParticle::eElectron) {
-    return theta0RossiGreisen(xOverX0, momentumInv, q2OverBeta2);
-  } else {
-    return theta0Highland(xOverX0, momentumInv, q2OverBeta2);
+float Acts::computeMultipleScatteringTheta0(
+    const MaterialInteractionConstants& constants, PdgParticle absPdg, float m,
+    float qOverP, float absQ) {
+  assert((absPdg == Acts::makeAbsolutePdgParticle(absPdg)) &&
+         "pdg is not absolute");
+
+  // return early in case of vacuum or zero thickness
+  if (constants.isVacuum()) {
+    return 0.0f;
   }
+
+  return computeTheta0(constants.thicknessInX0(), absPdg, m, qOverP, absQ);
 }
 
 float Acts::approximateHighlandScattering(float xOverX0) {
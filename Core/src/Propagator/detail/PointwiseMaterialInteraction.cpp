@@ -48,24 +48,49 @@ MaterialSlab detail::evaluateMaterialSlab(const GeometryContext& geoContext,
   return slab;
 }
 
-detail::PointwiseMaterialEffects detail::computeMaterialEffects(
-    const MaterialSlab& slab, const ParticleHypothesis& particleHypothesis,
+MaterialInteractionConstants detail::evaluateMaterialConstants(
+    const GeometryContext& geoContext, const Surface& surface,
+    Direction propagationDirection, const Vector3& position,
+    const Vector3& direction, MaterialUpdateMode updateMode) {
+  const ISurfaceMaterial* material = surface.surfaceMaterial();
+  if (material == nullptr) {
+    return MaterialInteractionConstants();
+  }
+
+  MaterialInteractionConstants constants = material->interactionConstants(
+      position, propagationDirection, updateMode);
+  if (constants.isVacuum()) {
+    return constants;
+  }
+  constants.scaleThickness(
+      surface.pathCorrection(geoContext, position, direction));
+
+  return constants;
+}
+
+namespace {
+
+/// Shared implementation for material slabs and precomputed constants, which
+/// both have overloads of the interaction functions
+template <typename material_t>
+detail::PointwiseMaterialEffects computeMaterialEffectsImpl(
+    const material_t& material, const ParticleHypothesis& particleHypothesis,
     const Vector3& direction, float qOverP, bool multipleScattering,
     bool energyLoss, bool covTransport) {
-  PointwiseMaterialEffects result;
+  detail::PointwiseMaterialEffects result;
 
   const double mass = particleHypothesis.mass();
   const PdgParticle absPdg = particleHypothesis.absolutePdg();
   const double absQ = particleHypothesis.absoluteCharge();
 
   if (energyLoss) {
-    result.eLoss = computeEnergyLossBethe(slab, mass, qOverP, absQ);
+    result.eLoss = computeEnergyLossBethe(material, mass, qOverP, absQ);
   }
 
   if (covTransport) {
     if (multipleScattering) {
       const double theta0 =
-          computeMultipleScatteringTheta0(slab, absPdg, mass, qOverP, absQ);
+          computeMultipleScatteringTheta0(material, absPdg, mass, qOverP, absQ);
       // sigmaPhi = theta0 / sin(theta)
       const double sigmaPhi =
           theta0 * (direction.norm() / VectorHelpers::perp(direction));
@@ -75,7 +100,7 @@ detail::PointwiseMaterialEffects detail::computeMaterialEffects(
     }
     if (energyLoss) {
       const double sigmaQoverP =
-          computeEnergyLossLandauSigmaQOverP(slab, mass, qOverP, absQ);
+          computeEnergyLossLandauSigmaQOverP(material, mass, qOverP, absQ);
       result.varianceQoverP = sigmaQoverP * sigmaQoverP;
     }
   }
@@ -83,4 +108,24 @@ detail::PointwiseMaterialEffects detail::computeMaterialEffects(
   return result;
 }
 
+}  // namespace
+
+detail::PointwiseMaterialEffects detail::computeMaterialEffects(
+    const MaterialSlab& slab, const ParticleHypothesis& particleHypothesis,
+    const Vector3& direction, float qOverP, bool multipleScattering,
+    bool energyLoss, bool covTransport) {
+  return computeMaterialEffectsImpl(slab, particleHypothesis, direction,
+                                    qOverP, multipleScattering, energyLoss,
+                                    covTransport);
+}
+
+detail::PointwiseMaterialEffects detail::computeMaterialEffects(
+    const MaterialInteractionConstants& constants,
+    const ParticleHypothesis& particleHypothesis, const Vector3& direction,
+    float qOverP, bool multipleScattering, bool energyLoss, bool covTransport) {
+  return computeMaterialEffectsImpl(constants, particleHypothesis, direction,
+                                    qOverP, multipleScattering, energyLoss,
+                                    covTransport);
+}
+
 }  // namespace Acts
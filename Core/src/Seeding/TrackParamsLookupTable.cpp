@@ -0,0 +1,219 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Seeding/TrackParamsLookupTable.hpp"
+
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+
+namespace Acts {
+
+namespace {
+
+constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                         'T', 'P', 'L', 'T'};
+constexpr std::uint32_t s_version = 1;
+// upper bound on the bins of one grid accepted from a binary stream, which
+// protects against huge allocations when reading corrupt input
+constexpr std::uint64_t s_maxBinsPerGrid = std::uint64_t{1} << 24;
+
+template <typename T>
+void writeValue(std::ostream& os, const T& value) {
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T readValue(std::istream& is) {
+  T value{};
+  is.read(reinterpret_cast<char*>(&value), sizeof(T));
+  if (!is) {
+    throw std::runtime_error(
+        "TrackParamsLookupTable: unexpected end of binary stream");
+  }
+  return value;
+}
+
+}  // namespace
+
+void TrackParamsLookupTable::addGrid(GeometryIdentifier geoId,
+                                     SurfaceGrid grid) {
+  for (std::size_t d = 0; d < 2; ++d) {
+    if (grid.nBins[d] == 0 || !(grid.min[d] < grid.max[d])) {
+      throw std::invalid_argument(
+          "TrackParamsLookupTable: invalid axis definition");
+    }
+  }
+  if (grid.bins.size() != grid.nBins[0] * grid.nBins[1]) {
+    throw std::invalid_argument(
+        "TrackParamsLookupTable: number of bins does not match the axes");
+  }
+  m_grids.insert_or_assign(geoId, std::move(grid));
+}
+
+const TrackParamsLookupTable::SurfaceGrid* TrackParamsLookupTable::grid(
+    GeometryIdentifier geoId) const {
+  auto it = m_grids.find(geoId);
+  return it != m_grids.end() ? &it->second : nullptr;
+}
+
+std::optional<std::pair<Vector3, double>> TrackParamsLookupTable::interpolate(
+    GeometryIdentifier geoId, const Vector2& localPosition) const {
+  const SurfaceGrid* surfaceGrid = grid(geoId);
+  if (surfaceGrid == nullptr) {
+    return std::nullopt;
+  }
+
+  // Find the bin centres enclosing the position on both axes
+  std::array<std::size_t, 2> lower{};
+  std::array<std::size_t, 2> upper{};
+  std::array<float, 2> fraction{};
+  for (std::size_t d = 0; d < 2; ++d) {
+    if (localPosition[d] < surfaceGrid->min[d] ||
+        localPosition[d] > surfaceGrid->max[d]) {
+      return std::nullopt;
+    }
+    const auto nBins = static_cast<double>(surfaceGrid->nBins[d]);
+    const double width = (surfaceGrid->max[d] - surfaceGrid->min[d]) / nBins;
+    const double u =
+        std::clamp((localPosition[d] - surfaceGrid->min[d]) / width - 0.5, 0.,
+                   nBins - 1.);
+    lower[d] = static_cast<std::size_t>(u);
+    upper[d] = std::min(lower[d] + 1, surfaceGrid->nBins[d] - 1);
+    fraction[d] = static_cast<float>(u - static_cast<double>(lower[d]));
+  }
+
+  // Weighted sum of the four neighbouring bins, all four components of the
+  // bin content are processed at once
+  BinContent sum = BinContent::Zero();
+  float weightSum = 0.f;
+  const auto accumulate = [&](std::size_t i0, std::size_t i1, float weight) {
+    const BinContent& content = surfaceGrid->at(i0, i1);
+    if (weight <= 0.f || content.head<3>().isZero(0.f)) {
+      return;
+    }
+    sum += weight * content;
+    weightSum += weight;
+  };
+  accumulate(lower[0], lower[1], (1.f - fraction[0]) * (1.f - fraction[1]));
+  accumulate(upper[0], lower[1], fraction[0] * (1.f - fraction[1]));
+  accumulate(lower[0], upper[1], (1.f - fraction[0]) * fraction[1]);
+  accumulate(upper[0], upper[1], fraction[0] * fraction[1]);
+
+  if (weightSum <= 0.f) {
+    return std::nullopt;
+  }
+  sum /= weightSum;
+
+  Vector3 direction = sum.head<3>().cast<double>().matrix();
+  const double norm = direction.norm();
+  if (norm == 0.) {
+    return std::nullopt;
+  }
+  direction /= norm;
+  return std::pair{direction, static_cast<double>(sum[3])};
+}
+
+std::optional<FreeVector> TrackParamsLookupTable::estimate(
+    const GeometryContext& gctx, const Surface& surface, const Vector3& sp0,
+    double t0) const {
+  // The space point is associated to the surface by construction, it might
+  // however be displaced from it, e.g. for strip space points
+  auto localPosition = surface.globalToLocal(
+      gctx, sp0, sp0.normalized(), std::numeric_limits<double>::max());
+  if (!localPosition.ok()) {
+    return std::nullopt;
+  }
+
+  auto interpolated = interpolate(surface.geometryId(), *localPosition);
+  if (!interpolated.has_value()) {
+    return std::nullopt;
+  }
+
+  FreeVector params = FreeVector::Zero();
+  params.segment<3>(eFreePos0) = sp0;
+  params[eFreeTime] = t0;
+  params.segment<3>(eFreeDir0) = interpolated->first;
+  params[eFreeQOverP] = interpolated->second;
+  return params;
+}
+
+void TrackParamsLookupTable::toBinaryStream(std::ostream& os) const {
+  os.write(s_magic.data(), s_magic.size());
+  writeValue(os, s_version);
+  writeValue(os, static_cast<std::uint64_t>(m_grids.size()));
+  for (const auto& [geoId, surfaceGrid] : m_grids) {
+    writeValue(os, geoId.value());
+    for (std::size_t d = 0; d < 2; ++d) {
+      writeValue(os, surfaceGrid.min[d]);
+      writeValue(os, surfaceGrid.max[d]);
+      writeValue(os, static_cast<std::uint64_t>(surfaceGrid.nBins[d]));
+    }
+    os.write(reinterpret_cast<const char*>(surfaceGrid.bins.data()),
+             static_cast<std::streamsize>(surfaceGrid.bins.size() *
+                                          sizeof(BinContent)));
+  }
+  if (!os) {
+    throw std::runtime_error(
+        "TrackParamsLookupTable: failed to write binary stream");
+  }
+}
+
+TrackParamsLookupTable TrackParamsLookupTable::fromBinaryStream(
+    std::istream& is) {
+  std::array<char, 8> magic{};
+  is.read(magic.data(), magic.size());
+  if (!is || magic != s_magic) {
+    throw std::runtime_error(
+        "TrackParamsLookupTable: stream is not a track parameter lookup");
+  }
+  if (readValue<std::uint32_t>(is) != s_version) {
+    throw std::runtime_error(
+        "TrackParamsLookupTable: unsupported binary format version");
+  }
+
+  TrackParamsLookupTable table;
+  const auto nGrids = readValue<std::uint64_t>(is);
+  for (std::uint64_t iGrid = 0; iGrid < nGrids; ++iGrid) {
+    GeometryIdentifier geoId{readValue<GeometryIdentifier::Value>(is)};
+    SurfaceGrid surfaceGrid;
+    std::uint64_t nBinsTotal = 1;
+    for (std::size_t d = 0; d < 2; ++d) {
+      surfaceGrid.min[d] = readValue<double>(is);
+      surfaceGrid.max[d] = readValue<double>(is);
+      const auto nBins = readValue<std::uint64_t>(is);
+      // checking each factor against the bound first avoids an overflow of
+      // the product
+      if (nBins == 0 || nBins > s_maxBinsPerGrid ||
+          nBinsTotal * nBins > s_maxBinsPerGrid) {
+        throw std::runtime_error(
+            "TrackParamsLookupTable: invalid number of bins in binary stream");
+      }
+      nBinsTotal *= nBins;
+      surfaceGrid.nBins[d] = static_cast<std::size_t>(nBins);
+    }
+    surfaceGrid.bins.resize(static_cast<std::size_t>(nBinsTotal));
+    is.read(reinterpret_cast<char*>(surfaceGrid.bins.data()),
+            static_cast<std::streamsize>(surfaceGrid.bins.size() *
+                                         sizeof(BinContent)));
+    if (!is) {
+      throw std::runtime_error(
+          "TrackParamsLookupTable: unexpected end of binary stream");
+    }
+    table.addGrid(geoId, std::move(surfaceGrid));
+  }
+  return table;
+}
+
+}  // namespace Acts
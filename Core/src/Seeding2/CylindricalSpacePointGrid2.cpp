@@ -10,6 +10,10 @@
 
 #include "Acts/Utilities/MathHelpers.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
 namespace Acts {
 
 CylindricalSpacePointGrid2::CylindricalSpacePointGrid2(
@@ -205,6 +209,90 @@ void CylindricalSpacePointGrid2::sortBinsByR(
       "Number of space points inserted (within grid range): " << m_counter);
 }
 
+void CylindricalSpacePointGrid2::fillContiguous(std::span<const float> phi,
+                                                std::span<const float> z,
+                                                std::span<const float> r,
+                                                ContiguousBins& bins) const {
+  if (phi.size() != z.size() || phi.size() != r.size()) {
+    throw std::invalid_argument(
+        "CylindricalSpacePointGrid2: coordinate spans differ in size");
+  }
+
+  constexpr auto kOutside = std::numeric_limits<std::uint32_t>::max();
+  const std::size_t nBins = numberOfBins();
+
+  // count the space points per bin, the counts are kept in the range ends
+  bins.spacePointBins.resize(phi.size());
+  bins.binRanges.assign(nBins, {0, 0});
+  for (std::size_t i = 0; i < phi.size(); ++i) {
+    const std::optional<std::size_t> bin = binIndex(phi[i], z[i], r[i]);
+    if (!bin.has_value()) {
+      bins.spacePointBins[i] = kOutside;
+      continue;
+    }
+    bins.spacePointBins[i] = static_cast<std::uint32_t>(*bin);
+    ++bins.binRanges[*bin].second;
+  }
+
+  // turn the counts into ranges, the range end is used as insertion cursor
+  SpacePointIndex offset = 0;
+  for (SpacePointIndexRange2& range : bins.binRanges) {
+    const SpacePointIndex count = range.second;
+    range = {offset, offset};
+    offset += count;
+  }
+
+  bins.spacePoints.resize(offset);
+  for (std::size_t i = 0; i < phi.size(); ++i) {
+    if (bins.spacePointBins[i] == kOutside) {
+      continue;
+    }
+    SpacePointIndexRange2& range = bins.binRanges[bins.spacePointBins[i]];
+    bins.spacePoints[range.second++] = static_cast<SpacePointIndex>(i);
+  }
+
+  // space points with the same radius are kept in index order
+  for (const SpacePointIndexRange2& range : bins.binRanges) {
+    std::sort(bins.spacePoints.begin() + range.first,
+              bins.spacePoints.begin() + range.second,
+              [&](SpacePointIndex a, SpacePointIndex b) {
+                return r[a] < r[b] || (r[a] == r[b] && a < b);
+              });
+  }
+
+  // precompute the groups, visiting the bins in the binned group order
+  const BinnedGroupType& group = binnedGroup();
+  const auto& navigation = group.navigation();
+  bins.middleBins.clear();
+  bins.neighbourBins.clear();
+  bins.neighbourOffsets.assign(1, 0);
+  const auto addNeighbours = [&](const auto& neighbours) {
+    bins.neighbourBins.insert(bins.neighbourBins.end(), neighbours.begin(),
+                              neighbours.end());
+    bins.neighbourOffsets.push_back(
+        static_cast<std::uint32_t>(bins.neighbourBins.size()));
+  };
+  for (std::size_t phiBin : navigation[0]) {
+    for (std::size_t zBin : navigation[1]) {
+      for (std::size_t rBin : navigation[2]) {
+        const std::array<std::size_t, 3> localBins = {phiBin, zBin, rBin};
+        const std::size_t middle = grid().globalBinFromLocalBins(localBins);
+        const SpacePointIndexRange2& range = bins.binRanges[middle];
+        if (range.first == range.second || !group.mask().at(middle)) {
+          continue;
+        }
+        bins.middleBins.push_back(static_cast<std::uint32_t>(middle));
+        addNeighbours(m_cfg.bottomBinFinder->findBins(localBins, grid()));
+        addNeighbours(m_cfg.topBinFinder->findBins(localBins, grid()));
+      }
+    }
+  }
+
+  ACTS_VERBOSE("Number of space points sorted into contiguous bins: "
+               << bins.spacePoints.size() << " in "
+               << bins.numberOfGroups() << " groups");
+}
+
 Range1D<float> CylindricalSpacePointGrid2::computeRadiusRange(
     const SpacePointContainer2& spacePoints) const {
   float minRange = std::numeric_limits<float>::max();
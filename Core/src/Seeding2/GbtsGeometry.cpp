@@ -466,10 +466,14 @@ GbtsGeometry::GbtsGeometry(
   // 3. Refill binGroups with staged bin pair collections.
 
   m_binGroups.clear();
+  m_binGroupStages.clear();
 
   // number of stages:
   const std::size_t nStages = stageOffsets.size() - 1;
 
+  m_binGroupStages.reserve(nStages + 1);
+  m_binGroupStages.push_back(0);
+
   // reverse order filling
   for (std::size_t stageIndex = nStages; stageIndex-- > 0;) {
     const std::size_t begin = stageOffsets[stageIndex];
@@ -489,6 +493,8 @@ GbtsGeometry::GbtsGeometry(
       // store the group
       m_binGroups.emplace_back(bin1Idx, std::vector<std::uint32_t>(bin2List));
     }
+
+    m_binGroupStages.push_back(m_binGroups.size());
   }
 }
 
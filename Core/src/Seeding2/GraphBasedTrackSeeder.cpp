@@ -10,6 +10,7 @@
 
 #include "Acts/Seeding2/GbtsTrackingFilter.hpp"
 #include "Acts/Utilities/MathHelpers.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -22,6 +23,42 @@
 
 namespace Acts::Experimental {
 
+namespace {
+
+/// Edges created for the nodes of a single bin1 together with their
+/// connections to edges of previous stages
+struct GbtsEdgeBlock {
+  void clear() {
+    edges.clear();
+    firstEdge.clear();
+    numEdges.clear();
+    connInEdge.clear();
+    connOutEdge.clear();
+    connNode.clear();
+    connZ0Bin.clear();
+  }
+
+  /// new edges, local to the block
+  std::vector<GbtsEdge> edges;
+  /// the local index of the first incoming edge per bin1 node
+  std::vector<std::uint32_t> firstEdge;
+  /// the number of incoming edges per bin1 node
+  std::vector<std::uint16_t> numEdges;
+
+  // connections stored as separate arrays
+
+  /// global index of the edge from a previous stage
+  std::vector<std::uint32_t> connInEdge;
+  /// local index of the new edge
+  std::vector<std::uint32_t> connOutEdge;
+  /// bin1 node of the new edge
+  std::vector<std::uint32_t> connNode;
+  /// z0 histogram bin of the new edge
+  std::vector<std::uint8_t> connZ0Bin;
+};
+
+}  // namespace
+
 GraphBasedTrackSeeder::DerivedConfig::DerivedConfig(const Config& config)
     : Config(config) {
   phiSliceWidth = 2 * std::numbers::pi_v<float> / config.nMaxPhiSlice;
@@ -250,12 +287,18 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
   const std::uint32_t zBins = 16;
   const float z0HistoCoeff = zBins / (maxZ0 - minZ0 + 1e-6);
 
-  // loop over bin groups
-  for (const auto& bg : m_geometry->binGroups()) {
-    GbtsEtaBin& B1 = nodeStorage.getEtaBin(bg.first);
+  const auto& binGroups = m_geometry->binGroups();
+
+  // creates the edges incoming to the nodes of one bin1 in a separate block.
+  // Only edges of previous stages are read, connections to them are recorded
+  // and applied once all groups of the stage are done.
+  auto buildGroupEdges = [&](std::size_t groupIdx, std::uint32_t maxBlockEdges,
+                             GbtsEdgeBlock& block) {
+    const auto& bg = binGroups[groupIdx];
+    const GbtsEtaBin& B1 = nodeStorage.getEtaBin(bg.first);
 
     if (B1.empty()) {
-      continue;
+      return;
     }
 
     const float rb1 = B1.minRadius;
@@ -306,18 +349,17 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
       ++winIdx;
     }
 
+    block.firstEdge.resize(B1.vn.size());
+    block.numEdges.resize(B1.vn.size());
+
     // in GBTSv3 the outer loop goes over n1 nodes in the Layer 1 bin
     for (std::uint32_t n1Idx = 0; n1Idx < B1.vn.size(); ++n1Idx) {
-      // initialization using the top watermark of the edge storage
-      B1.vFirstEdge[n1Idx] = nEdges;
+      // initialization using the top watermark of the edge block
+      block.firstEdge[n1Idx] = block.edges.size();
 
       // the counter for the incoming graph edges created for n1
       std::uint16_t numCreatedEdges = 0;
 
-      bool isConnected = false;
-
-      std::array<std::uint8_t, 16> z0Histo = {};
-
       const std::array<float, 5>& n1pars = B1.params[n1Idx];
 
       const float phi1 = n1pars[2];
@@ -469,13 +511,13 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
           const float dPhi2 = curv * r2;
           const float dPhi1 = curv * r1;
 
-          if (nEdges < m_cfg.nMaxEdges) {
-            edgeStorage.emplace_back(B1.vn[n1Idx], B2.vn[n2Idx], expEta, curv,
+          if (block.edges.size() < maxBlockEdges) {
+            block.edges.emplace_back(B1.vn[n1Idx], B2.vn[n2Idx], expEta, curv,
                                      phi1 + dPhi1);
 
             ++numCreatedEdges;
 
-            const std::uint32_t outEdgeIdx = nEdges;
+            const std::uint32_t outEdgeIdx = block.edges.size() - 1;
 
             const float uat2 = 1.f / expEta;
             const float phi2u = phi2 + dPhi2;
@@ -484,18 +526,18 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
             // looking for neighbours of the new edge
             for (std::uint32_t inEdgeIdx = n2FirstEdge; inEdgeIdx < n2LastEdge;
                  ++inEdgeIdx) {
-              GbtsEdge* pS = &(edgeStorage.at(inEdgeIdx));
+              const GbtsEdge& S = edgeStorage.at(inEdgeIdx);
 
-              if (pS->nNei >= gbtsNumSegConns) {
+              // already full before this stage
+              if (S.nNei >= gbtsNumSegConns) {
                 continue;
               }
 
-              const std::uint32_t lk3 =
-                  m_geometry->layerIdByIndex(pS->n2->layer);
+              const std::uint32_t lk3 = m_geometry->layerIdByIndex(S.n2->layer);
 
               const bool isBarrel3 = (lk3 / 10000) == 8;
 
-              const float absTauRatio = std::abs(pS->p[0] * uat2 - 1.0f);
+              const float absTauRatio = std::abs(S.p[0] * uat2 - 1.0f);
               float addTauRatioCorr = 0;
 
               if (m_cfg.useAdaptiveCuts) {
@@ -519,7 +561,7 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
                 continue;
               }
 
-              float dPhi = phi2u - pS->p[2];
+              float dPhi = phi2u - S.p[2];
 
               if (dPhi < -std::numbers::pi_v<float>) {
                 dPhi += 2 * std::numbers::pi_v<float>;
@@ -531,7 +573,7 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
                 continue;
               }
 
-              const float dcurv = curv2 - pS->p[1];
+              const float dcurv = curv2 - S.p[1];
 
               if (dcurv < -cutDCurvMax || dcurv > cutDCurvMax) {
                 continue;
@@ -542,7 +584,7 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
                 // Pixel barrel
                 if (isBarrel1 && isBarrel2 && isBarrel3) {
                   const std::array<const GbtsNode*, 3> candidateTriplet = {
-                      B1.vn[n1Idx], B2.vn[n2Idx], pS->n2};
+                      B1.vn[n1Idx], B2.vn[n2Idx], S.n2};
 
                   if (!validateTriplet(candidateTriplet, tripletPtMin,
                                        absTauRatio, cutTauRatioMax, options)) {
@@ -551,45 +593,103 @@ std::pair<std::int32_t, std::int32_t> GraphBasedTrackSeeder::buildTheGraph(
                 }
               }
 
-              pS->vNei[pS->nNei] = outEdgeIdx;
-              ++pS->nNei;
-
-              isConnected = true;  // there is at least one good match
-
-              // edge confirmed - update z0 histogram
-
-              const std::uint32_t z0BinIndex =
-                  static_cast<std::uint32_t>(z0HistoCoeff * (z0 - minZ0));
-
-              ++z0Histo[z0BinIndex];
-
-              nConnections++;
+              // good match, the z0 histogram is updated when the connection
+              // is applied
+              block.connInEdge.push_back(inEdgeIdx);
+              block.connOutEdge.push_back(outEdgeIdx);
+              block.connNode.push_back(n1Idx);
+              block.connZ0Bin.push_back(static_cast<std::uint8_t>(
+                  z0HistoCoeff * (z0 - minZ0)));
             }
-            nEdges++;
           }
         }  // loop over n2 (outer) nodes inside a sliding window on n2 bin
       }  // loop over sliding windows associated with n2 bins
 
-      // updating the n1 node attributes
+      block.numEdges[n1Idx] = numCreatedEdges;
+    }  // loop over n1 (inner) nodes
+  };
 
-      B1.vNumEdges[n1Idx] = numCreatedEdges;
-      if (isConnected) {
-        std::uint16_t z0BitMask = 0x0;
+  // append the edges of a block to the edge storage and connect them to the
+  // edges of previous stages
+  auto stitchGroupEdges = [&](std::size_t groupIdx,
+                              const GbtsEdgeBlock& block) {
+    GbtsEtaBin& B1 = nodeStorage.getEtaBin(binGroups[groupIdx].first);
 
-        for (std::uint32_t bIdx = 0; bIdx < 16; ++bIdx) {
-          if (z0Histo[bIdx] == 0) {
-            continue;
-          }
+    if (B1.empty()) {
+      return;
+    }
 
-          z0BitMask |= (1 << bIdx);
-        }
+    // edges beyond the limit would not have been created by a serial build
+    const std::uint32_t nKept = std::min<std::uint32_t>(
+        block.edges.size(), m_cfg.nMaxEdges - nEdges);
 
-        // non-zero mask indicates that there is at least one connected edge
-        B1.vIsConnected[n1Idx] = z0BitMask;
+    for (std::uint32_t n1Idx = 0; n1Idx < B1.vn.size(); ++n1Idx) {
+      const std::uint32_t first = std::min(block.firstEdge[n1Idx], nKept);
+      const std::uint32_t last =
+          std::min<std::uint32_t>(first + block.numEdges[n1Idx], nKept);
+      B1.vFirstEdge[n1Idx] = nEdges + first;
+      B1.vNumEdges[n1Idx] = last - first;
+    }
+
+    edgeStorage.insert(edgeStorage.end(), block.edges.begin(),
+                       block.edges.begin() + nKept);
+
+    // connections in the order of a serial build, which matters once the
+    // incoming edge runs out of neighbour slots
+    for (std::size_t c = 0; c < block.connInEdge.size(); ++c) {
+      if (block.connOutEdge[c] >= nKept) {
+        continue;
       }
 
-    }  // loop over n1 (inner) nodes
-  }  // loop over bin groups: a single n1 bin and multiple n2 bins
+      GbtsEdge& S = edgeStorage[block.connInEdge[c]];
+
+      if (S.nNei >= gbtsNumSegConns) {
+        continue;
+      }
+
+      S.vNei[S.nNei] = nEdges + block.connOutEdge[c];
+      ++S.nNei;
+
+      // non-zero mask indicates that there is at least one connected edge
+      B1.vIsConnected[block.connNode[c]] |=
+          static_cast<std::uint16_t>(1u << block.connZ0Bin[c]);
+
+      nConnections++;
+    }
+
+    nEdges += nKept;
+  };
+
+  // edge blocks are reused by the stages of the event
+  std::vector<GbtsEdgeBlock> blocks;
+
+  // loop over stages of bin groups; the groups of one stage are independent
+  const auto& stages = m_geometry->binGroupStages();
+  for (std::size_t stage = 0; stage + 1 < stages.size(); ++stage) {
+    const std::size_t groupBegin = stages[stage];
+    const std::size_t nGroups = stages[stage + 1] - groupBegin;
+
+    if (blocks.size() < nGroups) {
+      blocks.resize(nGroups);
+    }
+    for (std::size_t g = 0; g < nGroups; ++g) {
+      blocks[g].clear();
+    }
+
+    const std::uint32_t maxBlockEdges = m_cfg.nMaxEdges - nEdges;
+
+    parallelFor(m_cfg.executor.get(), nGroups,
+                [&](std::size_t /*chunk*/, std::size_t begin, std::size_t end) {
+                  for (std::size_t g = begin; g < end; ++g) {
+                    buildGroupEdges(groupBegin + g, maxBlockEdges, blocks[g]);
+                  }
+                });
+
+    // stitch the blocks in group order
+    for (std::size_t g = 0; g < nGroups; ++g) {
+      stitchGroupEdges(groupBegin + g, blocks[g]);
+    }
+  }
 
   if (nEdges >= m_cfg.nMaxEdges) {
     ACTS_WARNING(
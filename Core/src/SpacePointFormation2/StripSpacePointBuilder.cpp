@@ -11,9 +11,17 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/SpacePointFormation2/PixelSpacePointBuilder.hpp"
 #include "Acts/SpacePointFormation2/SpacePointFormationError.hpp"
+#include "Acts/Surfaces/PlanarBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/MathHelpers.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+
 namespace Acts {
 
 Result<double> StripSpacePointBuilder::computeClusterPairDistance(
@@ -311,4 +319,202 @@ Vector2 StripSpacePointBuilder::computeVarianceZR(const GeometryContext& gctx,
                                                    localCov);
 }
 
+namespace {
+
+StripSpacePointBuilder::StripModuleGeometry computeModuleGeometry(
+    const GeometryContext& gctx, const Surface& surface) {
+  const auto* bounds = dynamic_cast<const PlanarBounds*>(&surface.bounds());
+  if (bounds == nullptr) {
+    throw std::invalid_argument(
+        "StripSpacePointBuilder: Encountered non-planar surface");
+  }
+  const RectangleBounds& boundingBox = bounds->boundingBox();
+
+  StripSpacePointBuilder::StripModuleGeometry module;
+  module.top = surface.localToGlobal(
+      gctx, Vector2(0, boundingBox.get(RectangleBounds::eMaxY)),
+      Vector3::Zero());
+  module.bottom = surface.localToGlobal(
+      gctx, Vector2(0, boundingBox.get(RectangleBounds::eMinY)),
+      Vector3::Zero());
+  module.localAxis = surface.localToGlobalTransform(gctx).linear().col(0);
+  // using invalid direction vector, as it is usually not needed by the surface
+  module.rotation = surface
+                        .referenceFrame(gctx, surface.center(gctx),
+                                        Vector3::Zero())
+                        .topLeftCorner<3, 2>();
+  return module;
+}
+
+}  // namespace
+
+StripSpacePointBuilder::StripModulePairGeometry
+StripSpacePointBuilder::computeModulePairGeometry(const GeometryContext& gctx,
+                                                  const Surface& surface1,
+                                                  const Surface& surface2) {
+  StripModulePairGeometry geometry;
+  geometry.first = computeModuleGeometry(gctx, surface1);
+  geometry.second = computeModuleGeometry(gctx, surface2);
+
+  const Vector3 btmToTop1 = geometry.first.top - geometry.first.bottom;
+  const Vector3 btmToTop2 = geometry.second.top - geometry.second.bottom;
+  geometry.stereoAngle = std::acos(btmToTop1.dot(btmToTop2) /
+                                   (btmToTop1.norm() * btmToTop2.norm()));
+  return geometry;
+}
+
+void StripSpacePointBuilder::computeModulePairSpacePoints(
+    const StripModulePairGeometry& geometry,
+    std::span<const StripCluster> clusters1,
+    std::span<const StripCluster> clusters2,
+    const ClusterPairingOptions& pairingOptions,
+    const ConstrainedOptions& options,
+    std::vector<StripPairSpacePoint>& spacePoints) {
+  const StripModuleGeometry& first = geometry.first;
+  const StripModuleGeometry& second = geometry.second;
+  const Vector3 mid1 = 0.5 * (first.top + first.bottom);
+  const Vector3 mid2 = 0.5 * (second.top + second.bottom);
+
+  // Sort the clusters of the second module in phi of their strip centre, so
+  // only the ones within the phi window have to be tested
+  std::vector<double> phi2(clusters2.size());
+  std::vector<std::uint32_t> order2(clusters2.size());
+  for (std::size_t i = 0; i < clusters2.size(); ++i) {
+    phi2[i] = VectorHelpers::phi(mid2 + clusters2[i].loc0 * second.localAxis -
+                                 pairingOptions.vertex);
+  }
+  std::iota(order2.begin(), order2.end(), 0u);
+  std::ranges::sort(order2, [&](std::uint32_t a, std::uint32_t b) {
+    return phi2[a] < phi2[b];
+  });
+  std::vector<double> sortedPhi2(clusters2.size());
+  for (std::size_t i = 0; i < order2.size(); ++i) {
+    sortedPhi2[i] = phi2[order2[i]];
+  }
+  // widen the window a bit, the exact cut is applied on the pair distance
+  const double phiWindow = pairingOptions.maxAnglePhi + 1e-9;
+
+  std::vector<std::uint32_t> pairs1;
+  std::vector<std::uint32_t> pairs2;
+  for (std::size_t i1 = 0; i1 < clusters1.size(); ++i1) {
+    const Vector3 centre1 = mid1 + clusters1[i1].loc0 * first.localAxis;
+    const double phi1 = VectorHelpers::phi(centre1 - pairingOptions.vertex);
+
+    std::optional<double> minDistance;
+    std::uint32_t best2 = 0;
+    auto begin = std::ranges::lower_bound(sortedPhi2, phi1 - phiWindow);
+    for (auto it = begin;
+         it != sortedPhi2.end() && *it <= phi1 + phiWindow; ++it) {
+      const std::uint32_t i2 = order2[it - sortedPhi2.begin()];
+      const Vector3 centre2 = mid2 + clusters2[i2].loc0 * second.localAxis;
+      const Result<double> distance =
+          computeClusterPairDistance(centre1, centre2, pairingOptions);
+      // ties go to the first cluster in input order
+      if (distance.ok() &&
+          (!minDistance.has_value() || *distance < *minDistance ||
+           (*distance == *minDistance && i2 < best2))) {
+        minDistance = *distance;
+        best2 = i2;
+      }
+    }
+    if (minDistance.has_value()) {
+      pairs1.push_back(static_cast<std::uint32_t>(i1));
+      pairs2.push_back(best2);
+    }
+  }
+
+  // The strip vectors are the same for all pairs, while the vertex to strip
+  // centre vectors and their cross products are linear in the local
+  // coordinates. See computeConstrainedFormationState for the derivation.
+  const Vector3 q = first.top - first.bottom;
+  const Vector3 r = second.top - second.bottom;
+  const Vector3 s1 = first.top + first.bottom - 2 * options.vertex;
+  const Vector3 ds1 = 2 * first.localAxis;
+  const Vector3 s2 = second.top + second.bottom - 2 * options.vertex;
+  const Vector3 ds2 = 2 * second.localAxis;
+  const Vector3 c1 = q.cross(s1);
+  const Vector3 dc1 = q.cross(ds1);
+  const Vector3 c2 = r.cross(s2);
+  const Vector3 dc2 = r.cross(ds2);
+
+  // Branch free loop over all pairs, which the compiler can vectorise
+  const std::size_t nPairs = pairs1.size();
+  std::vector<double> m(nPairs);
+  std::vector<double> n(nPairs);
+  for (std::size_t i = 0; i < nPairs; ++i) {
+    const double l1 = clusters1[pairs1[i]].loc0;
+    const double l2 = clusters2[pairs2[i]].loc0;
+
+    const double s1x = s1.x() + l1 * ds1.x();
+    const double s1y = s1.y() + l1 * ds1.y();
+    const double s1z = s1.z() + l1 * ds1.z();
+    const double s2x = s2.x() + l2 * ds2.x();
+    const double s2y = s2.y() + l2 * ds2.y();
+    const double s2z = s2.z() + l2 * ds2.z();
+    const double c1x = c1.x() + l1 * dc1.x();
+    const double c1y = c1.y() + l1 * dc1.y();
+    const double c1z = c1.z() + l1 * dc1.z();
+    const double c2x = c2.x() + l2 * dc2.x();
+    const double c2y = c2.y() + l2 * dc2.y();
+    const double c2z = c2.z() + l2 * dc2.z();
+
+    m[i] = -(s1x * c2x + s1y * c2y + s1z * c2z) /
+           (q.x() * c2x + q.y() * c2y + q.z() * c2z);
+    n[i] = -(s2x * c1x + s2y * c1y + s2z * c1z) /
+           (r.x() * c1x + r.y() * c1y + r.z() * c1z);
+  }
+
+  // Variance terms that only depend on the stereo angle
+  const double sinThetaHalf = std::sin(0.5 * geometry.stereoAngle);
+  const double cosThetaHalf = std::cos(0.5 * geometry.stereoAngle);
+
+  const double limit = 1 + options.stripLengthTolerance;
+  spacePoints.reserve(spacePoints.size() + nPairs);
+  for (std::size_t i = 0; i < nPairs; ++i) {
+    const StripCluster& cluster1 = clusters1[pairs1[i]];
+    const StripCluster& cluster2 = clusters2[pairs2[i]];
+
+    double mi = m[i];
+    if (std::abs(m[i]) > limit || std::abs(n[i]) > limit) {
+      FormationState state;
+      state.firstBtmToTop = q;
+      state.secondBtmToTop = r;
+      state.vtxToFirstMid2 = s1 + cluster1.loc0 * ds1;
+      state.vtxToSecondMid2 = s2 + cluster2.loc0 * ds2;
+      state.firstBtmToTopXvtxToFirstMid2 = c1 + cluster1.loc0 * dc1;
+      state.secondBtmToTopXvtxToSecondMid2 = c2 + cluster2.loc0 * dc2;
+      state.m = m[i];
+      state.n = n[i];
+      state.limit = limit;
+      if (!recoverConstrainedFormationState(state,
+                                            options.stripLengthGapTolerance)
+               .ok()) {
+        continue;
+      }
+      mi = state.m;
+    }
+
+    StripPairSpacePoint& sp = spacePoints.emplace_back();
+    sp.cluster1 = pairs1[i];
+    sp.cluster2 = pairs2[i];
+    sp.position = mid1 + cluster1.loc0 * first.localAxis + 0.5 * mi * q;
+
+    // same as computeVarianceZR with the cached rotation of the first module
+    const double var = fastHypot(cluster1.variance, cluster2.variance);
+    const double varX = var / (2 * sinThetaHalf);
+    const double varY = var / (2 * cosThetaHalf);
+    const double varX1 = varX * cosThetaHalf + varY * sinThetaHalf;
+    const double varY1 = varY * cosThetaHalf + varX * sinThetaHalf;
+
+    const double scale = 2 / fastHypot(sp.position.x(), sp.position.y());
+    Matrix<2, 3> jacXyzToZr = Matrix<2, 3>::Zero();
+    jacXyzToZr(0, 2) = 1;
+    jacXyzToZr(1, 0) = scale * sp.position.x();
+    jacXyzToZr(1, 1) = scale * sp.position.y();
+    const SquareMatrix2 jac = jacXyzToZr * first.rotation;
+    const SquareMatrix2 localCov = Vector2(varX1, varY1).asDiagonal();
+    sp.varianceZR = (jac * localCov * jac.transpose()).diagonal();
+  }
+}
+
 }  // namespace Acts
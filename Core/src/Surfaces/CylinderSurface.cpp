@@ -363,9 +363,7 @@ std::pair<std::shared_ptr<CylinderSurface>, bool> CylinderSurface::mergedWith(
                                   "associated with a detector element");
   }
 
-  assert(m_transform != nullptr && other.m_transform != nullptr);
-
-  Transform3 otherLocal = m_transform->inverse() * *other.m_transform;
+  Transform3 otherLocal = ownTransform().inverse() * other.ownTransform();
 
   constexpr auto tolerance = s_onSurfaceTolerance;
 
@@ -484,7 +482,7 @@ std::pair<std::shared_ptr<CylinderSurface>, bool> CylinderSurface::mergedWith(
     auto newBounds = std::make_shared<CylinderBounds>(r, newHlZ, hlPhi, avgPhi);
 
     Transform3 newTransform =
-        *m_transform * Translation3{Vector3::UnitZ() * newMidZ};
+        ownTransform() * Translation3{Vector3::UnitZ() * newMidZ};
 
     return {Surface::makeShared<CylinderSurface>(newTransform, newBounds),
             zShift < 0};
@@ -528,7 +526,7 @@ std::pair<std::shared_ptr<CylinderSurface>, bool> CylinderSurface::mergedWith(
       auto [newHlPhi, newAvgPhi, reversed] = detail::mergedPhiSector(
           hlPhi, avgPhi, otherHlPhi, otherAvgPhi, logger, tolerance);
 
-      Transform3 newTransform = *m_transform;
+      Transform3 newTransform = ownTransform();
 
       if (externalRotation) {
         ACTS_VERBOSE("Modifying transform for external rotation of "
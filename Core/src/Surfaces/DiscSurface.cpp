@@ -379,9 +379,7 @@ std::pair<std::shared_ptr<DiscSurface>, bool> DiscSurface::mergedWith(
                                   "CylinderSurface::merge: surfaces are "
                                   "associated with a detector element");
   }
-  assert(m_transform != nullptr && other.m_transform != nullptr);
-
-  Transform3 otherLocal = m_transform->inverse() * *other.m_transform;
+  Transform3 otherLocal = ownTransform().inverse() * other.ownTransform();
 
   constexpr auto tolerance = s_onSurfaceTolerance;
 
@@ -480,7 +478,7 @@ std::pair<std::shared_ptr<DiscSurface>, bool> DiscSurface::mergedWith(
     auto newBounds =
         std::make_shared<RadialBounds>(newMinR, newMaxR, hlPhi, avgPhi);
 
-    return {Surface::makeShared<DiscSurface>(*m_transform, newBounds),
+    return {Surface::makeShared<DiscSurface>(ownTransform(), newBounds),
             minR > otherMinR};
 
   } else if (direction == AxisDirection::AxisPhi) {
@@ -513,7 +511,7 @@ std::pair<std::shared_ptr<DiscSurface>, bool> DiscSurface::mergedWith(
       auto [newHlPhi, newAvgPhi, reversed] = detail::mergedPhiSector(
           hlPhi, avgPhi, otherHlPhi, otherAvgPhi, logger, tolerance);
 
-      Transform3 newTransform = *m_transform;
+      Transform3 newTransform = ownTransform();
 
       if (externalRotation) {
         ACTS_VERBOSE("Modifying transform for external rotation of "
@@ -203,9 +203,7 @@ std::pair<std::shared_ptr<PlaneSurface>, bool> PlaneSurface::mergedWith(
                                   "associated with a detector element");
   }
 
-  assert(m_transform != nullptr && other.m_transform != nullptr);
-
-  Transform3 otherLocal = m_transform->inverse() * *other.m_transform;
+  Transform3 otherLocal = ownTransform().inverse() * other.ownTransform();
 
   // TODO: Is it a good tolerance?
   constexpr auto tolerance = s_onSurfaceTolerance;
@@ -298,7 +296,8 @@ std::pair<std::shared_ptr<PlaneSurface>, bool> PlaneSurface::mergedWith(
           : std::make_shared<RectangleBounds>(thisHalfNonMerge, newHalfMerge);
 
   Vector3 unitDir = mergeX ? Vector3::UnitX() : Vector3::UnitY();
-  Transform3 newTransform = *m_transform * Translation3{unitDir * newMidMerge};
+  Transform3 newTransform =
+      ownTransform() * Translation3{unitDir * newMidMerge};
   return {Surface::makeShared<PlaneSurface>(newTransform, newBounds),
           mergeShift < 0};
 }
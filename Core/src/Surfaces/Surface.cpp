@@ -14,7 +14,9 @@
 #include "Acts/Utilities/JacobianHelpers.hpp"
 #include "Acts/Visualization/ViewConfig.hpp"
 
+#include <cassert>
 #include <iomanip>
+#include <stdexcept>
 #include <utility>
 
 namespace Acts {
@@ -165,8 +167,8 @@ bool Surface::operator==(const Surface& other) const {
     return false;
   }
   // (e) compare transform values
-  if (m_transform && other.m_transform &&
-      !m_transform->isApprox((*other.m_transform), 1e-9)) {
+  if (m_placement == nullptr && other.m_placement == nullptr &&
+      !ownTransform().isApprox(other.ownTransform(), 1e-9)) {
     return false;
   }
   // (f) compare material
@@ -221,6 +223,15 @@ const Transform3& Surface::localToGlobalTransform(
   if (m_placement != nullptr) {
     return m_placement->localToGlobalTransform(gctx);
   }
+  return ownTransform();
+}
+
+const Transform3& Surface::ownTransform() const {
+  assert(m_placement == nullptr);
+  if (m_transformStore != nullptr) {
+    return m_transformStore->transform(m_transformStoreIndex);
+  }
+  assert(m_transform != nullptr);
   return *m_transform;
 }
 
@@ -335,10 +346,36 @@ void Surface::assignSurfacePlacement(const SurfacePlacementBase& placement) {
   // resetting the transform as it will be handled through the detector element
   // now
   m_transform.reset();
+  m_transformStore.reset();
   // reset sensitivity flag
   m_isSensitive = false;
 }
 
+void Surface::assignTransformStore(
+    std::shared_ptr<const SurfaceTransformStore> store, std::size_t index) {
+  if (m_placement != nullptr) {
+    throw std::logic_error(
+        "Cannot assign a transform store to a surface associated to a "
+        "detector element.");
+  }
+  if (store == nullptr || index >= store->size()) {
+    throw std::invalid_argument(
+        "Surface::assignTransformStore() - Invalid transform store entry");
+  }
+  m_transformStore = std::move(store);
+  m_transformStoreIndex = index;
+  // the transform is now served by the store
+  m_transform.reset();
+}
+
+const SurfaceTransformStore* Surface::transformStore() const {
+  return m_transformStore.get();
+}
+
+std::size_t Surface::transformStoreIndex() const {
+  return m_transformStoreIndex;
+}
+
 void Surface::assignSurfaceMaterial(
     std::shared_ptr<const ISurfaceMaterial> material) {
   m_surfaceMaterial = std::move(material);
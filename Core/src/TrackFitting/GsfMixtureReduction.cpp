@@ -23,22 +23,24 @@ namespace {
 void reduceWithKLDistanceImpl(std::vector<GsfComponent> &cmpCache,
                               std::size_t maxCmpsAfterMerge,
                               const Surface &surface) {
-  SymmetricKLDistanceMatrix distances(cmpCache);
+  SymmetricKLDistanceQueue distances(cmpCache);
 
   auto remainingComponents = cmpCache.size();
 
   while (remainingComponents > maxCmpsAfterMerge) {
     const auto [minI, minJ] = distances.minDistancePair();
 
-    // Set one component and compute associated distances
     cmpCache[minI] =
         mergeTwoComponents(cmpCache[minI], cmpCache[minJ], surface);
-    distances.recomputeAssociatedDistances(minI, cmpCache);
 
     // Set weight of the other component to -1 so we can remove it later and
-    // mask its distances
+    // exclude its distances. This happens before the update of the merged
+    // component, so rows pointing to either of them are only rescanned once.
     cmpCache[minJ].weight = -1.0;
-    distances.maskAssociatedDistances(minJ);
+    distances.removeComponent(minJ);
+
+    // Compute the distances associated to the merged component
+    distances.updateComponent(minI, cmpCache[minI]);
 
     remainingComponents--;
   }
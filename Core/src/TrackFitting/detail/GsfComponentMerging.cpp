@@ -8,7 +8,9 @@
 
 #include "Acts/TrackFitting/detail/GsfComponentMerging.hpp"
 
+#include <cmath>
 #include <iostream>
+#include <limits>
 
 namespace Acts {
 
@@ -143,6 +145,159 @@ std::ostream &SymmetricKLDistanceMatrix::toStream(std::ostream &os) const {
   return os;
 }
 
+SymmetricKLDistanceQueue::SymmetricKLDistanceQueue(
+    std::span<const GsfComponent> cmps)
+    : m_qop(cmps.size()),
+      m_var(cmps.size()),
+      m_invVar(cmps.size()),
+      m_active(Mask::Ones(cmps.size())),
+      m_distances(cmps.size() * (cmps.size() - 1) / 2),
+      m_buffer(cmps.size()),
+      m_rowMin(cmps.size() + 1, std::numeric_limits<double>::infinity()),
+      m_rowMinIdx(cmps.size() + 1, 0),
+      m_numberComponents(cmps.size()) {
+  for (std::size_t i = 0; i < m_numberComponents; ++i) {
+    setComponent(i, cmps[i]);
+  }
+
+  // Fill the rows with one vectorised pass per component
+  for (std::size_t i = 1; i < m_numberComponents; ++i) {
+    computeDistancesTo(i);
+    m_distances.segment((i - 1) * i / 2, i) = m_buffer.head(i);
+    rescanRow(i);
+  }
+
+  // The leaves beyond the number of components point to the sentinel row
+  // m_numberComponents which has an infinite minimum
+  m_numberLeaves = 1;
+  while (m_numberLeaves < m_numberComponents) {
+    m_numberLeaves *= 2;
+  }
+  m_tree.assign(2 * m_numberLeaves, m_numberComponents);
+  for (std::size_t i = 0; i < m_numberComponents; ++i) {
+    m_tree[m_numberLeaves + i] = i;
+  }
+  for (std::size_t node = m_numberLeaves - 1; node > 0; --node) {
+    const std::size_t left = m_tree[2 * node];
+    const std::size_t right = m_tree[2 * node + 1];
+    m_tree[node] = isBetterRow(right, left) ? right : left;
+  }
+}
+
+void SymmetricKLDistanceQueue::setComponent(std::size_t n,
+                                            const GsfComponent &cmp) {
+  m_qop[n] = cmp.boundPars[eBoundQOverP];
+  m_var[n] = cmp.boundCov(eBoundQOverP, eBoundQOverP);
+  assert(m_var[n] != 0.0);
+  assert(std::isfinite(m_var[n]));
+  m_invVar[n] = 1 / m_var[n];
+}
+
+void SymmetricKLDistanceQueue::computeDistancesTo(std::size_t n) {
+  // Same operation order as computeSymmetricKlDivergence, which is symmetric
+  // under the exchange of the two components
+  const Array diff = m_qop[n] - m_qop;
+  m_buffer = m_var[n] * m_invVar + m_var * m_invVar[n] +
+             diff * (m_invVar[n] + m_invVar) * diff;
+  m_buffer = m_active.select(m_buffer, std::numeric_limits<double>::infinity());
+}
+
+void SymmetricKLDistanceQueue::rescanRow(std::size_t i) {
+  double min = std::numeric_limits<double>::infinity();
+  std::size_t idx = 0;
+  if (m_active[i]) {
+    const double *row = m_distances.data() + (i - 1) * i / 2;
+    for (std::size_t j = 0; j < i; ++j) {
+      if (row[j] < min) {
+        min = row[j];
+        idx = j;
+      }
+    }
+  }
+  m_rowMin[i] = min;
+  m_rowMinIdx[i] = idx;
+}
+
+bool SymmetricKLDistanceQueue::isBetterRow(std::size_t a,
+                                           std::size_t b) const {
+  // Ties are resolved towards the lower row to reproduce the order of a
+  // linear scan over the packed matrix
+  return m_rowMin[a] < m_rowMin[b] || (m_rowMin[a] == m_rowMin[b] && a < b);
+}
+
+void SymmetricKLDistanceQueue::updateTree(std::size_t i) {
+  std::size_t node = (m_numberLeaves + i) / 2;
+  while (node > 0) {
+    const std::size_t left = m_tree[2 * node];
+    const std::size_t right = m_tree[2 * node + 1];
+    m_tree[node] = isBetterRow(right, left) ? right : left;
+    node /= 2;
+  }
+}
+
+double SymmetricKLDistanceQueue::at(std::size_t i, std::size_t j) const {
+  return m_distances[i * (i - 1) / 2 + j];
+}
+
+void SymmetricKLDistanceQueue::updateComponent(std::size_t n,
+                                               const GsfComponent &cmp) {
+  assert(m_active[n] && "component has been removed");
+  setComponent(n, cmp);
+  computeDistancesTo(n);
+
+  // Row n is contiguous in the packed storage
+  if (n > 0) {
+    m_distances.segment((n - 1) * n / 2, n) = m_buffer.head(n);
+    rescanRow(n);
+    updateTree(n);
+  }
+
+  // Column n touches one entry in each of the following rows
+  for (std::size_t k = n + 1; k < m_numberComponents; ++k) {
+    const double d = m_buffer[k];
+    m_distances[(k - 1) * k / 2 + n] = d;
+    if (!m_active[k]) {
+      continue;
+    }
+    if (d < m_rowMin[k] || (d == m_rowMin[k] && n < m_rowMinIdx[k])) {
+      m_rowMin[k] = d;
+      m_rowMinIdx[k] = n;
+    } else if (m_rowMinIdx[k] == n && d != m_rowMin[k]) {
+      rescanRow(k);
+    } else {
+      continue;
+    }
+    updateTree(k);
+  }
+}
+
+void SymmetricKLDistanceQueue::removeComponent(std::size_t n) {
+  assert(m_active[n] && "component has already been removed");
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  m_active[n] = false;
+
+  if (n > 0) {
+    m_distances.segment((n - 1) * n / 2, n).setConstant(inf);
+  }
+  m_rowMin[n] = inf;
+  m_rowMinIdx[n] = 0;
+  updateTree(n);
+
+  for (std::size_t k = n + 1; k < m_numberComponents; ++k) {
+    m_distances[(k - 1) * k / 2 + n] = inf;
+    if (m_active[k] && m_rowMinIdx[k] == n) {
+      rescanRow(k);
+      updateTree(k);
+    }
+  }
+}
+
+std::pair<std::size_t, std::size_t> SymmetricKLDistanceQueue::minDistancePair()
+    const {
+  const std::size_t row = m_tree[1];
+  return {row, m_rowMinIdx[row]};
+}
+
 }  // namespace detail::Gsf
 
 }  // namespace Acts
@@ -8,25 +8,51 @@
 
 #include "Acts/Vertexing/AdaptiveGridDensityVertexFinder.hpp"
 
+#include <type_traits>
+
 Acts::Result<std::vector<Acts::Vertex>>
 Acts::AdaptiveGridDensityVertexFinder::find(
     const std::vector<InputTrack>& trackVector,
     const VertexingOptions& vertexingOptions,
     IVertexFinder::State& anyState) const {
   auto& state = anyState.as<State>();
+  if (m_cfg.useDenseDensityMap) {
+    return findSeed(trackVector, vertexingOptions, state,
+                    state.mainDenseDensityMap, state.denseTrackDensities);
+  }
+  return findSeed(trackVector, vertexingOptions, state, state.mainDensityMap,
+                  state.trackDensities);
+}
+
+template <typename density_map_t, typename track_density_t>
+Acts::Result<std::vector<Acts::Vertex>>
+Acts::AdaptiveGridDensityVertexFinder::findSeed(
+    const std::vector<InputTrack>& trackVector,
+    const VertexingOptions& vertexingOptions, State& state,
+    density_map_t& mainDensityMap,
+    std::unordered_map<InputTrack, track_density_t>& trackDensities) const {
   // Remove density contributions from tracks removed from track collection
   if (m_cfg.cacheGridStateForTrackRemoval && state.isInitialized &&
       !state.tracksToRemove.empty()) {
     for (auto trk : state.tracksToRemove) {
-      auto it = state.trackDensities.find(trk);
-      if (it == state.trackDensities.end()) {
+      auto it = trackDensities.find(trk);
+      if (it == trackDensities.end()) {
         // Track was never added to grid, so cannot remove it
         continue;
       }
-      m_cfg.gridDensity.subtractTrack(it->second, state.mainDensityMap);
+      m_cfg.gridDensity.subtractTrack(it->second, mainDensityMap);
     }
   } else {
-    state.mainDensityMap = DensityMap();
+    if constexpr (std::is_same_v<density_map_t, DenseDensityMap>) {
+      // Keep the memory of a grid from a previous iteration
+      if (mainDensityMap.nZBins() == 0) {
+        mainDensityMap = m_cfg.gridDensity.makeDenseDensityMap();
+      } else {
+        mainDensityMap.clear();
+      }
+    } else {
+      mainDensityMap = DensityMap();
+    }
     // Fill with track densities
     for (auto trk : trackVector) {
       const BoundTrackParameters& trkParams = m_cfg.extractParameters(trk);
@@ -35,16 +61,16 @@ Acts::AdaptiveGridDensityVertexFinder::find(
         continue;
       }
       auto trackDensityMap =
-          m_cfg.gridDensity.addTrack(trkParams, state.mainDensityMap);
+          m_cfg.gridDensity.addTrack(trkParams, mainDensityMap);
       // Cache track density contribution to main grid if enabled
       if (m_cfg.cacheGridStateForTrackRemoval) {
-        state.trackDensities[trk] = std::move(trackDensityMap);
+        trackDensities[trk] = std::move(trackDensityMap);
       }
     }
     state.isInitialized = true;
   }
 
-  if (state.mainDensityMap.empty()) {
+  if (mainDensityMap.empty()) {
     // No tracks passed selection
     // Return empty seed
     // (Note: Upstream finder should check for this break condition)
@@ -57,7 +83,7 @@ Acts::AdaptiveGridDensityVertexFinder::find(
 
   if (!m_cfg.estimateSeedWidth) {
     // Get z value of highest density bin
-    auto maxZTRes = m_cfg.gridDensity.getMaxZTPosition(state.mainDensityMap);
+    auto maxZTRes = m_cfg.gridDensity.getMaxZTPosition(mainDensityMap);
 
     if (!maxZTRes.ok()) {
       return maxZTRes.error();
@@ -67,7 +93,7 @@ Acts::AdaptiveGridDensityVertexFinder::find(
   } else {
     // Get z value of highest density bin and width
     auto maxZTResAndWidth =
-        m_cfg.gridDensity.getMaxZTPositionAndWidth(state.mainDensityMap);
+        m_cfg.gridDensity.getMaxZTPositionAndWidth(mainDensityMap);
 
     if (!maxZTResAndWidth.ok()) {
       return maxZTResAndWidth.error();
@@ -12,6 +12,10 @@
 #include "Acts/Vertexing/VertexingError.hpp"
 
 #include <algorithm>
+#include <array>
+#include <limits>
+#include <span>
+#include <stdexcept>
 
 namespace Acts {
 
@@ -35,8 +39,132 @@ double multivariateGaussian(const Vector<nDim>& args,
   return gaussianDensity;
 }
 
+/// @brief Index of the first maximum of a non-empty range
+/// @note The running maxima are kept in independent lanes so that the
+/// compiler can vectorise the scan
+///
+/// @param values The values to search
+///
+/// @return Index of the first element with the highest value
+std::size_t maxElementIndex(std::span<const float> values) {
+  constexpr std::size_t nLanes = 8;
+  std::array<float, nLanes> lanes{};
+  lanes.fill(values.front());
+
+  std::size_t i = 0;
+  for (; i + nLanes <= values.size(); i += nLanes) {
+    for (std::size_t lane = 0; lane < nLanes; ++lane) {
+      lanes[lane] = std::max(lanes[lane], values[i + lane]);
+    }
+  }
+  float maxValue = std::ranges::max(lanes);
+  for (; i < values.size(); ++i) {
+    maxValue = std::max(maxValue, values[i]);
+  }
+  return std::ranges::find(values, maxValue) - values.begin();
+}
+
 }  // namespace
 
+AdaptiveGridTrackDensity::DenseDensityMap::DenseDensityMap(
+    std::int32_t firstZBin, std::uint32_t nZBins, std::int32_t firstTBin,
+    std::uint32_t nTBins)
+    : m_firstZBin(firstZBin),
+      m_nZBins(nZBins),
+      m_firstTBin(firstTBin),
+      m_nTBins(nTBins),
+      m_slices(nTBins) {}
+
+bool AdaptiveGridTrackDensity::DenseDensityMap::contains(const Bin& bin) const {
+  return at(bin) > 0;
+}
+
+float AdaptiveGridTrackDensity::DenseDensityMap::at(const Bin& bin) const {
+  const std::int64_t tIndex = std::int64_t{bin.second} - m_firstTBin;
+  if (tIndex < 0 || tIndex >= m_nTBins) {
+    return 0.f;
+  }
+  const Slice& slice = m_slices[tIndex];
+  const std::int64_t zIndex =
+      std::int64_t{bin.first} - m_firstZBin - slice.zOffset;
+  if (zIndex < 0 || zIndex >= static_cast<std::int64_t>(slice.values.size())) {
+    return 0.f;
+  }
+  return slice.values[zIndex];
+}
+
+float& AdaptiveGridTrackDensity::DenseDensityMap::operator[](const Bin& bin) {
+  const std::int64_t zIndex = std::int64_t{bin.first} - m_firstZBin;
+  if (zIndex < 0 || zIndex >= m_nZBins) {
+    throw std::out_of_range("DenseDensityMap: z bin outside of the grid");
+  }
+  return *row(bin.second, bin.first, 1);
+}
+
+void AdaptiveGridTrackDensity::DenseDensityMap::clear() {
+  for (std::uint32_t i = m_firstFilledT; i < m_endFilledT; ++i) {
+    m_slices[i].zOffset = 0;
+    m_slices[i].values.clear();
+  }
+  m_firstFilledT = 0;
+  m_endFilledT = 0;
+  m_empty = true;
+}
+
+float* AdaptiveGridTrackDensity::DenseDensityMap::row(std::int32_t tBin,
+                                                      std::int32_t firstZBin,
+                                                      std::uint32_t nZBins) {
+  const std::int64_t tIndex = std::int64_t{tBin} - m_firstTBin;
+  if (tIndex < 0 || tIndex >= m_nTBins) {
+    throw std::out_of_range("DenseDensityMap: t bin outside of the grid");
+  }
+  const auto zBegin = static_cast<std::uint32_t>(firstZBin - m_firstZBin);
+  const std::uint32_t zEnd = zBegin + nZBins;
+
+  Slice& slice = m_slices[tIndex];
+  if (slice.values.empty()) {
+    slice.zOffset = zBegin;
+    slice.values.assign(nZBins, 0.f);
+    if (m_firstFilledT == m_endFilledT) {
+      m_firstFilledT = static_cast<std::uint32_t>(tIndex);
+      m_endFilledT = m_firstFilledT + 1;
+    } else {
+      m_firstFilledT = std::min(m_firstFilledT,
+                                static_cast<std::uint32_t>(tIndex));
+      m_endFilledT = std::max(m_endFilledT,
+                              static_cast<std::uint32_t>(tIndex + 1));
+    }
+    return slice.values.data();
+  }
+
+  const std::uint32_t oldBegin = slice.zOffset;
+  const auto oldSize = static_cast<std::uint32_t>(slice.values.size());
+  const std::uint32_t oldEnd = oldBegin + oldSize;
+  if (zBegin < oldBegin || zEnd > oldEnd) {
+    // Extend by at least half of the current size so that tracks arriving
+    // in arbitrary order only cause a logarithmic number of extensions
+    const std::uint32_t headroom = oldSize / 2;
+    std::uint32_t newBegin = oldBegin;
+    if (zBegin < oldBegin) {
+      newBegin = std::min(zBegin, oldBegin - std::min(oldBegin, headroom));
+    }
+    std::uint32_t newEnd = oldEnd;
+    if (zEnd > oldEnd) {
+      newEnd = std::min(std::max(zEnd, oldEnd + headroom), m_nZBins);
+    }
+    const std::uint32_t shift = oldBegin - newBegin;
+    slice.values.resize(newEnd - newBegin, 0.f);
+    if (shift > 0) {
+      std::copy_backward(slice.values.begin(),
+                         slice.values.begin() + oldSize,
+                         slice.values.begin() + shift + oldSize);
+      std::fill_n(slice.values.begin(), shift, 0.f);
+    }
+    slice.zOffset = newBegin;
+  }
+  return slice.values.data() + (zBegin - slice.zOffset);
+}
+
 double AdaptiveGridTrackDensity::getBinCenter(std::int32_t bin,
                                               double binExtent) {
   return bin * binExtent;
@@ -65,6 +193,23 @@ std::uint32_t AdaptiveGridTrackDensity::getTrkGridSize(
   return size;
 }
 
+std::pair<std::int32_t, std::uint32_t> AdaptiveGridTrackDensity::getWindowBins(
+    const std::pair<double, double>& window, double binExtent) {
+  auto first = static_cast<std::int32_t>(std::ceil(window.first / binExtent));
+  auto last = static_cast<std::int32_t>(std::floor(window.second / binExtent));
+  // Use the same bin center comparison as createTrackGrid
+  if (getBinCenter(first, binExtent) < window.first) {
+    ++first;
+  }
+  if (getBinCenter(last, binExtent) > window.second) {
+    --last;
+  }
+  if (last < first) {
+    return {first, 0};
+  }
+  return {first, static_cast<std::uint32_t>(last - first + 1)};
+}
+
 std::int32_t AdaptiveGridTrackDensity::getSpatialBin(double value) const {
   return getBin(value, m_cfg.spatialBinExtent);
 }
@@ -128,24 +273,86 @@ AdaptiveGridTrackDensity::AdaptiveGridTrackDensity(const Config& cfg)
   }
 }
 
-AdaptiveGridTrackDensity::DensityMap::const_iterator
+AdaptiveGridTrackDensity::DenseDensityMap
+AdaptiveGridTrackDensity::makeDenseDensityMap() const {
+  auto [firstZBin, nZBins] =
+      getWindowBins(m_cfg.spatialWindow, m_cfg.spatialBinExtent);
+  // Without time seeding all tracks end up in the t bin 0
+  std::pair<std::int32_t, std::uint32_t> tBins = {0, 1};
+  if (m_cfg.useTime) {
+    tBins = getWindowBins(m_cfg.temporalWindow, m_cfg.temporalBinExtent);
+  } else if (m_cfg.temporalWindow.first > 0 ||
+             m_cfg.temporalWindow.second < 0) {
+    tBins = {0, 0};
+  }
+  return DenseDensityMap(firstZBin, nZBins, tBins.first, tBins.second);
+}
+
+std::pair<AdaptiveGridTrackDensity::Bin, float>
 AdaptiveGridTrackDensity::highestDensityEntry(
     const DensityMap& densityMap) const {
   auto maxEntry = std::max_element(
       std::begin(densityMap), std::end(densityMap),
       [](const auto& a, const auto& b) { return a.second < b.second; });
+  return {maxEntry->first, maxEntry->second};
+}
+
+std::pair<AdaptiveGridTrackDensity::Bin, float>
+AdaptiveGridTrackDensity::highestDensityEntry(
+    const DenseDensityMap& densityMap) const {
+  std::pair<Bin, float> maxEntry = {
+      {0, 0}, -std::numeric_limits<float>::infinity()};
+  // Only the filled t bins and their filled z ranges are scanned
+  for (std::uint32_t i = densityMap.m_firstFilledT;
+       i < densityMap.m_endFilledT; ++i) {
+    const DenseDensityMap::Slice& slice = densityMap.m_slices[i];
+    if (slice.values.empty()) {
+      continue;
+    }
+    const std::size_t zIndex = slice.zOffset + maxElementIndex(slice.values);
+    const float value = slice.values[zIndex - slice.zOffset];
+    if (value > maxEntry.second) {
+      maxEntry = {{densityMap.m_firstZBin + static_cast<std::int32_t>(zIndex),
+                   densityMap.m_firstTBin + static_cast<std::int32_t>(i)},
+                  value};
+    }
+  }
   return maxEntry;
 }
 
 Result<AdaptiveGridTrackDensity::ZTPosition>
 AdaptiveGridTrackDensity::getMaxZTPosition(DensityMap& densityMap) const {
+  return getMaxZTPositionImpl(densityMap);
+}
+
+Result<AdaptiveGridTrackDensity::ZTPosition>
+AdaptiveGridTrackDensity::getMaxZTPosition(DenseDensityMap& densityMap) const {
+  return getMaxZTPositionImpl(densityMap);
+}
+
+Result<AdaptiveGridTrackDensity::ZTPositionAndWidth>
+AdaptiveGridTrackDensity::getMaxZTPositionAndWidth(
+    DensityMap& densityMap) const {
+  return getMaxZTPositionAndWidthImpl(densityMap);
+}
+
+Result<AdaptiveGridTrackDensity::ZTPositionAndWidth>
+AdaptiveGridTrackDensity::getMaxZTPositionAndWidth(
+    DenseDensityMap& densityMap) const {
+  return getMaxZTPositionAndWidthImpl(densityMap);
+}
+
+template <typename density_map_t>
+Result<AdaptiveGridTrackDensity::ZTPosition>
+AdaptiveGridTrackDensity::getMaxZTPositionImpl(
+    density_map_t& densityMap) const {
   if (densityMap.empty()) {
     return VertexingError::EmptyInput;
   }
 
   Bin bin;
   if (!m_cfg.useHighestSumZPosition) {
-    bin = highestDensityEntry(densityMap)->first;
+    bin = highestDensityEntry(densityMap).first;
   } else {
     // Get z position with highest density sum
     // of surrounding bins
@@ -159,9 +366,10 @@ AdaptiveGridTrackDensity::getMaxZTPosition(DensityMap& densityMap) const {
   return std::pair(maxZ, maxT);
 }
 
+template <typename density_map_t>
 Result<AdaptiveGridTrackDensity::ZTPositionAndWidth>
-AdaptiveGridTrackDensity::getMaxZTPositionAndWidth(
-    DensityMap& densityMap) const {
+AdaptiveGridTrackDensity::getMaxZTPositionAndWidthImpl(
+    density_map_t& densityMap) const {
   // Get z value where the density is the highest
   auto maxZTRes = getMaxZTPosition(densityMap);
   if (!maxZTRes.ok()) {
@@ -213,6 +421,49 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::addTrack(
   return trackDensityMap;
 }
 
+AdaptiveGridTrackDensity::DenseTrackDensity AdaptiveGridTrackDensity::addTrack(
+    const BoundTrackParameters& trk, DenseDensityMap& mainDensityMap) const {
+  Vector3 impactParams = trk.impactParameters();
+  SquareMatrix<3> cov = trk.impactParameterCovariance().value();
+
+  std::uint32_t spatialTrkGridSize =
+      getSpatialTrkGridSize(std::sqrt(cov(1, 1)));
+  std::uint32_t temporalTrkGridSize =
+      getTemporalTrkGridSize(std::sqrt(cov(2, 2)));
+
+  // Check if current track affects grid density
+  std::int32_t centralDBin = getBin(impactParams(0), m_cfg.spatialBinExtent);
+  if (std::abs(centralDBin) > (spatialTrkGridSize - 1) / 2.) {
+    return {};
+  }
+
+  Bin centralBin = {getSpatialBin(impactParams(1)),
+                    getTemporalBin(impactParams(2))};
+
+  DenseTrackDensity trackDensity =
+      createDenseTrackGrid(impactParams, centralBin, cov, spatialTrkGridSize,
+                           temporalTrkGridSize, mainDensityMap);
+  if (trackDensity.empty()) {
+    return trackDensity;
+  }
+
+  const std::size_t nTBins = trackDensity.values.size() / trackDensity.nZBins;
+  for (std::size_t i = 0; i < nTBins; ++i) {
+    const std::int32_t tBin =
+        trackDensity.firstTBin + static_cast<std::int32_t>(i);
+    float* mainRow = mainDensityMap.row(tBin, trackDensity.firstZBin,
+                                        trackDensity.nZBins);
+    const float* trackRow =
+        trackDensity.values.data() + i * trackDensity.nZBins;
+    for (std::uint32_t j = 0; j < trackDensity.nZBins; ++j) {
+      mainRow[j] += trackRow[j];
+    }
+  }
+  mainDensityMap.m_empty = false;
+
+  return trackDensity;
+}
+
 void AdaptiveGridTrackDensity::subtractTrack(const DensityMap& trackDensityMap,
                                              DensityMap& mainDensityMap) const {
   for (const auto& [bin, density] : trackDensityMap) {
@@ -220,6 +471,27 @@ void AdaptiveGridTrackDensity::subtractTrack(const DensityMap& trackDensityMap,
   }
 }
 
+void AdaptiveGridTrackDensity::subtractTrack(
+    const DenseTrackDensity& trackDensity,
+    DenseDensityMap& mainDensityMap) const {
+  if (trackDensity.empty()) {
+    return;
+  }
+
+  const std::size_t nTBins = trackDensity.values.size() / trackDensity.nZBins;
+  for (std::size_t i = 0; i < nTBins; ++i) {
+    const std::int32_t tBin =
+        trackDensity.firstTBin + static_cast<std::int32_t>(i);
+    float* mainRow = mainDensityMap.row(tBin, trackDensity.firstZBin,
+                                        trackDensity.nZBins);
+    const float* trackRow =
+        trackDensity.values.data() + i * trackDensity.nZBins;
+    for (std::uint32_t j = 0; j < trackDensity.nZBins; ++j) {
+      mainRow[j] -= trackRow[j];
+    }
+  }
+}
+
 AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::createTrackGrid(
     const Vector3& impactParams, const Bin& centralBin,
     const SquareMatrix3& cov, std::uint32_t spatialTrkGridSize,
@@ -268,8 +540,85 @@ AdaptiveGridTrackDensity::DensityMap AdaptiveGridTrackDensity::createTrackGrid(
   return trackDensityMap;
 }
 
+AdaptiveGridTrackDensity::DenseTrackDensity
+AdaptiveGridTrackDensity::createDenseTrackGrid(
+    const Vector3& impactParams, const Bin& centralBin,
+    const SquareMatrix3& cov, std::uint32_t spatialTrkGridSize,
+    std::uint32_t temporalTrkGridSize,
+    const DenseDensityMap& mainDensityMap) const {
+  DenseTrackDensity trackDensity;
+
+  // Restrict the track grid to the bins of the main grid, which only
+  // contains bins inside the spatial and temporal windows
+  const auto halfSpatialTrkGridSize =
+      static_cast<std::int32_t>((spatialTrkGridSize - 1) / 2);
+  const auto halfTemporalTrkGridSize =
+      static_cast<std::int32_t>((temporalTrkGridSize - 1) / 2);
+  const std::int32_t firstZBin =
+      std::max(centralBin.first - halfSpatialTrkGridSize,
+               mainDensityMap.firstZBin());
+  const std::int32_t endZBin = std::min(
+      centralBin.first + halfSpatialTrkGridSize + 1,
+      mainDensityMap.firstZBin() +
+          static_cast<std::int32_t>(mainDensityMap.nZBins()));
+  const std::int32_t firstTBin =
+      std::max(centralBin.second - halfTemporalTrkGridSize,
+               mainDensityMap.firstTBin());
+  const std::int32_t endTBin = std::min(
+      centralBin.second + halfTemporalTrkGridSize + 1,
+      mainDensityMap.firstTBin() +
+          static_cast<std::int32_t>(mainDensityMap.nTBins()));
+  if (firstZBin >= endZBin || firstTBin >= endTBin) {
+    return trackDensity;
+  }
+
+  const auto nZBins = static_cast<std::uint32_t>(endZBin - firstZBin);
+  const auto nTBins = static_cast<std::uint32_t>(endTBin - firstTBin);
+  trackDensity.firstZBin = firstZBin;
+  trackDensity.firstTBin = firstTBin;
+  trackDensity.nZBins = nZBins;
+  trackDensity.values.resize(nZBins * nTBins);
+
+  // Weight matrix of the Gaussian, the time components stay zero if time
+  // vertex seeding is disabled
+  SquareMatrix3 weight = SquareMatrix3::Zero();
+  double sqrtDeterminant = 0;
+  if (m_cfg.useTime) {
+    weight = cov.inverse();
+    sqrtDeterminant = std::sqrt(cov.determinant());
+  } else {
+    weight.topLeftCorner<2, 2>() = cov.topLeftCorner<2, 2>().inverse();
+    sqrtDeterminant = std::sqrt(cov.topLeftCorner<2, 2>().determinant());
+  }
+
+  const double d = -impactParams(0);
+  std::vector<double> exponents(nZBins);
+  for (std::uint32_t i = 0; i < nTBins; ++i) {
+    const double t = getTemporalBinCenter(firstTBin + i) - impactParams(2);
+    // Exponent of the Gaussian as a quadratic function of the z distance
+    // between bin and track
+    const double c0 = weight(0, 0) * d * d + 2 * weight(0, 2) * d * t +
+                      weight(2, 2) * t * t;
+    const double c1 = 2 * (weight(0, 1) * d + weight(1, 2) * t);
+    const double c2 = weight(1, 1);
+    for (std::uint32_t j = 0; j < nZBins; ++j) {
+      const double z = getBinCenter(firstZBin + static_cast<std::int32_t>(j),
+                                    m_cfg.spatialBinExtent) -
+                       impactParams(1);
+      exponents[j] = -0.5 * (c0 + z * (c1 + c2 * z));
+    }
+    float* row = trackDensity.values.data() + i * nZBins;
+    for (std::uint32_t j = 0; j < nZBins; ++j) {
+      row[j] = static_cast<float>(safeExp(exponents[j]) / sqrtDeterminant);
+    }
+  }
+
+  return trackDensity;
+}
+
+template <typename density_map_t>
 Result<double> AdaptiveGridTrackDensity::estimateSeedWidth(
-    const DensityMap& densityMap, const ZTPosition& maxZT) const {
+    const density_map_t& densityMap, const ZTPosition& maxZT) const {
   if (densityMap.empty()) {
     return VertexingError::EmptyInput;
   }
@@ -334,12 +683,13 @@ Result<double> AdaptiveGridTrackDensity::estimateSeedWidth(
   return std::isnormal(width) ? width : 0.0;
 }
 
+template <typename density_map_t>
 AdaptiveGridTrackDensity::Bin AdaptiveGridTrackDensity::highestDensitySumBin(
-    DensityMap& densityMap) const {
+    density_map_t& densityMap) const {
   // The global maximum
   auto firstMax = highestDensityEntry(densityMap);
-  Bin binFirstMax = firstMax->first;
-  double valueFirstMax = firstMax->second;
+  Bin binFirstMax = firstMax.first;
+  double valueFirstMax = firstMax.second;
   double firstSum = getDensitySum(densityMap, binFirstMax);
   // Smaller maxima must have a density of at least:
   // valueFirstMax - densityDeviation
@@ -348,8 +698,8 @@ AdaptiveGridTrackDensity::Bin AdaptiveGridTrackDensity::highestDensitySumBin(
   // Get the second highest maximum
   densityMap[binFirstMax] = 0;
   auto secondMax = highestDensityEntry(densityMap);
-  Bin binSecondMax = secondMax->first;
-  double valueSecondMax = secondMax->second;
+  Bin binSecondMax = secondMax.first;
+  double valueSecondMax = secondMax.second;
   double secondSum = 0;
   if (valueFirstMax - valueSecondMax < densityDeviation) {
     secondSum = getDensitySum(densityMap, binSecondMax);
@@ -363,8 +713,8 @@ AdaptiveGridTrackDensity::Bin AdaptiveGridTrackDensity::highestDensitySumBin(
   // Get the third highest maximum
   densityMap[binSecondMax] = 0;
   auto thirdMax = highestDensityEntry(densityMap);
-  Bin binThirdMax = thirdMax->first;
-  double valueThirdMax = thirdMax->second;
+  Bin binThirdMax = thirdMax.first;
+  double valueThirdMax = thirdMax.second;
   double thirdSum = 0;
   if (valueFirstMax - valueThirdMax < densityDeviation) {
     thirdSum = getDensitySum(densityMap, binThirdMax);
@@ -400,4 +750,10 @@ double AdaptiveGridTrackDensity::getDensitySum(const DensityMap& densityMap,
          valueOrZero({bin.first + 1, bin.second});
 }
 
+double AdaptiveGridTrackDensity::getDensitySum(
+    const DenseDensityMap& densityMap, const Bin& bin) const {
+  return densityMap.at(bin) + densityMap.at({bin.first - 1, bin.second}) +
+         densityMap.at({bin.first + 1, bin.second});
+}
+
 }  // namespace Acts
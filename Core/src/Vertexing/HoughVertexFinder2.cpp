@@ -9,9 +9,10 @@
 #include "Acts/Vertexing/HoughVertexFinder2.hpp"
 
 #include "Acts/Seeding/HoughTransformUtils.hpp"
-#include "Acts/Utilities/AxisDefinitions.hpp"
-#include "Acts/Utilities/Grid.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 
+#include <algorithm>
+#include <array>
 #include <numeric>
 
 namespace Acts {
@@ -20,10 +21,87 @@ namespace {
 
 /// Type alias for count values in Hough histogram bins
 using HoughCount = std::uint16_t;
-/// Type alias for equidistant axis used in Hough transform
-using HoughAxis = Axis<AxisType::Equidistant, AxisBoundaryType::Open>;
-/// Type alias for 2D histogram used in Hough transform
-using HoughHist = Grid<HoughCount, HoughAxis, HoughAxis>;
+
+/// Number of z rows of the Hough plane filled together; a block of rows with
+/// the default 8000 cot(theta) bins stays within the L2 cache
+constexpr std::uint32_t kRowBlock = 16;
+
+/// Space point prepared for the filling of the Hough plane; its line covers
+/// the z bins [zFrom, zTo)
+struct HoughLine {
+  double z = 0.;
+  double invR = 0.;
+  std::uint32_t zFrom = 0;
+  std::uint32_t zTo = 0;
+};
+
+/// Dense Hough plane with the z bins as rows of cot(theta) bins
+struct HoughPlane {
+  std::uint32_t numCotThetaBins = 0;
+  double minCotTheta = 0.;
+  double invCotThetaBinSize = 0.;
+  std::uint32_t fillNeighbours = 0;
+  std::uint32_t minHits = 0;
+  std::vector<HoughCount> counts;
+
+  /// Fills the rows [rowBegin, rowEnd) with all lines and projects them onto
+  /// the z axis. Rows are processed in blocks so that the cells touched by
+  /// consecutive lines stay in cache. Different row ranges can be filled
+  /// concurrently.
+  void fillRows(const std::vector<HoughLine>& lines,
+                const std::vector<double>& vtxZPositions,
+                std::uint32_t rowBegin, std::uint32_t rowEnd,
+                std::vector<std::uint32_t>& houghZProjection) {
+    std::array<std::uint32_t, kRowBlock> cotThetaBins{};
+    for (std::uint32_t blockBegin = rowBegin; blockBegin < rowEnd;
+         blockBegin += kRowBlock) {
+      const std::uint32_t blockEnd = std::min(blockBegin + kRowBlock, rowEnd);
+
+      for (const HoughLine& line : lines) {
+        const std::uint32_t zFrom = std::max(line.zFrom, blockBegin);
+        const std::uint32_t zTo = std::min(line.zTo, blockEnd);
+        if (zFrom >= zTo) {
+          continue;
+        }
+
+        // the bin computation is independent per row and vectorises
+        const std::uint32_t nRows = zTo - zFrom;
+        for (std::uint32_t i = 0; i < nRows; ++i) {
+          const double cotTheta =
+              (line.z - vtxZPositions[zFrom + i]) * line.invR;
+          cotThetaBins[i] = static_cast<std::uint32_t>(
+              (cotTheta - minCotTheta) * invCotThetaBinSize);
+        }
+
+        for (std::uint32_t i = 0; i < nRows; ++i) {
+          const std::uint32_t cotThetaBin = cotThetaBins[i];
+          const std::uint32_t cotThetaFrom = static_cast<std::uint32_t>(
+              std::max<int>(cotThetaBin - fillNeighbours, 0));
+          const std::uint32_t cotThetaTo =
+              std::min(cotThetaBin + fillNeighbours + 1u, numCotThetaBins);
+
+          HoughCount* row =
+              counts.data() +
+              static_cast<std::size_t>(zFrom + i) * numCotThetaBins;
+          for (std::uint32_t cotBin = cotThetaFrom; cotBin < cotThetaTo;
+               ++cotBin) {
+            ++row[cotBin];
+          }
+        }
+      }
+
+      for (std::uint32_t zBin = blockBegin; zBin < blockEnd; ++zBin) {
+        const HoughCount* row =
+            counts.data() + static_cast<std::size_t>(zBin) * numCotThetaBins;
+        std::uint32_t sum = 0;
+        for (std::uint32_t cotBin = 0; cotBin < numCotThetaBins; ++cotBin) {
+          sum += row[cotBin] >= minHits ? row[cotBin] : 0u;
+        }
+        houghZProjection[zBin] = sum;
+      }
+    }
+  }
+};
 
 }  // namespace
 
@@ -126,17 +204,17 @@ Result<Vector3> HoughVertexFinder2::findHoughVertex(
   const double vtxOldX = vtxOld[0];
   const double vtxOldY = vtxOld[1];
 
-  HoughHist houghHist(HoughAxis(minZ, maxZ, numZBins),
-                      HoughAxis(minCotTheta, maxCotTheta, numCotThetaBins));
-
   std::vector<std::uint32_t> houghZProjection(numZBins, 0);
 
   std::vector<double> vtxZPositions;
+  vtxZPositions.reserve(numZBins);
   for (std::uint32_t zBin = 0; zBin < numZBins; zBin++) {
     vtxZPositions.push_back(
         HoughTransformUtils::binCenter(minZ, maxZ, numZBins, zBin));
   }
 
+  std::vector<HoughLine> lines;
+  lines.reserve(spacePoints.size());
   for (const auto& sp : spacePoints) {
     double sp_invr = 1. / std::hypot((sp.x() - vtxOldX), (sp.y() - vtxOldY));
     if (sp.z() > maxZ) {
@@ -153,33 +231,30 @@ Result<Vector3> HoughVertexFinder2::findHoughVertex(
         std::max(((sp.z() - maxCotTheta / sp_invr) - minZ) / zBinSize + 1, 0.));
     std::uint32_t zTo = static_cast<std::uint32_t>(std::min(
         ((sp.z() - minCotTheta / sp_invr) - minZ) / zBinSize, 1. * numZBins));
-
-    for (std::uint32_t zBin = zFrom; zBin < zTo; zBin++) {
-      double cotTheta = (sp.z() - vtxZPositions[zBin]) * sp_invr;
-
-      std::uint32_t cotThetaBin = static_cast<std::uint32_t>(
-          (cotTheta - minCotTheta) * invCotThetaBinSize);
-
-      std::uint32_t cotThetaFrom = static_cast<std::uint32_t>(
-          std::max<int>(cotThetaBin - m_cfg.fillNeighbours, 0));
-
-      std::uint32_t cotThetaTo =
-          std::min(cotThetaBin + m_cfg.fillNeighbours + 1u, numCotThetaBins);
-
-      for (std::uint32_t cotBin = cotThetaFrom; cotBin < cotThetaTo; ++cotBin) {
-        ++houghHist.atLocalBins({zBin, cotBin});
-      }
+    if (zFrom < zTo) {
+      lines.push_back({sp.z(), sp_invr, zFrom, zTo});
     }
   }
 
-  for (std::uint32_t zBin = 0; zBin < numZBins; zBin++) {
-    for (std::uint32_t cotBin = 0; cotBin < numCotThetaBins; ++cotBin) {
-      auto rhs = houghHist.atLocalBins({zBin, cotBin});
-      if (rhs >= m_cfg.minHits) {
-        houghZProjection[zBin] += static_cast<std::uint32_t>(rhs);
-      }
-    }
-  }
+  HoughPlane plane;
+  plane.numCotThetaBins = numCotThetaBins;
+  plane.minCotTheta = minCotTheta;
+  plane.invCotThetaBinSize = invCotThetaBinSize;
+  plane.fillNeighbours = m_cfg.fillNeighbours;
+  plane.minHits = m_cfg.minHits;
+  plane.counts.assign(static_cast<std::size_t>(numZBins) * numCotThetaBins, 0);
+
+  // Every chunk owns a contiguous range of z rows, so no reduction of
+  // private histograms is needed and the result does not depend on the
+  // number of chunks
+  parallelFor(
+      m_cfg.executor.get(), numZBins,
+      [&](std::size_t /*chunk*/, std::size_t rowBegin, std::size_t rowEnd) {
+        plane.fillRows(lines, vtxZPositions,
+                       static_cast<std::uint32_t>(rowBegin),
+                       static_cast<std::uint32_t>(rowEnd), houghZProjection);
+      },
+      kRowBlock);
 
   auto vtxNewZ = findHoughPeak(houghZProjection, vtxZPositions);
   if (vtxNewZ.ok()) {
@@ -205,8 +280,9 @@ Result<double> HoughVertexFinder2::findHoughPeak(
   double sumEntries = 0;
   double meanZPeak = 0.;
 
-  for (std::uint32_t zBin =
-           std::max<std::uint32_t>(maxZBin - m_cfg.peakWidth, 0);
+  const std::uint32_t zBinFrom =
+      maxZBin > m_cfg.peakWidth ? maxZBin - m_cfg.peakWidth : 0u;
+  for (std::uint32_t zBin = zBinFrom;
        zBin <= std::min(numZBins - 1, maxZBin + m_cfg.peakWidth); ++zBin) {
     double countsInBin = std::max(houghZProjection.at(zBin) - avg, 0.);
     sumEntries += countsInBin;
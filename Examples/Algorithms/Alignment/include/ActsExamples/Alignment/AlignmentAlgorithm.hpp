@@ -111,6 +111,8 @@ class AlignmentAlgorithm final : public IAlgorithm {
     std::size_t maxNumIterations = 100;
     /// Number of tracks to be used for alignment
     int maxNumTracks = -1;
+    /// Threading and solver steering of the alignment
+    ActsAlignment::AlignmentComputeOptions computeOptions;
     std::vector<AlignmentGroup> m_groups;
   };
 
@@ -116,6 +116,7 @@ ProcessCode AlignmentAlgorithm::execute(const AlgorithmContext& ctx) const {
   ActsAlignment::AlignmentOptions<TrackFitterOptions> alignOptions(
       kfOptions, m_cfg.alignedTransformUpdater, m_cfg.alignedDetElements,
       m_cfg.chi2ONdfCutOff, m_cfg.deltaChi2ONdfCutOff, m_cfg.maxNumIterations);
+  alignOptions.computeOptions = m_cfg.computeOptions;
 
   ACTS_DEBUG("Invoke track-based alignment with " << numTracksUsed
                                                   << " input tracks");
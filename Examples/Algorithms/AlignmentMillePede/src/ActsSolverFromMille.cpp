@@ -136,7 +136,8 @@ ProcessCode ActsSolverFromMille::finalize() {
                 << parLabels[i] << " = " << std::setw(10)
                 << alignResult.deltaAlignmentParameters(row) << std::setw(6)
                 << " +/- " << std::setw(10)
-                << std::sqrt(alignResult.alignmentCovariance(row, row)));
+                << std::sqrt(
+                       alignResult.alignmentCovarianceBlocks.at(index)(i, i)));
     }
   }
 
@@ -0,0 +1,61 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/TrackFinding/ITrackParamsLookupWriter.hpp"
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace ActsExamples {
+
+/// @brief Binary writer for track parameter lookup tables
+///
+/// This writer converts the accumulated lookup into the compact
+/// Acts::TrackParamsLookupTable and writes its binary representation,
+/// which can be read back with Acts::TrackParamsLookupTable::fromBinaryStream
+/// and used in the TrackParamsEstimationAlgorithm
+class BinaryTrackParamsLookupWriter final : public ITrackParamsLookupWriter {
+ public:
+  /// @brief Nested configuration struct
+  struct Config {
+    /// Output file name
+    std::string path;
+  };
+
+  /// Constructor
+  ///
+  /// @param config The configuration struct of the writer
+  explicit BinaryTrackParamsLookupWriter(const Config& config)
+      : m_cfg(config) {};
+
+  /// Virtual destructor
+  ~BinaryTrackParamsLookupWriter() override = default;
+
+  /// Write out track parameters lookup table
+  ///
+  /// @param lookup The lookup to write
+  void writeLookup(const TrackParamsLookup& lookup) const override {
+    std::ofstream ofs(m_cfg.path, std::ios::out | std::ios::binary);
+    if (!ofs) {
+      throw std::runtime_error("Could not open " + m_cfg.path);
+    }
+    makeTrackParamsLookupTable(lookup).toBinaryStream(ofs);
+  };
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// The config of the writer
+  Config m_cfg;
+};
+
+}  // namespace ActsExamples
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include "Acts/EventData/SeedContainer2.hpp"
+#include "Acts/EventData/SpacePointContainer2.hpp"
+#include "Acts/EventData/Types.hpp"
 #include "Acts/Seeding/SeedConfirmationRangeConfig.hpp"
 #include "Acts/Seeding2/BroadTripletSeedFilter.hpp"
 #include "Acts/Seeding2/CylindricalSpacePointGrid2.hpp"
@@ -19,7 +22,9 @@
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Utilities/ObjectPool.hpp"
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -228,6 +233,20 @@ class GridTripletSeedingAlgorithm final : public IAlgorithm {
     /// Connect custom selections on the space points or to the doublet
     /// compatibility
     bool useExtraCuts = false;
+
+    /// The binned space points, the intermediate space point containers and
+    /// the seeding buffers are kept alive across events. Their memory is
+    /// released after an event with more space points than this, such that
+    /// a single busy event does not pin its memory for the rest of the run.
+    /// Buffers of the parallel mode which another event is using at that
+    /// moment are kept.
+    std::uint32_t maxRetainedSpacePoints =
+        std::numeric_limits<std::uint32_t>::max();
+
+    /// Seed the bin groups of one event in parallel TBB tasks. The seeds are
+    /// identical to the serial mode. Has no effect with seed confirmation,
+    /// which couples the bin groups through the best seed quality.
+    bool parallelBinGroups = false;
   };
 
   /// Construct the seeding algorithm.
@@ -247,6 +266,35 @@ class GridTripletSeedingAlgorithm final : public IAlgorithm {
   const Config& config() const { return m_cfg; }
 
  private:
+  /// Buffers needed to seed a sequence of bin groups
+  struct GroupBuffers {
+    Acts::TripletSeeder::Cache seederCache;
+    Acts::BroadTripletSeedFilter::State filterState;
+    Acts::BroadTripletSeedFilter::Cache filterCache;
+    std::vector<Acts::SpacePointContainer2::ConstRange> bottomSpRanges;
+    std::vector<Acts::SpacePointContainer2::ConstRange> topSpRanges;
+  };
+
+  /// Per-event buffers which are reused across events
+  struct Scratch {
+    Scratch(const Acts::CylindricalSpacePointGrid2::Config& gridConfig,
+            std::unique_ptr<const Acts::Logger> gridLogger);
+
+    Acts::CylindricalSpacePointGrid2 grid;
+    Acts::CylindricalSpacePointGrid2::ContiguousBins bins;
+    /// Index and coordinates of the space points passing the selection
+    std::vector<Acts::SpacePointIndex2> selected;
+    std::vector<float> phi;
+    std::vector<float> z;
+    std::vector<float> r;
+    Acts::SpacePointContainer2 coreSpacePoints;
+    GroupBuffers groupBuffers;
+    /// Seeds of each chunk of bin groups in the parallel mode
+    std::vector<Acts::SeedContainer2> chunkSeeds;
+    /// Largest number of seeds seen so far, used to reserve the output
+    std::size_t maxSeeds = 0;
+  };
+
   Config m_cfg;
   Acts::CylindricalSpacePointGrid2::Config m_gridConfig;
 
@@ -262,6 +310,12 @@ class GridTripletSeedingAlgorithm final : public IAlgorithm {
                                                          "InputSpacePoints"};
   WriteDataHandle<SeedContainer> m_outputSeeds{this, "OutputSeeds"};
 
+  mutable ObjectPool<Scratch> m_scratchPool{[this] {
+    return std::make_unique<Scratch>(m_gridConfig,
+                                     logger().cloneWithSuffix("Grid"));
+  }};
+  mutable ObjectPool<GroupBuffers> m_groupBuffersPool;
+
   /// Get the proper radius validity range given a middle space point candidate.
   /// In case the radius range changes according to the z-bin we need to
   /// retrieve the proper range. We can do this computation only once, since all
@@ -37,7 +37,7 @@ class MuonHoughSeeder final : public IAlgorithm {
  public:
   /// @brief Abbrivation of the HoughPlane_t
   using HoughPlane_t =
-      Acts::HoughTransformUtils::HoughPlane<const MuonSpacePoint*>;
+      Acts::HoughTransformUtils::CompactHoughPlane<const MuonSpacePoint*>;
   /// @brief Abbrivation of the PeakFinder
   using PeakFinder_t = Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
       const MuonSpacePoint*>;
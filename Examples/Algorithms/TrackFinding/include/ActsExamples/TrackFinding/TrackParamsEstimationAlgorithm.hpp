@@ -12,6 +12,7 @@
 #include "Acts/EventData/ParticleHypothesis.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Seeding/TrackParamsLookupTable.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/EventData/ProtoTrack.hpp"
 #include "ActsExamples/EventData/Seed.hpp"
@@ -60,6 +61,11 @@ class TrackParamsEstimationAlgorithm final : public IAlgorithm {
     /// Magnetic field variant.
     std::shared_ptr<const Acts::MagneticFieldProvider> magneticField;
 
+    /// Optional lookup table for the track parameters estimation. If given,
+    /// the lookup estimate is used whenever available and the analytical
+    /// estimation from the seed serves as fallback.
+    std::shared_ptr<const Acts::TrackParamsLookupTable> paramsLookup;
+
     /// The minimum magnetic field to trigger the track parameters estimation
     double bFieldMin = 0.1 * Acts::UnitConstants::T;
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/Seeding/TrackParamsLookupTable.hpp"
 #include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/GridAxisGenerators.hpp"
 
@@ -41,4 +42,15 @@ using TrackParamsLookupGrid =
 using TrackParamsLookup =
     std::unordered_map<Acts::GeometryIdentifier, TrackParamsLookupGrid>;
 
+/// @brief Convert the accumulated lookup into the compact Core lookup table
+///
+/// Only the reference layer parameters are kept, i.e. the direction and q/p
+/// at the reference surface. Bins without entries stay empty.
+///
+/// @param lookup The lookup to convert
+///
+/// @return The Core lookup table to be used for the track parameter estimation
+Acts::TrackParamsLookupTable makeTrackParamsLookupTable(
+    const TrackParamsLookup& lookup);
+
 }  // namespace ActsExamples
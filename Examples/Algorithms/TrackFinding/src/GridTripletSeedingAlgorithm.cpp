@@ -17,11 +17,17 @@
 #include "Acts/Seeding2/TripletSeedFinder.hpp"
 #include "Acts/Utilities/Delegate.hpp"
 #include "ActsExamples/EventData/SpacePoint.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <csignal>
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
+
+#include <tbb/blocked_range.h>
+#include <tbb/task_arena.h>
 
 namespace ActsExamples {
 
@@ -129,12 +135,30 @@ GridTripletSeedingAlgorithm::GridTripletSeedingAlgorithm(
   m_seedFinder = Acts::TripletSeeder(this->logger().cloneWithSuffix("Finder"));
 }
 
+GridTripletSeedingAlgorithm::Scratch::Scratch(
+    const Acts::CylindricalSpacePointGrid2::Config& gridConfig,
+    std::unique_ptr<const Acts::Logger> gridLogger)
+    : grid(gridConfig, std::move(gridLogger)),
+      coreSpacePoints(Acts::SpacePointColumns::PackedXY |
+                      Acts::SpacePointColumns::PackedZR |
+                      Acts::SpacePointColumns::VarianceZ |
+                      Acts::SpacePointColumns::VarianceR |
+                      Acts::SpacePointColumns::CopyFromIndex) {}
+
 ProcessCode GridTripletSeedingAlgorithm::execute(
     const AlgorithmContext& ctx) const {
   const SpacePointContainer& spacePoints = m_inputSpacePoints(ctx);
 
-  Acts::CylindricalSpacePointGrid2 grid(m_gridConfig,
-                                        logger().cloneWithSuffix("Grid"));
+  // the buffers keep their capacity from previous events
+  auto scratch = m_scratchPool.acquire();
+  const Acts::CylindricalSpacePointGrid2& grid = scratch->grid;
+  Acts::SpacePointContainer2& coreSpacePoints = scratch->coreSpacePoints;
+  Acts::CylindricalSpacePointGrid2::ContiguousBins& bins = scratch->bins;
+  coreSpacePoints.clear();
+  scratch->selected.clear();
+  scratch->phi.clear();
+  scratch->z.clear();
+  scratch->r.clear();
 
   for (std::size_t i = 0; i < spacePoints.size(); ++i) {
     const auto& sp = spacePoints[i];
@@ -144,41 +168,31 @@ ProcessCode GridTripletSeedingAlgorithm::execute(
       continue;
     }
 
-    float phi = std::atan2(sp.y(), sp.x());
-    grid.insert(i, phi, sp.z(), sp.r());
-  }
-
-  for (std::size_t i = 0; i < grid.numberOfBins(); ++i) {
-    std::ranges::sort(grid.at(i), [&](const Acts::SpacePointIndex2& a,
-                                      const Acts::SpacePointIndex2& b) {
-      return spacePoints[a].r() < spacePoints[b].r();
-    });
+    scratch->selected.push_back(static_cast<Acts::SpacePointIndex2>(i));
+    scratch->phi.push_back(std::atan2(sp.y(), sp.x()));
+    scratch->z.push_back(sp.z());
+    scratch->r.push_back(sp.r());
   }
 
-  Acts::SpacePointContainer2 coreSpacePoints(
-      Acts::SpacePointColumns::PackedXY | Acts::SpacePointColumns::PackedZR |
-      Acts::SpacePointColumns::VarianceZ | Acts::SpacePointColumns::VarianceR |
-      Acts::SpacePointColumns::CopyFromIndex);
-  coreSpacePoints.reserve(grid.numberOfSpacePoints());
-  std::vector<Acts::SpacePointIndexRange2> gridSpacePointRanges;
-  gridSpacePointRanges.reserve(grid.numberOfBins());
-  for (std::size_t i = 0; i < grid.numberOfBins(); ++i) {
-    std::uint32_t begin = coreSpacePoints.size();
-    for (Acts::SpacePointIndex2 spIndex : grid.at(i)) {
-      const ConstSpacePointProxy& sp = spacePoints[spIndex];
-
-      auto newSp = coreSpacePoints.createSpacePoint();
-      newSp.xy() = std::array<float, 2>{static_cast<float>(sp.x()),
-                                        static_cast<float>(sp.y())};
-      newSp.zr() = std::array<float, 2>{static_cast<float>(sp.z()),
-                                        static_cast<float>(sp.r())};
-      newSp.varianceZ() = static_cast<float>(sp.varianceZ());
-      newSp.varianceR() = static_cast<float>(sp.varianceR());
-      newSp.copyFromIndex() = sp.index();
-    }
-    std::uint32_t end = coreSpacePoints.size();
-    gridSpacePointRanges.emplace_back(begin, end);
+  grid.fillContiguous(scratch->phi, scratch->z, scratch->r, bins);
+
+  // copy the space points in bin order, so each bin is a contiguous range of
+  // the core container and the bin ranges can be used as they are
+  coreSpacePoints.reserve(bins.spacePoints.size());
+  for (Acts::SpacePointIndex2 index : bins.spacePoints) {
+    const ConstSpacePointProxy& sp = spacePoints[scratch->selected[index]];
+
+    auto newSp = coreSpacePoints.createSpacePoint();
+    newSp.xy() = std::array<float, 2>{static_cast<float>(sp.x()),
+                                      static_cast<float>(sp.y())};
+    newSp.zr() = std::array<float, 2>{static_cast<float>(sp.z()),
+                                      static_cast<float>(sp.r())};
+    newSp.varianceZ() = static_cast<float>(sp.varianceZ());
+    newSp.varianceR() = static_cast<float>(sp.varianceR());
+    newSp.copyFromIndex() = sp.index();
   }
+  const std::vector<Acts::SpacePointIndexRange2>& gridSpacePointRanges =
+      bins.binRanges;
 
   // Compute radius range. We rely on the fact the grid is storing the proxies
   // with a sorting in the radius
@@ -251,54 +265,99 @@ ProcessCode GridTripletSeedingAlgorithm::execute(
       std::floor(rRange.min() / 2) * 2 + m_cfg.deltaRMiddleMinSPRange,
       std::floor(rRange.max() / 2) * 2 - m_cfg.deltaRMiddleMaxSPRange};
 
-  // run the seeding
-  Acts::BroadTripletSeedFilter::State filterState;
-  Acts::BroadTripletSeedFilter::Cache filterCache;
-  Acts::BroadTripletSeedFilter seedFilter(m_filterConfig, filterState,
-                                          filterCache, *m_filterLogger);
-  static thread_local Acts::TripletSeeder::Cache cache;
+  // Seeds the bin groups [begin, end) into `outputSeeds`. Groups only depend
+  // on each other through the best seed quality of the seed filter, which is
+  // only used with seed confirmation.
+  const auto seedGroups = [&](std::size_t begin, std::size_t end,
+                              GroupBuffers& buffers,
+                              Acts::SeedContainer2& outputSeeds) {
+    buffers.filterState.bestSeedQualityMap.clear();
+    Acts::BroadTripletSeedFilter seedFilter(m_filterConfig, buffers.filterState,
+                                            buffers.filterCache,
+                                            *m_filterLogger);
+    std::vector<Acts::SpacePointContainer2::ConstRange>& bottomSpRanges =
+        buffers.bottomSpRanges;
+    std::vector<Acts::SpacePointContainer2::ConstRange>& topSpRanges =
+        buffers.topSpRanges;
+
+    for (std::size_t group = begin; group < end; ++group) {
+      const std::uint32_t middle = bins.middleBins[group];
+      ACTS_VERBOSE("Process middle " << middle);
+
+      bottomSpRanges.clear();
+      for (const auto b : bins.bottomBins(group)) {
+        bottomSpRanges.push_back(
+            coreSpacePoints.range(gridSpacePointRanges.at(b)).asConst());
+      }
+      const Acts::SpacePointContainer2::ConstRange middleSpRange =
+          coreSpacePoints.range(gridSpacePointRanges.at(middle)).asConst();
+      topSpRanges.clear();
+      for (const auto t : bins.topBins(group)) {
+        topSpRanges.push_back(
+            coreSpacePoints.range(gridSpacePointRanges.at(t)).asConst());
+      }
 
-  std::vector<Acts::SpacePointContainer2::ConstRange> bottomSpRanges;
-  std::optional<Acts::SpacePointContainer2::ConstRange> middleSpRange;
-  std::vector<Acts::SpacePointContainer2::ConstRange> topSpRanges;
+      if (middleSpRange.empty()) {
+        ACTS_DEBUG("No middle space points in this group, skipping");
+        continue;
+      }
 
+      // we compute this here since all middle space point candidates belong
+      // to the same z-bin
+      Acts::ConstSpacePointProxy2 firstMiddleSp = middleSpRange.front();
+      std::pair<float, float> radiusRangeForMiddle =
+          retrieveRadiusRangeForMiddle(firstMiddleSp, rMiddleSpRange);
+      ACTS_VERBOSE("Validity range (radius) for the middle space point is ["
+                   << radiusRangeForMiddle.first << ", "
+                   << radiusRangeForMiddle.second << "]");
+
+      m_seedFinder->createSeedsFromGroups(
+          buffers.seederCache, *bottomDoubletFinder, *topDoubletFinder,
+          *tripletFinder, seedFilter, coreSpacePoints, bottomSpRanges,
+          middleSpRange, topSpRanges, radiusRangeForMiddle, outputSeeds);
+    }
+  };
+
+  // the seeds are handed over to the event store, reserve for the largest
+  // event seen so far to avoid regrowing the columns
   Acts::SeedContainer2 seeds;
+  seeds.reserve(static_cast<Acts::SeedIndex2>(scratch->maxSeeds));
   seeds.assignSpacePointContainer(spacePoints);
 
-  for (const auto [bottom, middle, top] : grid.binnedGroup()) {
-    ACTS_VERBOSE("Process middle " << middle);
-
-    bottomSpRanges.clear();
-    for (const auto b : bottom) {
-      bottomSpRanges.push_back(
-          coreSpacePoints.range(gridSpacePointRanges.at(b)).asConst());
-    }
-    middleSpRange =
-        coreSpacePoints.range(gridSpacePointRanges.at(middle)).asConst();
-    topSpRanges.clear();
-    for (const auto t : top) {
-      topSpRanges.push_back(
-          coreSpacePoints.range(gridSpacePointRanges.at(t)).asConst());
+  // run the seeding
+  const std::size_t nGroups = bins.numberOfGroups();
+  if (!m_cfg.parallelBinGroups || m_cfg.seedConfirmation || nGroups < 2) {
+    seedGroups(0, nGroups, scratch->groupBuffers, seeds);
+  } else {
+    // more chunks than threads to balance the load. The chunk outputs are
+    // concatenated in group order which gives the seeds of the serial loop.
+    const std::size_t nChunks = std::min<std::size_t>(
+        nGroups, 4 * tbb::this_task_arena::max_concurrency());
+    std::vector<Acts::SeedContainer2>& chunkSeeds = scratch->chunkSeeds;
+    if (chunkSeeds.size() < nChunks) {
+      chunkSeeds.resize(nChunks);
     }
-
-    if (middleSpRange->empty()) {
-      ACTS_DEBUG("No middle space points in this group, skipping");
-      continue;
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nChunks, 1),
+        [&](const tbb::blocked_range<std::size_t>& chunks) {
+          auto buffers = m_groupBuffersPool.acquire();
+          for (std::size_t chunk = chunks.begin(); chunk != chunks.end();
+               ++chunk) {
+            chunkSeeds[chunk].clear();
+            seedGroups(chunk * nGroups / nChunks,
+                       (chunk + 1) * nGroups / nChunks, *buffers,
+                       chunkSeeds[chunk]);
+          }
+        });
+
+    for (std::size_t chunk = 0; chunk < nChunks; ++chunk) {
+      for (const auto chunkSeed : std::as_const(chunkSeeds[chunk])) {
+        auto seed = seeds.createSeed();
+        seed.assignSpacePointIndices(chunkSeed.spacePointIndices());
+        seed.quality() = chunkSeed.quality();
+        seed.vertexZ() = chunkSeed.vertexZ();
+      }
     }
-
-    // we compute this here since all middle space point candidates belong to
-    // the same z-bin
-    Acts::ConstSpacePointProxy2 firstMiddleSp = middleSpRange->front();
-    std::pair<float, float> radiusRangeForMiddle =
-        retrieveRadiusRangeForMiddle(firstMiddleSp, rMiddleSpRange);
-    ACTS_VERBOSE("Validity range (radius) for the middle space point is ["
-                 << radiusRangeForMiddle.first << ", "
-                 << radiusRangeForMiddle.second << "]");
-
-    m_seedFinder->createSeedsFromGroups(
-        cache, *bottomDoubletFinder, *topDoubletFinder, *tripletFinder,
-        seedFilter, coreSpacePoints, bottomSpRanges, *middleSpRange,
-        topSpRanges, radiusRangeForMiddle, seeds);
   }
 
   ACTS_DEBUG("Created " << seeds.size() << " track seeds from "
@@ -311,6 +370,25 @@ ProcessCode GridTripletSeedingAlgorithm::execute(
     }
   }
 
+  scratch->maxSeeds = std::max<std::size_t>(scratch->maxSeeds, seeds.size());
+  if (scratch->selected.size() > m_cfg.maxRetainedSpacePoints) {
+    ACTS_DEBUG("Release seeding buffers after an event with "
+               << scratch->selected.size() << " space points");
+    coreSpacePoints.clear();
+    coreSpacePoints.shrinkToFit();
+    scratch->bins = {};
+    scratch->selected = {};
+    scratch->phi = {};
+    scratch->z = {};
+    scratch->r = {};
+    scratch->chunkSeeds = {};
+    scratch->maxSeeds = 0;
+    scratch->groupBuffers = {};
+    // the pooled buffers of the parallel mode which are not in use by
+    // another event are released as well
+    m_groupBuffersPool.trim();
+  }
+
   m_outputSeeds(ctx, std::move(seeds));
   return ProcessCode::SUCCESS;
 }
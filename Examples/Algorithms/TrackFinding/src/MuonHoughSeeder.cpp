@@ -143,6 +143,7 @@ MuonHoughMaxContainer MuonHoughSeeder::constructEtaMaxima(
                                  etaHoughWidth_strip, &sp, sp.id().detLayer());
     }
   }
+  plane.finalize();
   /** Extract the maxima from the peak */
   PeakFinderCfg_t peakFinderCfg{};
   peakFinderCfg.fractionCutoff = 0.7f;
@@ -220,6 +221,7 @@ MuonHoughMaxContainer MuonHoughSeeder::extendMaximaWithPhi(
       plane.fill<MuonSpacePoint>(*sp, axisRanges, phiHoughParam_strip,
                                  phiHoughWidth_strip, sp, sp->id().detLayer());
     }
+    plane.finalize();
     const MaximumVec_t phiMaxima = peakFinder.findPeaks(plane, axisRanges);
     for (const Maximum_t& max : phiMaxima) {
       MuonHoughMaximum::HitVec hits{max.hitIdentifiers.begin(),
@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/TransformationHelpers.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Seeding/EstimateTrackParamsFromSeed.hpp"
 #include "Acts/Surfaces/Surface.hpp"
@@ -130,26 +131,45 @@ ProcessCode TrackParamsEstimationAlgorithm::execute(
       continue;
     }
 
-    // Get the magnetic field at the bottom space point
-    const auto fieldRes = m_cfg.magneticField->getField(bottomSpVec, bCache);
-    if (!fieldRes.ok()) {
-      ACTS_ERROR("Field lookup error: " << fieldRes.error());
-      return ProcessCode::ABORT;
+    const double bottomTime =
+        std::isnan(bottomSp.time()) ? 0.0 : bottomSp.time();
+
+    // Try the lookup table first, it does not need the magnetic field
+    std::optional<Acts::FreeVector> lookupParams;
+    if (m_cfg.paramsLookup != nullptr) {
+      lookupParams = m_cfg.paramsLookup->estimate(
+          ctx.geoContext, *bottomSurface, bottomSpVec, bottomTime);
+      if (!lookupParams.has_value()) {
+        ACTS_VERBOSE("No lookup estimate for seed "
+                     << iseed << ", falling back to the analytical estimate");
+      }
     }
-    const Acts::Vector3& field = *fieldRes;
 
-    if (field.norm() < m_cfg.bFieldMin) {
-      ACTS_WARNING("Magnetic field at seed " << iseed << " is too small "
-                                             << field.norm());
-      continue;
+    auto boundParams =
+        Acts::Result<Acts::BoundVector>::success(Acts::BoundVector::Zero());
+    if (lookupParams.has_value()) {
+      boundParams = Acts::transformFreeToBoundParameters(
+          *lookupParams, *bottomSurface, ctx.geoContext);
+    } else {
+      // Get the magnetic field at the bottom space point
+      const auto fieldRes = m_cfg.magneticField->getField(bottomSpVec, bCache);
+      if (!fieldRes.ok()) {
+        ACTS_ERROR("Field lookup error: " << fieldRes.error());
+        return ProcessCode::ABORT;
+      }
+      const Acts::Vector3& field = *fieldRes;
+
+      if (field.norm() < m_cfg.bFieldMin) {
+        ACTS_WARNING("Magnetic field at seed " << iseed << " is too small "
+                                               << field.norm());
+        continue;
+      }
+
+      // Estimate the track parameters from seed
+      boundParams = Acts::estimateTrackParamsFromSeed(
+          ctx.geoContext, *bottomSurface, bottomSpVec, bottomTime, middleSpVec,
+          topSpVec, field);
     }
-
-    // Estimate the track parameters from seed
-    Acts::Result<Acts::BoundVector> boundParams =
-        Acts::estimateTrackParamsFromSeed(
-            ctx.geoContext, *bottomSurface, bottomSpVec,
-            std::isnan(bottomSp.time()) ? 0.0 : bottomSp.time(), middleSpVec,
-            topSpVec, field);
     if (!boundParams.ok()) {
       ACTS_WARNING("Failed to estimate track parameters from seed: "
                    << boundParams.error().message());
@@ -0,0 +1,49 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/TrackFinding/TrackParamsLookupTable.hpp"
+
+namespace ActsExamples {
+
+Acts::TrackParamsLookupTable makeTrackParamsLookupTable(
+    const TrackParamsLookup& lookup) {
+  Acts::TrackParamsLookupTable table;
+
+  for (const auto& [geoId, grid] : lookup) {
+    Acts::TrackParamsLookupTable::SurfaceGrid surfaceGrid;
+    const auto nBins = grid.numLocalBins();
+    const auto min = grid.minPosition();
+    const auto max = grid.maxPosition();
+    for (std::size_t d = 0; d < 2; ++d) {
+      surfaceGrid.min[d] = min[d];
+      surfaceGrid.max[d] = max[d];
+      surfaceGrid.nBins[d] = nBins[d];
+    }
+    surfaceGrid.bins.assign(nBins[0] * nBins[1],
+                            Acts::TrackParamsLookupTable::BinContent::Zero());
+
+    // The grid bins are shifted by one due to the underflow bins
+    for (std::size_t i1 = 0; i1 < nBins[1]; ++i1) {
+      for (std::size_t i0 = 0; i0 < nBins[0]; ++i0) {
+        const auto& refParams = grid.atLocalBins({i0 + 1, i1 + 1}).second;
+        if (refParams == nullptr) {
+          continue;
+        }
+        auto& content = surfaceGrid.at(i0, i1);
+        content.head<3>() = refParams->direction().cast<float>().array();
+        content[3] = static_cast<float>(refParams->qOverP());
+      }
+    }
+
+    table.addGrid(geoId, std::move(surfaceGrid));
+  }
+
+  return table;
+}
+
+}  // namespace ActsExamples
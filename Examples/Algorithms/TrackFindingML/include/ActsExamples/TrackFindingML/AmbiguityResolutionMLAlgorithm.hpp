@@ -14,6 +14,8 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsPlugins/Onnx/AmbiguityTrackClassifier.hpp"
 
+#include <chrono>
+#include <optional>
 #include <string>
 
 namespace ActsExamples {
@@ -38,10 +40,28 @@ class AmbiguityResolutionMLAlgorithm final : public IAlgorithm {
     std::string outputTracks;
     /// Minimum number of measurement to form a track.
     std::size_t nMeasurementsMin = 7;
+    /// Maximum number of tracks of concurrent events that are scored
+    /// together in one inference call, 0 disables the batching.
+    std::size_t inferenceBatchSize = 0;
+    /// Maximum time in microseconds an event waits for other events to fill
+    /// the inference batch.
+    std::size_t inferenceMaxLatency = 500;
+    /// Number of intra-op threads of the batched inference session.
+    int inferenceThreads = 1;
     /// Construct the ML ambiguity resolution configuration.
     AmbiguityResolution::Config toAmbiguityResolutionMLConfig() const {
       return {inputDuplicateNN, nMeasurementsMin};
     }
+    /// Construct the batched inference configuration, if enabled.
+    std::optional<ActsPlugins::OnnxBatchInferenceService::Config>
+    toBatchInferenceConfig() const {
+      if (inferenceBatchSize == 0) {
+        return std::nullopt;
+      }
+      return ActsPlugins::OnnxBatchInferenceService::Config{
+          inferenceBatchSize, std::chrono::microseconds(inferenceMaxLatency),
+          inferenceThreads};
+    }
   };
 
   /// Construct the ambiguity resolution algorithm.
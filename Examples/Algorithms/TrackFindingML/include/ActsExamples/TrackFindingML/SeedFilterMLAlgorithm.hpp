@@ -14,6 +14,8 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsPlugins/Onnx/SeedClassifier.hpp"
 
+#include <chrono>
+#include <optional>
 #include <string>
 
 namespace ActsExamples {
@@ -51,6 +53,25 @@ class SeedFilterMLAlgorithm : public IAlgorithm {
     double clusteringWeighZ = 50.0;
     /// Clustering parameters weight for pT used before the DBSCAN
     double clusteringWeighPt = 1.0;
+    /// Maximum number of seeds of concurrent events that are scored
+    /// together in one inference call, 0 disables the batching.
+    std::size_t inferenceBatchSize = 0;
+    /// Maximum time in microseconds an event waits for other events to fill
+    /// the inference batch.
+    std::size_t inferenceMaxLatency = 500;
+    /// Number of intra-op threads of the batched inference session.
+    int inferenceThreads = 1;
+
+    /// Construct the batched inference configuration, if enabled.
+    std::optional<ActsPlugins::OnnxBatchInferenceService::Config>
+    toBatchInferenceConfig() const {
+      if (inferenceBatchSize == 0) {
+        return std::nullopt;
+      }
+      return ActsPlugins::OnnxBatchInferenceService::Config{
+          inferenceBatchSize, std::chrono::microseconds(inferenceMaxLatency),
+          inferenceThreads};
+    }
   };
 
   /// Construct the seed filter algorithm.
@@ -36,7 +36,8 @@ AmbiguityResolutionMLAlgorithm::AmbiguityResolutionMLAlgorithm(
     const Config& cfg, std::unique_ptr<const Acts::Logger> logger)
     : IAlgorithm("AmbiguityResolutionMLAlgorithm", std::move(logger)),
       m_cfg(cfg),
-      m_ambiML(m_cfg.toAmbiguityResolutionMLConfig(), this->logger().clone()) {
+      m_ambiML(m_cfg.toAmbiguityResolutionMLConfig(), this->logger().clone(),
+               m_cfg.toBatchInferenceConfig()) {
   if (m_cfg.inputTracks.empty()) {
     throw std::invalid_argument("Missing trajectories input collection");
   }
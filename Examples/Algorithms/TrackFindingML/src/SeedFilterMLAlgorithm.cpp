@@ -19,7 +19,8 @@ SeedFilterMLAlgorithm::SeedFilterMLAlgorithm(
     const Config& cfg, std::unique_ptr<const Acts::Logger> logger)
     : IAlgorithm("SeedFilterMLAlgorithm", std::move(logger)),
       m_cfg(cfg),
-      m_seedClassifier(m_cfg.inputSeedFilterNN.c_str()) {
+      m_seedClassifier(m_cfg.inputSeedFilterNN.c_str(),
+                       m_cfg.toBatchInferenceConfig()) {
   if (m_cfg.inputTrackParameters.empty()) {
     throw std::invalid_argument("Missing track parameters input collection");
   }
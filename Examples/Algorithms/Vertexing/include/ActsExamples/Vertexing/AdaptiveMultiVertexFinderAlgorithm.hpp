@@ -88,6 +88,9 @@ class AdaptiveMultiVertexFinderAlgorithm final : public IAlgorithm {
     /// Bin extent in t-direction which is only used with `AdaptiveGridSeeder`
     /// and `useTime`
     double temporalBinExtent = 19. * Acts::UnitConstants::mm;
+    /// Accumulate the track densities on a dense grid, only used with
+    /// `AdaptiveGridSeeder`
+    bool useDenseDensityMap = false;
     /// Number of simultaneous seeds that should be created by the vertex seeder
     std::size_t simultaneousSeeds = 1;
   };
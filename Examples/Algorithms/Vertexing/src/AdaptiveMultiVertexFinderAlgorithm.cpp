@@ -135,6 +135,7 @@ AdaptiveMultiVertexFinderAlgorithm::makeVertexSeeder() const {
     // Set up vertex seeder and finder
     using Seeder = Acts::AdaptiveGridDensityVertexFinder;
     Seeder::Config seederConfig(trkDensity);
+    seederConfig.useDenseDensityMap = m_cfg.useDenseDensityMap;
     seederConfig.extractParameters
         .connect<&Acts::InputTrack::extractParameters>();
     return std::make_unique<Seeder>(seederConfig);
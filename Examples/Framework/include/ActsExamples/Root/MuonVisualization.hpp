@@ -64,7 +64,8 @@ void visualizeMuonHoughMaxima(
     const std::string& outputPath, const MuonSpacePoint::MuonId& bucketId,
     const std::vector<Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
         const MuonSpacePoint*>::Maximum>& maxima,
-    const Acts::HoughTransformUtils::HoughPlane<const MuonSpacePoint*>& plane,
+    const Acts::HoughTransformUtils::CompactHoughPlane<const MuonSpacePoint*>&
+        plane,
     const Acts::HoughTransformUtils::HoughAxisRanges& axis,
     const MuonSegmentContainer& truthSegments, const Acts::Logger& logger);
 
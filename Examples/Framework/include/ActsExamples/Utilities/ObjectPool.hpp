@@ -0,0 +1,137 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Thread-safe pool of reusable objects, e.g. per-event scratch containers
+/// of an algorithm.
+///
+/// An object is handed out exclusively to one caller by `acquire` and goes
+/// back to the pool when the returned handle is destroyed. The pool never
+/// resets the objects, the caller is expected to `clear` them before use,
+/// which keeps their capacity and avoids allocations in the steady state.
+/// The pool creates as many objects as there are handles alive at the same
+/// time, e.g. one per concurrently running task that acquires one.
+///
+///     mutable ObjectPool<Scratch> m_scratchPool{...};
+///
+///     ProcessCode execute(const AlgorithmContext& ctx) const {
+///       auto scratch = m_scratchPool.acquire();
+///       scratch->buffer.clear();
+///       ...
+///     }
+///
+/// @tparam T type of the pooled objects
+template <typename T>
+class ObjectPool {
+ public:
+  /// Creates a new object if the pool is exhausted
+  using Factory = std::function<std::unique_ptr<T>()>;
+
+  /// Exclusive access to one pooled object which is returned to the pool on
+  /// destruction.
+  class Handle {
+   public:
+    Handle(const Handle&) = delete;
+    Handle(Handle&&) noexcept = default;
+    Handle& operator=(const Handle&) = delete;
+    Handle& operator=(Handle&& other) noexcept {
+      if (this != &other) {
+        release();
+        m_pool = std::exchange(other.m_pool, nullptr);
+        m_object = std::move(other.m_object);
+      }
+      return *this;
+    }
+    ~Handle() { release(); }
+
+    T& operator*() const { return *m_object; }
+    T* operator->() const { return m_object.get(); }
+    T* get() const { return m_object.get(); }
+
+   private:
+    friend class ObjectPool;
+
+    Handle(ObjectPool& pool, std::unique_ptr<T> object)
+        : m_pool(&pool), m_object(std::move(object)) {}
+
+    void release() {
+      if (m_pool != nullptr && m_object != nullptr) {
+        m_pool->giveBack(std::move(m_object));
+      }
+      m_pool = nullptr;
+    }
+
+    ObjectPool* m_pool = nullptr;
+    std::unique_ptr<T> m_object;
+  };
+
+  /// @param factory creates a new object if the pool is exhausted
+  explicit ObjectPool(Factory factory) : m_factory(std::move(factory)) {
+    assert(m_factory && "Missing object factory");
+  }
+
+  ObjectPool()
+    requires std::is_default_constructible_v<T>
+      : ObjectPool([] { return std::make_unique<T>(); }) {}
+
+  ObjectPool(const ObjectPool&) = delete;
+  ObjectPool& operator=(const ObjectPool&) = delete;
+
+  /// Take an idle object from the pool or create a new one.
+  /// @note The pool must outlive the returned handle.
+  Handle acquire() {
+    {
+      std::lock_guard lock(m_mutex);
+      if (!m_idle.empty()) {
+        std::unique_ptr<T> object = std::move(m_idle.back());
+        m_idle.pop_back();
+        return Handle(*this, std::move(object));
+      }
+    }
+    return Handle(*this, m_factory());
+  }
+
+  /// Number of objects currently waiting in the pool
+  std::size_t idle() const {
+    std::lock_guard lock(m_mutex);
+    return m_idle.size();
+  }
+
+  /// Destroy all idle objects, e.g. to give back memory after a busy period.
+  /// Objects which are currently acquired are not affected.
+  void trim() {
+    std::vector<std::unique_ptr<T>> idle;
+    {
+      std::lock_guard lock(m_mutex);
+      idle.swap(m_idle);
+    }
+  }
+
+ private:
+  void giveBack(std::unique_ptr<T> object) {
+    std::lock_guard lock(m_mutex);
+    m_idle.push_back(std::move(object));
+  }
+
+  Factory m_factory;
+  mutable std::mutex m_mutex;
+  std::vector<std::unique_ptr<T>> m_idle;
+};
+
+}  // namespace ActsExamples
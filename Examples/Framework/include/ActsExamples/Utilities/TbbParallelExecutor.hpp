@@ -0,0 +1,47 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/ParallelFor.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
+
+#include <cstddef>
+#include <functional>
+
+#include <tbb/blocked_range.h>
+#include <tbb/task_arena.h>
+
+namespace ActsExamples {
+
+/// Parallel executor running the chunks as tasks in the current TBB arena.
+///
+/// Inside the sequencer the chunks share the worker threads of the event
+/// loop instead of starting new ones. If the sequencer runs with a single
+/// thread, TBB is disabled and the chunks run on the calling thread.
+class TbbParallelExecutor final : public Acts::ParallelExecutor {
+ public:
+  std::size_t concurrency() const override {
+    return tbbWrap::enableTBB() ? static_cast<std::size_t>(
+                                      tbb::this_task_arena::max_concurrency())
+                                : 1;
+  }
+
+  void run(std::size_t nChunks,
+           const std::function<void(std::size_t)>& task) const override {
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nChunks),
+        [&](const tbb::blocked_range<std::size_t>& r) {
+          for (std::size_t chunk = r.begin(); chunk != r.end(); ++chunk) {
+            task(chunk);
+          }
+        });
+  }
+};
+
+}  // namespace ActsExamples
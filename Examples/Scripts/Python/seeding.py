@@ -51,6 +51,7 @@ def runSeeding(
     outputDir,
     s=None,
     seedingAlgorithm=SeedingAlgorithm.GridTriplet,
+    parallelBinGroups=None,
 ):
     from acts.examples.simulation import (
         addParticleGun,
@@ -112,6 +113,7 @@ def runSeeding(
         addSeeding,
         SeedFinderConfigArg,
         SeedFinderOptionsArg,
+        SeedingAlgorithmConfigArg,
     )
 
     addSeeding(
@@ -132,6 +134,9 @@ def runSeeding(
         SeedFinderOptionsArg(
             bFieldInZ=2 * u.T,
         ),
+        SeedingAlgorithmConfigArg(
+            parallelBinGroups=parallelBinGroups,
+        ),
         acts.logging.VERBOSE,
         seedingAlgorithm=seedingAlgorithm,
         geoSelectionConfigFile=srcdir / "Examples/Configs/generic-seeding-config.json",
@@ -52,6 +52,7 @@ struct DynamicColumnBase : public ConstDynamicColumnBase {
   std::any get(std::size_t i) const override = 0;
 
   virtual void add() = 0;
+  virtual void reserve(std::size_t n) = 0;
   virtual void clear() = 0;
   virtual void erase(std::size_t i) = 0;
   virtual void copyFrom(std::size_t dstIdx, const DynamicColumnBase& src,
@@ -79,6 +80,7 @@ struct DynamicColumn : public DynamicColumnBase {
   }
 
   void add() override { m_collection.vec().emplace_back(); }
+  void reserve(std::size_t n) override { m_collection.vec().reserve(n); }
   void clear() override { m_collection.clear(); }
   void erase(std::size_t i) override {
     m_collection.vec().erase(m_collection.vec().begin() + i);
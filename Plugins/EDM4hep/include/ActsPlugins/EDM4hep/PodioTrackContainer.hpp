@@ -195,18 +195,17 @@ class PodioTrackContainerBase {
   static void populateSurfaceBuffer(
       const PodioUtil::ConversionHelper& helper,
       const ActsPodioEdm::TrackCollection& collection,
-      std::vector<std::shared_ptr<const Acts::Surface>>& surfaces) noexcept {
+      podio_detail::SurfaceBuffer& surfaces) noexcept {
     surfaces.reserve(collection.size());
     for (ActsPodioEdm::Track track : collection) {
-      surfaces.push_back(PodioUtil::convertSurfaceFromPodio(
-          helper, track.getReferenceSurface()));
+      surfaces.push_back(helper, track.getReferenceSurface());
     }
   }
 
   /// Conversion helper
   std::reference_wrapper<const PodioUtil::ConversionHelper> m_helper;
   /// Surface buffer
-  std::vector<std::shared_ptr<const Acts::Surface>> m_surfaces;
+  podio_detail::SurfaceBuffer m_surfaces;
 };
 
 /// Mutable Podio-based track container implementation
@@ -250,18 +249,6 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
 
   // BEGIN INTERFACE HELPER
 
- private:
-  std::shared_ptr<const Acts::Surface> getOrCreateSurface(IndexType itrack) {
-    std::shared_ptr<const Acts::Surface>& ptr = m_surfaces.at(itrack);
-    if (!ptr) {
-      ActsPodioEdm::Track track = m_collection->at(itrack);
-      ptr = PodioUtil::convertSurfaceFromPodio(m_helper,
-                                               track.getReferenceSurface());
-    }
-    return ptr;
-  }
-
- public:
   /// Access component
   /// @param key Column key
   /// @param itrack Track index
@@ -290,7 +277,13 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
   std::size_t size_impl() const { return m_collection->size(); }
 
   /// Clear all tracks
-  void clear() { m_collection->clear(); }
+  void clear() {
+    m_collection->clear();
+    m_surfaces.clear();
+    for (const auto& [key, vec] : m_dynamic) {
+      vec->clear();
+    }
+  }
 
   // END INTERFACE HELPER
 
@@ -298,7 +291,7 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
   /// @param itrack Track index
   /// @return Reference surface pointer
   const Acts::Surface* referenceSurface_impl(IndexType itrack) const {
-    return m_surfaces.at(itrack).get();
+    return m_surfaces.at(itrack);
   }
 
   /// Get particle hypothesis
@@ -313,16 +306,8 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
   /// @param surface Reference surface
   void setReferenceSurface_impl(IndexType itrack,
                                 std::shared_ptr<const Acts::Surface> surface) {
-    auto track = m_collection->at(itrack);
-    if (surface == nullptr) {
-      track.setReferenceSurface({.surfaceType = PodioUtil::kNoSurface,
-                                 .identifier = PodioUtil::kNoIdentifier});
-      m_surfaces.at(itrack) = nullptr;
-    } else {
-      track.setReferenceSurface(
-          PodioUtil::convertSurfaceToPodio(m_helper, *surface));
-      m_surfaces.at(itrack) = std::move(surface);
-    }
+    m_collection->at(itrack).setReferenceSurface(
+        m_surfaces.set(m_helper, itrack, std::move(surface)));
   }
 
  public:
@@ -407,7 +392,14 @@ class MutablePodioTrackContainer : public PodioTrackContainerBase {
   void ensureDynamicColumns_impl(const MutablePodioTrackContainer& other);
 
   /// Reserve storage
-  void reserve(IndexType /*size*/) {}
+  /// @param size Number of tracks to reserve space for
+  void reserve(IndexType size) {
+    PodioUtil::reserve(*m_collection, size);
+    m_surfaces.reserve(size);
+    for (const auto& [key, vec] : m_dynamic) {
+      vec->reserve(size);
+    }
+  }
 
   /// Get track collection
   /// @return Track collection
@@ -541,7 +533,7 @@ class ConstPodioTrackContainer : public PodioTrackContainerBase {
   /// @param itrack Track index
   /// @return Reference surface pointer
   const Acts::Surface* referenceSurface_impl(IndexType itrack) const {
-    return m_surfaces.at(itrack).get();
+    return m_surfaces.at(itrack);
   }
 
   /// Get particle hypothesis implementation
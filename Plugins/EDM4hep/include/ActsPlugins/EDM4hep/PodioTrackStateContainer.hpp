@@ -257,11 +257,10 @@ class PodioTrackStateContainerBase {
   static void populateSurfaceBuffer(
       const PodioUtil::ConversionHelper& helper,
       const ActsPodioEdm::TrackStateCollection& collection,
-      std::vector<std::shared_ptr<const Acts::Surface>>& surfaces) noexcept {
+      podio_detail::SurfaceBuffer& surfaces) noexcept {
     surfaces.reserve(collection.size());
     for (ActsPodioEdm::TrackState trackState : collection) {
-      surfaces.push_back(PodioUtil::convertSurfaceFromPodio(
-          helper, trackState.getReferenceSurface()));
+      surfaces.push_back(helper, trackState.getReferenceSurface());
     }
   }
 };
@@ -438,7 +437,7 @@ class ConstPodioTrackStateContainer final
   /// @param istate Track state index
   /// @return Reference surface pointer
   const Acts::Surface* referenceSurface_impl(IndexType istate) const {
-    return m_surfaces.at(istate).get();
+    return m_surfaces.at(istate);
   }
 
  private:
@@ -448,7 +447,7 @@ class ConstPodioTrackStateContainer final
   holder_t<const ActsPodioEdm::TrackStateCollection> m_collection;
   holder_t<const ActsPodioEdm::BoundParametersCollection> m_params;
   holder_t<const ActsPodioEdm::JacobianCollection> m_jacs;
-  std::vector<std::shared_ptr<const Acts::Surface>> m_surfaces;
+  podio_detail::SurfaceBuffer m_surfaces;
 
   std::unordered_map<Acts::HashedString,
                      std::unique_ptr<podio_detail::ConstDynamicColumnBase>>
@@ -822,12 +821,26 @@ class MutablePodioTrackStateContainer final
   void clear_impl() {
     m_collection->clear();
     m_params->clear();
+    m_jacs->clear();
     m_surfaces.clear();
     for (const auto& [key, vec] : m_dynamic) {
       vec->clear();
     }
   }
 
+  /// Reserve space for a number of track states, in the same proportions as
+  /// @ref Acts::VectorMultiTrajectory::reserve
+  /// @param n Number of track states to reserve space for
+  void reserve(std::size_t n) {
+    PodioUtil::reserve(*m_collection, n);
+    PodioUtil::reserve(*m_params, n * 2);
+    PodioUtil::reserve(*m_jacs, n);
+    m_surfaces.reserve(n);
+    for (const auto& [key, vec] : m_dynamic) {
+      vec->reserve(n);
+    }
+  }
+
   /// Add a dynamic column
   /// @tparam T Column value type
   /// @param key Column key
@@ -889,10 +902,8 @@ class MutablePodioTrackStateContainer final
   /// @param surface Reference surface to set
   void setReferenceSurface_impl(IndexType istate,
                                 std::shared_ptr<const Acts::Surface> surface) {
-    auto trackState = m_collection->at(istate);
-    trackState.setReferenceSurface(
-        PodioUtil::convertSurfaceToPodio(m_helper, *surface));
-    m_surfaces.at(istate) = std::move(surface);
+    m_collection->at(istate).setReferenceSurface(
+        m_surfaces.set(m_helper, istate, std::move(surface)));
   }
 
   /// Get the size of the calibrated measurement
@@ -914,7 +925,7 @@ class MutablePodioTrackStateContainer final
   /// @param istate Track state index
   /// @return Pointer to the reference surface
   const Acts::Surface* referenceSurface_impl(IndexType istate) const {
-    return m_surfaces.at(istate).get();
+    return m_surfaces.at(istate);
   }
 
   /// Release collections into a podio frame
@@ -1006,7 +1017,7 @@ class MutablePodioTrackStateContainer final
   holder_t<ActsPodioEdm::TrackStateCollection> m_collection;
   holder_t<ActsPodioEdm::BoundParametersCollection> m_params;
   holder_t<ActsPodioEdm::JacobianCollection> m_jacs;
-  std::vector<std::shared_ptr<const Acts::Surface>> m_surfaces;
+  podio_detail::SurfaceBuffer m_surfaces;
 
   std::unordered_map<Acts::HashedString,
                      std::unique_ptr<podio_detail::DynamicColumnBase>>
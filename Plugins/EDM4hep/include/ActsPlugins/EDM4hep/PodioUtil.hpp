@@ -13,9 +13,12 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Utilities/HashedString.hpp"
 #include "ActsPlugins/EDM4hep/PodioDynamicColumns.hpp"
+#include "ActsPodioEdm/Surface.h"
 
 #include <limits>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include <podio/podioVersion.h>
 
@@ -30,10 +33,6 @@
 
 #include <podio/Frame.h>
 
-namespace ActsPodioEdm {
-class Surface;
-}
-
 namespace ActsPlugins {
 /// @addtogroup edm4hep_plugin
 /// @{
@@ -106,11 +105,74 @@ std::shared_ptr<const Acts::Surface> convertSurfaceFromPodio(
 
 ActsPodioEdm::Surface convertSurfaceToPodio(const ConversionHelper& helper,
                                             const Acts::Surface& surface);
+
+/// Reserve space in a podio collection, if the podio version in use allows it
+/// @param collection The collection to reserve space in
+/// @param n Number of elements to reserve space for
+template <typename collection_t>
+void reserve(collection_t& collection, std::size_t n) {
+  if constexpr (requires { collection.reserve(n); }) {
+    collection.reserve(n);
+  }
+}
 }  // namespace PodioUtil
 
 /// @}
 
 namespace podio_detail {
+
+/// Reference surfaces of the elements of a podio backed container.
+///
+/// Every element only stores a raw pointer. The ownership and the podio
+/// representation are kept once per distinct surface until the buffer is
+/// cleared, so assigning the same surface to many elements neither holds a
+/// shared pointer per element nor converts the surface again.
+class SurfaceBuffer {
+ public:
+  /// @return Number of elements
+  std::size_t size() const { return m_surfaces.size(); }
+
+  /// @param n Number of elements to reserve space for
+  void reserve(std::size_t n) { m_surfaces.reserve(n); }
+
+  /// Append an element without a surface
+  void emplace_back() { m_surfaces.push_back(nullptr); }
+
+  /// Append an element with a surface read from podio
+  /// @param helper Conversion helper
+  /// @param surface Podio representation of the surface
+  void push_back(const PodioUtil::ConversionHelper& helper,
+                 const ActsPodioEdm::Surface& surface);
+
+  /// @param i Element index
+  /// @return Surface of the element, nullptr if it has none
+  const Acts::Surface* at(std::size_t i) const { return m_surfaces.at(i); }
+
+  /// Set the surface of an element
+  /// @param helper Conversion helper
+  /// @param i Element index
+  /// @param surface The surface, can be nullptr
+  /// @return Podio representation of @p surface
+  const ActsPodioEdm::Surface& set(
+      const PodioUtil::ConversionHelper& helper, std::size_t i,
+      std::shared_ptr<const Acts::Surface> surface);
+
+  /// Remove all elements and release the surfaces
+  void clear() {
+    m_surfaces.clear();
+    m_owned.clear();
+  }
+
+ private:
+  struct Entry {
+    std::shared_ptr<const Acts::Surface> surface;
+    ActsPodioEdm::Surface podio;
+  };
+
+  std::vector<const Acts::Surface*> m_surfaces;
+  std::unordered_map<const Acts::Surface*, Entry> m_owned;
+};
+
 /// This is used by both the track and track state container, so the
 /// implementation is shared here
 void recoverDynamicColumns(
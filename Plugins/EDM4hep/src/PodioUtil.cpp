@@ -209,6 +209,39 @@ std::shared_ptr<const Surface> convertSurfaceFromPodio(
 }  // namespace PodioUtil
 namespace podio_detail {
 
+void SurfaceBuffer::push_back(const PodioUtil::ConversionHelper& helper,
+                              const ActsPodioEdm::Surface& surface) {
+  std::shared_ptr<const Surface> converted =
+      PodioUtil::convertSurfaceFromPodio(helper, surface);
+  const Surface* ptr = converted.get();
+  if (ptr != nullptr) {
+    m_owned.try_emplace(ptr, Entry{std::move(converted), surface});
+  }
+  m_surfaces.push_back(ptr);
+}
+
+const ActsPodioEdm::Surface& SurfaceBuffer::set(
+    const PodioUtil::ConversionHelper& helper, std::size_t i,
+    std::shared_ptr<const Surface> surface) {
+  static const ActsPodioEdm::Surface noSurface{
+      .surfaceType = PodioUtil::kNoSurface,
+      .identifier = PodioUtil::kNoIdentifier};
+
+  const Surface* ptr = surface.get();
+  m_surfaces.at(i) = ptr;
+  if (ptr == nullptr) {
+    return noSurface;
+  }
+
+  auto it = m_owned.find(ptr);
+  if (it == m_owned.end()) {
+    ActsPodioEdm::Surface converted =
+        PodioUtil::convertSurfaceToPodio(helper, *ptr);
+    it = m_owned.emplace(ptr, Entry{std::move(surface), converted}).first;
+  }
+  return it->second.podio;
+}
+
 template <typename F, typename... Args>
 void apply(F&& f, TypeList<Args...> /*unused*/) {
   f(Args{}...);
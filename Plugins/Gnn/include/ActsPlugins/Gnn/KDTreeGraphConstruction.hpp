@@ -0,0 +1,74 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+#include "ActsPlugins/Gnn/Stages.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace ActsPlugins {
+/// @addtogroup gnn_plugin
+/// @{
+
+/// CPU graph construction with a radius search in a k-d tree
+///
+/// Connects all pairs of nodes that are closer than @c Config::rVal in a
+/// scaled three-dimensional subspace of the node features. The nodes are
+/// searched with an @c Acts::KDTree and the queries can be split into chunks
+/// run by an @c Acts::ParallelExecutor. Each pair is emitted once, from the
+/// lower to the higher node index. The edge index is returned in COO format,
+/// i.e. as a [2, numEdges] tensor of source and target nodes, since that is
+/// what all following pipeline stages expect. The edges are sorted by source
+/// and then by target node, so the target row already is the CSR column
+/// array and the source row compresses directly to CSR row offsets.
+///
+/// On the CPU the node feature tensor is a non-owning view on the input
+/// values, which must stay alive as long as the returned tensors are used.
+class KDTreeGraphConstruction final : public GraphConstructionBase {
+ public:
+  /// Configuration for the k-d tree graph construction
+  struct Config {
+    /// Node feature indices used as coordinates for the search
+    std::array<std::size_t, 3> selectedFeatures = {0, 1, 2};
+    /// Scaling factors applied to the selected features
+    std::array<float, 3> featureScales = {1.f, 1.f, 1.f};
+    /// Radius of the search in the scaled feature space
+    float rVal = 0.1;
+    /// Optional executor running the neighbour search, see
+    /// @c Acts::parallelFor
+    std::shared_ptr<const Acts::ParallelExecutor> executor;
+  };
+
+  /// Constructor
+  /// @param cfg Configuration parameters
+  /// @param logger Logging instance
+  KDTreeGraphConstruction(const Config &cfg,
+                          std::unique_ptr<const Acts::Logger> logger);
+
+  PipelineTensors operator()(std::vector<float> &inputValues,
+                             std::size_t numNodes,
+                             const std::vector<std::uint64_t> &moduleIds,
+                             const ExecutionContext &execContext = {}) override;
+
+  /// Get the configuration
+  /// @return Configuration object
+  const Config &config() const { return m_cfg; }
+
+ private:
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+  const auto &logger() const { return *m_logger; }
+};
+
+/// @}
+}  // namespace ActsPlugins
@@ -118,6 +118,19 @@ class Tensor {
     return Tensor(shape, std::move(ptr), execContext);
   }
 
+  /// @brief Create a non-owning tensor view on existing memory
+  /// @param data Pointer to the first element of the row-major data
+  /// @param shape 2D tensor dimensions [rows, columns]
+  /// @param execContext Execution context describing where @p data resides
+  /// @note The caller must keep the memory alive as long as the view and all
+  /// tensors moved from it are in use
+  /// @return Tensor referring to @p data without taking ownership
+  static Tensor Wrap(T *data, Shape shape,
+                     const ExecutionContext &execContext) {
+    detail::TensorPtr ptr(data, [](void *) {});
+    return Tensor(shape, std::move(ptr), execContext);
+  }
+
   /// Clone the tensor, copying the data to the new device
   /// @param to The {device, stream} to clone to
   /// @note This is a always a deep copy, even if the source and destination are the
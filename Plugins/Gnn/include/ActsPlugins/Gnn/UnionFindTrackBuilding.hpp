@@ -0,0 +1,60 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+#include "ActsPlugins/Gnn/Stages.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace ActsPlugins {
+/// @addtogroup gnn_plugin
+/// @{
+
+/// CPU track building with a concurrent union-find on the edge list
+///
+/// The connected components of the graph given by the edge index are
+/// computed with a lock-free disjoint-set forest, where the edges can be
+/// split into chunks run by an @c Acts::ParallelExecutor. Components are
+/// returned in the order of their smallest node index, so the output is
+/// deterministic.
+class UnionFindTrackBuilding final : public TrackBuildingBase {
+ public:
+  /// Configuration for the union-find track building
+  struct Config {
+    /// Optional executor used to process the edges
+    std::shared_ptr<const Acts::ParallelExecutor> executor;
+    /// Minimum candidate size, smaller components are dropped
+    std::size_t minCandidateSize = 1;
+  };
+
+  /// Constructor
+  /// @param cfg Configuration object
+  /// @param logger Logger instance
+  UnionFindTrackBuilding(const Config &cfg,
+                         std::unique_ptr<const Acts::Logger> logger)
+      : m_cfg(cfg), m_logger(std::move(logger)) {}
+
+  std::vector<std::vector<int>> operator()(
+      PipelineTensors tensors, std::vector<int> &spacePointIDs,
+      const ExecutionContext &execContext = {}) override;
+  /// Get configuration
+  /// @return Configuration object
+  const Config &config() const { return m_cfg; }
+
+ private:
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+  const auto &logger() const { return *m_logger; }
+};
+
+/// @}
+}  // namespace ActsPlugins
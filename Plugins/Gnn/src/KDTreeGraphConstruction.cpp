@@ -0,0 +1,144 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsPlugins/Gnn/KDTreeGraphConstruction.hpp"
+
+#include "Acts/Utilities/KDTree.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace Acts;
+
+namespace ActsPlugins {
+
+KDTreeGraphConstruction::KDTreeGraphConstruction(
+    const Config &cfg, std::unique_ptr<const Logger> logger)
+    : m_cfg(cfg), m_logger(std::move(logger)) {
+  if (!(m_cfg.rVal > 0.f)) {
+    throw std::invalid_argument("KDTreeGraphConstruction: rVal must be > 0");
+  }
+}
+
+PipelineTensors KDTreeGraphConstruction::operator()(
+    std::vector<float> &inputValues, std::size_t numNodes,
+    const std::vector<std::uint64_t> & /*moduleIds*/,
+    const ExecutionContext &execContext) {
+  ACTS_DEBUG("Start graph construction");
+
+  if (numNodes == 0 || inputValues.size() % numNodes != 0) {
+    throw std::invalid_argument(
+        "KDTreeGraphConstruction: input size is not a multiple of the number "
+        "of nodes");
+  }
+  const std::size_t numFeatures = inputValues.size() / numNodes;
+  if (std::ranges::max(m_cfg.selectedFeatures) >= numFeatures) {
+    throw std::invalid_argument(
+        "KDTreeGraphConstruction: selected feature index out of range");
+  }
+  ACTS_DEBUG("Build graph for " << numNodes << " nodes with " << numFeatures
+                                << " features");
+
+  using Tree = KDTree<3, std::size_t, float, std::array, 4>;
+
+  Tree::vector_t points;
+  points.reserve(numNodes);
+  for (std::size_t i = 0; i < numNodes; ++i) {
+    const float *node = inputValues.data() + i * numFeatures;
+    Tree::coordinate_t position{};
+    for (std::size_t dim = 0; dim < 3; ++dim) {
+      position[dim] =
+          node[m_cfg.selectedFeatures[dim]] * m_cfg.featureScales[dim];
+    }
+    points.emplace_back(position, i);
+  }
+  // Keep the coordinates indexed by node, the tree reorders its copy
+  std::vector<Tree::coordinate_t> positions(numNodes);
+  for (const auto &[position, i] : points) {
+    positions[i] = position;
+  }
+  const Tree tree(std::move(points));
+
+  // Each chunk of nodes collects the targets of its nodes in node order, so
+  // concatenating the chunks yields the edges sorted by source node
+  const float r2 = m_cfg.rVal * m_cfg.rVal;
+  const std::size_t maxChunks = maxParallelChunks(m_cfg.executor.get());
+  std::vector<std::vector<std::int64_t>> chunkTargets(maxChunks);
+  std::vector<std::vector<std::int64_t>> chunkSources(maxChunks);
+
+  auto searchNeighbours = [&](std::size_t chunk, std::size_t begin,
+                              std::size_t end) {
+    auto &targets = chunkTargets[chunk];
+    auto &sources = chunkSources[chunk];
+    for (std::size_t i = begin; i < end; ++i) {
+      const Tree::coordinate_t &center = positions[i];
+      Tree::range_t range;
+      for (std::size_t dim = 0; dim < 3; ++dim) {
+        range[dim] = Range1D<float>(center[dim] - m_cfg.rVal,
+                                    center[dim] + m_cfg.rVal);
+      }
+
+      const std::size_t first = targets.size();
+      tree.rangeSearchMapDiscard(
+          range, [&](const Tree::coordinate_t &pos, const std::size_t &j) {
+            if (j <= i) {
+              return;
+            }
+            float d2 = 0.f;
+            for (std::size_t dim = 0; dim < 3; ++dim) {
+              d2 += (pos[dim] - center[dim]) * (pos[dim] - center[dim]);
+            }
+            if (d2 <= r2) {
+              targets.push_back(j);
+            }
+          });
+      std::sort(targets.begin() + first, targets.end());
+      sources.resize(targets.size(), i);
+    }
+  };
+  const std::size_t nChunks =
+      parallelFor(m_cfg.executor.get(), numNodes, searchNeighbours, 256);
+
+  std::vector<std::size_t> chunkOffsets(nChunks + 1, 0);
+  for (std::size_t chunk = 0; chunk < nChunks; ++chunk) {
+    chunkOffsets[chunk + 1] =
+        chunkOffsets[chunk] + chunkTargets[chunk].size();
+  }
+  const std::size_t numEdges = chunkOffsets.back();
+  ACTS_DEBUG("Built " << numEdges << " edges");
+
+  if (numEdges == 0) {
+    throw NoEdgesError{};
+  }
+
+  const ExecutionContext cpuContext{Device::Cpu(), execContext.stream};
+  auto edgeIndex = Tensor<std::int64_t>::Create({2, numEdges}, cpuContext);
+  for (std::size_t chunk = 0; chunk < nChunks; ++chunk) {
+    std::ranges::copy(chunkSources[chunk],
+                      edgeIndex.data() + chunkOffsets[chunk]);
+    std::ranges::copy(chunkTargets[chunk],
+                      edgeIndex.data() + numEdges + chunkOffsets[chunk]);
+  }
+
+  // The node features are handed on without copying them. The view stays
+  // valid because GnnPipeline::run keeps the input values alive until all
+  // stages have finished, as TorchMetricLearning relies on as well.
+  auto nodeFeatures = Tensor<float>::Wrap(inputValues.data(),
+                                          {numNodes, numFeatures}, cpuContext);
+
+  if (execContext.device.isCpu()) {
+    return {std::move(nodeFeatures), std::move(edgeIndex), std::nullopt,
+            std::nullopt};
+  }
+  return {nodeFeatures.clone(execContext), edgeIndex.clone(execContext),
+          std::nullopt, std::nullopt};
+}
+
+}  // namespace ActsPlugins
@@ -0,0 +1,143 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsPlugins/Gnn/UnionFindTrackBuilding.hpp"
+
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using vertex_t = std::int64_t;
+
+/// Find the root of @p x, halving the path on the way
+vertex_t findRoot(std::vector<std::atomic<vertex_t>>& parent, vertex_t x) {
+  while (true) {
+    vertex_t p = parent[x].load(std::memory_order_relaxed);
+    if (p == x) {
+      return x;
+    }
+    vertex_t gp = parent[p].load(std::memory_order_relaxed);
+    if (p != gp) {
+      // Only ever points a node to one of its ancestors, so a lost update
+      // is harmless
+      parent[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+    }
+    x = gp;
+  }
+}
+
+/// Merge the sets of @p a and @p b. The root with the larger index is always
+/// attached to the one with the smaller index, which keeps the forest acyclic
+/// under concurrent updates and makes each root the smallest node of its set.
+void unite(std::vector<std::atomic<vertex_t>>& parent, vertex_t a, vertex_t b) {
+  while (true) {
+    a = findRoot(parent, a);
+    b = findRoot(parent, b);
+    if (a == b) {
+      return;
+    }
+    if (a > b) {
+      std::swap(a, b);
+    }
+    vertex_t expected = b;
+    if (parent[b].compare_exchange_strong(expected, a,
+                                          std::memory_order_acq_rel)) {
+      return;
+    }
+  }
+}
+
+}  // namespace
+
+namespace ActsPlugins {
+
+std::vector<std::vector<int>> UnionFindTrackBuilding::operator()(
+    PipelineTensors tensors, std::vector<int>& spacePointIds,
+    const ExecutionContext& execContext) {
+  ACTS_DEBUG("Start track building");
+
+  using RTI = const Tensor<std::int64_t>&;
+  const auto& edgeTensor = tensors.edgeIndex.device().isCpu()
+                               ? static_cast<RTI>(tensors.edgeIndex)
+                               : static_cast<RTI>(tensors.edgeIndex.clone(
+                                     {Device::Cpu(), execContext.stream}));
+
+  assert(edgeTensor.shape().at(0) == 2);
+
+  const auto numSpacePoints = spacePointIds.size();
+  const auto numEdges = edgeTensor.shape().at(1);
+
+  if (numEdges == 0) {
+    ACTS_WARNING("No edges remained after edge classification");
+    return {};
+  }
+
+  const vertex_t* rows = edgeTensor.data();
+  const vertex_t* cols = edgeTensor.data() + numEdges;
+
+  std::vector<std::atomic<vertex_t>> parent(numSpacePoints);
+  for (std::size_t i = 0; i < numSpacePoints; ++i) {
+    parent[i].store(i, std::memory_order_relaxed);
+  }
+
+  auto uniteEdges = [&](std::size_t /*chunk*/, std::size_t begin,
+                        std::size_t end) {
+    for (std::size_t e = begin; e < end; ++e) {
+      if (rows[e] < 0 || cols[e] < 0 ||
+          static_cast<std::size_t>(std::max(rows[e], cols[e])) >=
+              numSpacePoints) {
+        throw std::out_of_range("Edge index exceeds the number of nodes");
+      }
+      unite(parent, rows[e], cols[e]);
+    }
+  };
+  Acts::parallelFor(m_cfg.executor.get(), numEdges, uniteEdges, 1024);
+
+  // Flatten the forest, every node points directly to its root afterwards
+  std::vector<vertex_t> roots(numSpacePoints);
+  auto findRoots = [&](std::size_t /*chunk*/, std::size_t begin,
+                       std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      roots[i] = findRoot(parent, i);
+    }
+  };
+  Acts::parallelFor(m_cfg.executor.get(), numSpacePoints, findRoots,
+                    1024);
+
+  // Roots are the smallest node of their component, so a single forward pass
+  // assigns consecutive labels in order of the first node
+  std::vector<vertex_t> labels(numSpacePoints, -1);
+  std::vector<std::vector<int>> trackCandidates;
+  for (std::size_t i = 0; i < numSpacePoints; ++i) {
+    auto& label = labels[roots[i]];
+    if (label < 0) {
+      label = trackCandidates.size();
+      trackCandidates.emplace_back();
+    }
+    trackCandidates[label].push_back(spacePointIds[i]);
+  }
+
+  ACTS_VERBOSE("Number of unique track labels: " << trackCandidates.size());
+
+  if (m_cfg.minCandidateSize > 1) {
+    std::erase_if(trackCandidates, [&](const auto& candidate) {
+      return candidate.size() < m_cfg.minCandidateSize;
+    });
+  }
+
+  return trackCandidates;
+}
+
+}  // namespace ActsPlugins
@@ -14,9 +14,12 @@
 #include "Acts/EventData/TrackProxyConcept.hpp"
 #include "Acts/TrackFinding/detail/AmbiguityTrackClustering.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
+#include "ActsPlugins/Onnx/OnnxBatchInferenceService.hpp"
 #include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
 
 #include <map>
+#include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -34,7 +37,28 @@ class AmbiguityTrackClassifier {
   /// @param modelPath path to the model file
   explicit AmbiguityTrackClassifier(const char* modelPath)
       : m_env(ORT_LOGGING_LEVEL_WARNING, "MLClassifier"),
-        m_duplicateClassifier(m_env, modelPath) {}
+        m_duplicateClassifier(
+            std::make_unique<OnnxRuntimeBase>(m_env, modelPath)) {}
+
+  /// Construct the scoring algorithm with optional batched inference.
+  ///
+  /// If a batching configuration is given, the tracks of concurrent events
+  /// are scored together by a shared @c OnnxBatchInferenceService.
+  ///
+  /// @param modelPath path to the model file
+  /// @param batchCfg configuration of the batched inference, if any
+  AmbiguityTrackClassifier(
+      const char* modelPath,
+      const std::optional<OnnxBatchInferenceService::Config>& batchCfg)
+      : m_env(ORT_LOGGING_LEVEL_WARNING, "MLClassifier") {
+    if (batchCfg.has_value()) {
+      m_batchService = std::make_unique<OnnxBatchInferenceService>(
+          m_env, modelPath, *batchCfg);
+    } else {
+      m_duplicateClassifier =
+          std::make_unique<OnnxRuntimeBase>(m_env, modelPath);
+    }
+  }
 
   /// Compute a score for each track to be used in the track selection
   ///
@@ -73,8 +97,7 @@ class AmbiguityTrackClassifier {
       }
     }
     // Use the network to compute a score for all the tracks.
-    std::vector<std::vector<float>> outputTensor =
-        m_duplicateClassifier.runONNXInference(networkInput);
+    std::vector<std::vector<float>> outputTensor = runInference(networkInput);
     return outputTensor;
   }
 
@@ -106,10 +129,21 @@ class AmbiguityTrackClassifier {
   }
 
  private:
+  /// Run the network on the input, batched with other events if enabled
+  std::vector<std::vector<float>> runInference(
+      NetworkBatchInput& networkInput) const {
+    if (m_batchService != nullptr) {
+      return m_batchService->runONNXInference(networkInput);
+    }
+    return m_duplicateClassifier->runONNXInference(networkInput);
+  }
+
   // ONNX environment
   Ort::Env m_env;
   // ONNX model for the duplicate neural network
-  OnnxRuntimeBase m_duplicateClassifier;
+  std::unique_ptr<OnnxRuntimeBase> m_duplicateClassifier;
+  // Batched inference service, replaces the model above if enabled
+  std::unique_ptr<OnnxBatchInferenceService> m_batchService;
 };
 
 /// @}
@@ -0,0 +1,122 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <onnxruntime_cxx_api.h>
+
+namespace ActsPlugins {
+/// @addtogroup onnx_plugin
+/// @{
+
+/// Inference service that merges requests from concurrent callers into
+/// larger batches before they are sent to the ONNX runtime.
+///
+/// Each call to @c runONNXInference enqueues its input rows and blocks
+/// until the result is available. A dedicated worker thread collects the
+/// pending requests until either @c Config::maxBatchSize rows are queued or
+/// the oldest request has waited for @c Config::maxLatency, stacks them into
+/// a single input tensor, runs the model once and scatters the output rows
+/// back to the callers. The model must have a single input with a dynamic
+/// first (batch) dimension and return one output row per input row.
+class OnnxBatchInferenceService {
+ public:
+  /// Configuration of the batching behaviour
+  struct Config {
+    /// Maximum number of input rows merged into one inference call. A
+    /// single request larger than this is still run as one call.
+    std::size_t maxBatchSize = 4096;
+    /// Maximum time the oldest pending request waits for further requests
+    std::chrono::microseconds maxLatency{500};
+    /// Number of intra-op threads of the ONNX session, 0 lets the runtime
+    /// decide
+    int intraOpThreads = 1;
+  };
+
+  /// Inference backend called once per merged batch
+  using InferenceFunction =
+      std::function<std::vector<std::vector<float>>(NetworkBatchInput&)>;
+
+  /// Create the service and start the worker thread
+  ///
+  /// @param env the ONNX runtime environment, must outlive the service
+  /// @param modelPath the path to the ML model in *.onnx format
+  /// @param cfg the batching configuration
+  OnnxBatchInferenceService(Ort::Env& env, const char* modelPath,
+                            const Config& cfg);
+
+  /// Create the service around a custom inference backend and start the
+  /// worker thread
+  ///
+  /// @param inference the backend, called on the worker thread only
+  /// @param cfg the batching configuration, @c intraOpThreads is unused
+  OnnxBatchInferenceService(InferenceFunction inference, const Config& cfg);
+
+  OnnxBatchInferenceService(const OnnxBatchInferenceService&) = delete;
+  OnnxBatchInferenceService& operator=(const OnnxBatchInferenceService&) =
+      delete;
+
+  /// Stop the worker thread after all pending requests have been served
+  ~OnnxBatchInferenceService();
+
+  /// Run the inference for a batch of input rows
+  ///
+  /// This is thread-safe; concurrent callers may be served by the same
+  /// inference call.
+  ///
+  /// @param inputTensorValues the input feature values, one row per entry
+  ///
+  /// @return The output (predicted) values, one vector per input row
+  std::vector<std::vector<float>> runONNXInference(
+      const NetworkBatchInput& inputTensorValues) const;
+
+  /// Const access to the configuration
+  /// @return the batching configuration
+  const Config& config() const { return m_cfg; }
+
+ private:
+  struct Request {
+    const NetworkBatchInput* input = nullptr;
+    std::promise<std::vector<std::vector<float>>> output;
+    std::chrono::steady_clock::time_point enqueued;
+  };
+
+  void start();
+
+  void processRequests();
+
+  void runBatch(std::vector<Request>& batch) const;
+
+  Config m_cfg;
+  std::unique_ptr<OnnxRuntimeBase> m_session;
+  InferenceFunction m_inference;
+
+  mutable std::mutex m_mutex;
+  mutable std::condition_variable m_condition;
+  mutable std::deque<Request> m_queue;
+  mutable std::size_t m_queuedRows = 0;
+  bool m_stop = false;
+
+  std::thread m_worker;
+};
+
+/// @}
+}  // namespace ActsPlugins
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -34,6 +35,14 @@ class OnnxRuntimeBase {
   /// @param modelPath the path to the ML model in *.onnx format
   OnnxRuntimeBase(Ort::Env& env, const char* modelPath);
 
+  /// @brief Parametrized constructor with explicit session options
+  ///
+  /// @param env the ONNX runtime environment
+  /// @param modelPath the path to the ML model in *.onnx format
+  /// @param sessionOptions the options used to create the ONNX session
+  OnnxRuntimeBase(Ort::Env& env, const char* modelPath,
+                  const Ort::SessionOptions& sessionOptions);
+
   /// @brief Default destructor
   ~OnnxRuntimeBase() = default;
 
@@ -61,6 +70,13 @@ class OnnxRuntimeBase {
   std::vector<std::vector<std::vector<float>>> runONNXInferenceMultiOutput(
       NetworkBatchInput& inputTensorValues) const;
 
+  /// @brief Check whether the first input dimension is dynamic
+  ///
+  /// @return true if the model accepts an arbitrary number of input rows
+  bool hasDynamicBatchSize() const {
+    return !m_inputNodeDims.empty() && m_inputNodeDims[0] == -1;
+  }
+
  private:
   /// ONNX runtime session / model properties
   std::unique_ptr<Ort::Session> m_session;
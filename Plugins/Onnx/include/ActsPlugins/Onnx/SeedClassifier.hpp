@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include "ActsPlugins/Onnx/OnnxBatchInferenceService.hpp"
 #include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
 
+#include <memory>
+#include <optional>
 #include <vector>
 
 #include <onnxruntime_cxx_api.h>
@@ -26,7 +29,28 @@ class SeedClassifier {
   /// @param modelPath path to the model file
   explicit SeedClassifier(const char* modelPath)
       : m_env(ORT_LOGGING_LEVEL_WARNING, "MLSeedClassifier"),
-        m_duplicateClassifier(m_env, modelPath) {};
+        m_duplicateClassifier(
+            std::make_unique<OnnxRuntimeBase>(m_env, modelPath)) {}
+
+  /// Construct the scoring algorithm with optional batched inference.
+  ///
+  /// If a batching configuration is given, the seeds of concurrent events
+  /// are scored together by a shared @c OnnxBatchInferenceService.
+  ///
+  /// @param modelPath path to the model file
+  /// @param batchCfg configuration of the batched inference, if any
+  SeedClassifier(
+      const char* modelPath,
+      const std::optional<OnnxBatchInferenceService::Config>& batchCfg)
+      : m_env(ORT_LOGGING_LEVEL_WARNING, "MLSeedClassifier") {
+    if (batchCfg.has_value()) {
+      m_batchService = std::make_unique<OnnxBatchInferenceService>(
+          m_env, modelPath, *batchCfg);
+    } else {
+      m_duplicateClassifier =
+          std::make_unique<OnnxRuntimeBase>(m_env, modelPath);
+    }
+  }
 
   /// Compute a score for each seed to be used in the seed selection
   ///
@@ -35,8 +59,7 @@ class SeedClassifier {
   std::vector<std::vector<float>> inferScores(
       NetworkBatchInput& networkInput) const {
     // Use the network to compute a score for all the Seeds.
-    std::vector<std::vector<float>> outputTensor =
-        m_duplicateClassifier.runONNXInference(networkInput);
+    std::vector<std::vector<float>> outputTensor = runInference(networkInput);
     return outputTensor;
   }
 
@@ -85,10 +108,21 @@ class SeedClassifier {
   }
 
  private:
+  /// Run the network on the input, batched with other events if enabled
+  std::vector<std::vector<float>> runInference(
+      NetworkBatchInput& networkInput) const {
+    if (m_batchService != nullptr) {
+      return m_batchService->runONNXInference(networkInput);
+    }
+    return m_duplicateClassifier->runONNXInference(networkInput);
+  }
+
   // ONNX environment
   Ort::Env m_env;
   // ONNX model for the duplicate neural network
-  OnnxRuntimeBase m_duplicateClassifier;
+  std::unique_ptr<OnnxRuntimeBase> m_duplicateClassifier;
+  // Batched inference service, replaces the model above if enabled
+  std::unique_ptr<OnnxBatchInferenceService> m_batchService;
 };
 
 /// @}
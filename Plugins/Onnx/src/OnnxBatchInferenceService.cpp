@@ -0,0 +1,176 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsPlugins/Onnx/OnnxBatchInferenceService.hpp"
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+Ort::SessionOptions makeSessionOptions(
+    const ActsPlugins::OnnxBatchInferenceService::Config& cfg) {
+  Ort::SessionOptions sessionOptions;
+  sessionOptions.SetGraphOptimizationLevel(
+      GraphOptimizationLevel::ORT_ENABLE_BASIC);
+  sessionOptions.SetIntraOpNumThreads(cfg.intraOpThreads);
+  return sessionOptions;
+}
+
+}  // namespace
+
+ActsPlugins::OnnxBatchInferenceService::OnnxBatchInferenceService(
+    Ort::Env& env, const char* modelPath, const Config& cfg)
+    : m_cfg(cfg),
+      m_session(std::make_unique<OnnxRuntimeBase>(env, modelPath,
+                                                   makeSessionOptions(cfg))) {
+  if (!m_session->hasDynamicBatchSize()) {
+    throw std::invalid_argument(
+        "OnnxBatchInferenceService: the model needs a dynamic batch "
+        "dimension");
+  }
+  m_inference = [session = m_session.get()](NetworkBatchInput& input) {
+    return session->runONNXInference(input);
+  };
+  start();
+}
+
+ActsPlugins::OnnxBatchInferenceService::OnnxBatchInferenceService(
+    InferenceFunction inference, const Config& cfg)
+    : m_cfg(cfg), m_inference(std::move(inference)) {
+  if (!m_inference) {
+    throw std::invalid_argument(
+        "OnnxBatchInferenceService: missing inference function");
+  }
+  start();
+}
+
+void ActsPlugins::OnnxBatchInferenceService::start() {
+  if (m_cfg.maxBatchSize == 0) {
+    throw std::invalid_argument(
+        "OnnxBatchInferenceService: maximum batch size must be positive");
+  }
+  m_worker = std::thread([this] { processRequests(); });
+}
+
+ActsPlugins::OnnxBatchInferenceService::~OnnxBatchInferenceService() {
+  {
+    std::lock_guard lock(m_mutex);
+    m_stop = true;
+  }
+  m_condition.notify_all();
+  m_worker.join();
+}
+
+std::vector<std::vector<float>>
+ActsPlugins::OnnxBatchInferenceService::runONNXInference(
+    const NetworkBatchInput& inputTensorValues) const {
+  if (inputTensorValues.rows() == 0) {
+    return {};
+  }
+
+  std::future<std::vector<std::vector<float>>> result;
+  {
+    std::lock_guard lock(m_mutex);
+    Request& request = m_queue.emplace_back();
+    request.input = &inputTensorValues;
+    request.enqueued = std::chrono::steady_clock::now();
+    result = request.output.get_future();
+    m_queuedRows += inputTensorValues.rows();
+  }
+  m_condition.notify_all();
+
+  return result.get();
+}
+
+void ActsPlugins::OnnxBatchInferenceService::processRequests() {
+  std::vector<Request> batch;
+
+  std::unique_lock lock(m_mutex);
+  while (true) {
+    m_condition.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+    if (m_queue.empty()) {
+      // Only reached when stopping with nothing left to do
+      return;
+    }
+
+    // Give other events the chance to add their rows until the batch is full
+    // or the oldest request has used up its latency budget
+    auto deadline = m_queue.front().enqueued + m_cfg.maxLatency;
+    m_condition.wait_until(lock, deadline, [this] {
+      return m_stop || m_queuedRows >= m_cfg.maxBatchSize;
+    });
+
+    // Take requests from the front of the queue as long as they fit into the
+    // batch and have the same number of features. The first request is always
+    // taken, even if it exceeds the batch size on its own.
+    std::size_t nRows = 0;
+    const Eigen::Index nCols = m_queue.front().input->cols();
+    while (!m_queue.empty()) {
+      const NetworkBatchInput& input = *m_queue.front().input;
+      if (!batch.empty() &&
+          (input.cols() != nCols ||
+           nRows + input.rows() > m_cfg.maxBatchSize)) {
+        break;
+      }
+      nRows += input.rows();
+      m_queuedRows -= input.rows();
+      batch.push_back(std::move(m_queue.front()));
+      m_queue.pop_front();
+    }
+
+    lock.unlock();
+    runBatch(batch);
+    batch.clear();
+    lock.lock();
+  }
+}
+
+void ActsPlugins::OnnxBatchInferenceService::runBatch(
+    std::vector<Request>& batch) const {
+  try {
+    // Stack the inputs of all requests into one tensor
+    Eigen::Index nRows = 0;
+    for (const Request& request : batch) {
+      nRows += request.input->rows();
+    }
+    NetworkBatchInput input(nRows, batch.front().input->cols());
+    Eigen::Index row = 0;
+    for (const Request& request : batch) {
+      input.middleRows(row, request.input->rows()) = *request.input;
+      row += request.input->rows();
+    }
+    std::vector<std::vector<float>> output = m_inference(input);
+    if (output.size() != static_cast<std::size_t>(nRows)) {
+      throw std::runtime_error(
+          "OnnxBatchInferenceService: the model returned " +
+          std::to_string(output.size()) + " rows for " +
+          std::to_string(nRows) + " input rows");
+    }
+
+    // Scatter the output rows back to the requests in input order
+    auto it = output.begin();
+    for (Request& request : batch) {
+      auto end = it + request.input->rows();
+      request.output.set_value(std::vector<std::vector<float>>(
+          std::make_move_iterator(it), std::make_move_iterator(end)));
+      it = end;
+    }
+  } catch (...) {
+    // Forward the failure to every caller waiting on this batch
+    for (Request& request : batch) {
+      try {
+        request.output.set_exception(std::current_exception());
+      } catch (const std::future_error&) {
+        // The result has already been delivered to this request
+      }
+    }
+  }
+}
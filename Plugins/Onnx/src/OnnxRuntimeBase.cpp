@@ -11,14 +11,28 @@
 #include <cassert>
 #include <stdexcept>
 
-// Parametrized constructor
-ActsPlugins::OnnxRuntimeBase::OnnxRuntimeBase(Ort::Env& env,
-                                              const char* modelPath) {
+namespace {
+
+Ort::SessionOptions makeDefaultSessionOptions() {
   // Set the ONNX runtime session options
   Ort::SessionOptions sessionOptions;
   // Set graph optimization level
   sessionOptions.SetGraphOptimizationLevel(
       GraphOptimizationLevel::ORT_ENABLE_BASIC);
+  return sessionOptions;
+}
+
+}  // namespace
+
+// Parametrized constructor
+ActsPlugins::OnnxRuntimeBase::OnnxRuntimeBase(Ort::Env& env,
+                                              const char* modelPath)
+    : OnnxRuntimeBase(env, modelPath, makeDefaultSessionOptions()) {}
+
+// Parametrized constructor with explicit session options
+ActsPlugins::OnnxRuntimeBase::OnnxRuntimeBase(
+    Ort::Env& env, const char* modelPath,
+    const Ort::SessionOptions& sessionOptions) {
   // Create the Ort session
   m_session = std::make_unique<Ort::Session>(env, modelPath, sessionOptions);
   // Default allocator
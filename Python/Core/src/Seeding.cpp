@@ -7,9 +7,14 @@
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "Acts/Seeding/SeedConfirmationRangeConfig.hpp"
+#include "Acts/Seeding/TrackParamsLookupTable.hpp"
 #include "ActsPython/Utilities/Helpers.hpp"
 #include "ActsPython/Utilities/Macros.hpp"
 
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -31,5 +36,24 @@ void addSeeding(py::module_& m) {
                        seedConfMaxZOrigin, minImpactSeedConf);
     patchKwargsConstructor(c);
   }
+
+  {
+    py::class_<TrackParamsLookupTable,
+               std::shared_ptr<TrackParamsLookupTable>>(
+        m, "TrackParamsLookupTable")
+        .def(py::init<>())
+        .def_property_readonly("size", &TrackParamsLookupTable::size)
+        .def_static(
+            "fromFile",
+            [](const std::string& path) {
+              std::ifstream ifs(path, std::ios::in | std::ios::binary);
+              if (!ifs) {
+                throw std::runtime_error("Could not open " + path);
+              }
+              return std::make_shared<TrackParamsLookupTable>(
+                  TrackParamsLookupTable::fromBinaryStream(ifs));
+            },
+            py::arg("path"));
+  }
 }
 }  // namespace ActsPython
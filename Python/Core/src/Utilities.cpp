@@ -12,6 +12,7 @@
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/Histogram.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/RangeXD.hpp"
 
 #include <cmath>
@@ -93,6 +94,12 @@ void addUtilities(py::module_& m) {
     py::class_<CalibrationContext>(m, "CalibrationContext").def(py::init<>());
   }
 
+  {
+    py::class_<ParallelExecutor, std::shared_ptr<ParallelExecutor>>(
+        m, "ParallelExecutor")
+        .def_property_readonly("concurrency", &ParallelExecutor::concurrency);
+  }
+
   // Add l ogging infrastructure
   {
     auto logging = m.def_submodule("logging", "");
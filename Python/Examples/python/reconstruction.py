@@ -123,8 +123,9 @@ SeedingAlgorithmConfigArg = namedtuple(
         "zBinNeighborsBottom",
         "numPhiNeighbors",
         "useExtraCuts",
+        "parallelBinGroups",
     ],
-    defaults=[None] * 5,
+    defaults=[None] * 6,
 )
 
 TruthEstimatedSeedingAlgorithmConfigArg = namedtuple(
@@ -960,6 +961,7 @@ def addGridTripletSeeding(
             maxQualitySeedsPerSpMConf=seedFilterConfigArg.maxQualitySeedsPerSpMConf,
             useDeltaRinsteadOfTopRadius=seedFilterConfigArg.useDeltaRorTopRadius,
             useExtraCuts=seedingAlgorithmConfigArg.useExtraCuts,
+            parallelBinGroups=seedingAlgorithmConfigArg.parallelBinGroups,
         ),
     )
     sequence.addAlgorithm(seedingAlg)
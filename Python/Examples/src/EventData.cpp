@@ -12,6 +12,13 @@
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsPython/Utilities/WhiteBoardRegistry.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl_bind.h>
@@ -28,6 +35,107 @@ using namespace ActsExamples;
 
 namespace ActsPython {
 
+namespace {
+
+/// Mark a numpy array as non-writeable and return it
+template <typename array_t>
+array_t readOnly(array_t arr) {
+  arr.attr("flags").attr("writeable") = py::bool_(false);
+  return arr;
+}
+
+/// Zero-copy read-only view of a contiguous column
+template <typename T>
+py::array_t<T> columnArray(std::span<const T> column, const py::object& base) {
+  if (column.empty()) {
+    return readOnly(py::array_t<T>(py::ssize_t{0}));
+  }
+  return readOnly(py::array_t<T>({static_cast<py::ssize_t>(column.size())},
+                                 {static_cast<py::ssize_t>(sizeof(T))},
+                                 column.data(), base));
+}
+
+/// Zero-copy read-only view of a strided track state column
+template <typename T>
+py::array_t<T> columnArray(
+    const Acts::detail_vmt::VectorMultiTrajectoryBase::ColumnView<T>& column,
+    const py::object& base) {
+  if (column.size == 0) {
+    return readOnly(py::array_t<T>(py::ssize_t{0}));
+  }
+  return readOnly(py::array_t<T>({static_cast<py::ssize_t>(column.size)},
+                                 {static_cast<py::ssize_t>(column.stride)},
+                                 column.data, base));
+}
+
+/// Zero-copy view of contiguous bound parameter vectors with shape (N, 6).
+/// The strides account for potential Eigen alignment padding between entries.
+template <typename container_t>
+py::array_t<double> boundParametersArray(const container_t& params,
+                                         const py::object& base) {
+  using Coefficients = typename container_t::value_type;
+  const auto N = static_cast<py::ssize_t>(params.size());
+  if (N == 0) {
+    return readOnly(py::array_t<double>({N, py::ssize_t{6}}));
+  }
+  return readOnly(py::array_t<double>(
+      {N, py::ssize_t{6}},
+      {static_cast<py::ssize_t>(sizeof(Coefficients)),
+       static_cast<py::ssize_t>(sizeof(double))},
+      params[0].data(), base));
+}
+
+/// Zero-copy view of contiguous bound covariance matrices with shape
+/// (N, 6, 6). arr[k, i, j] is row i, column j of the k-th column-major matrix.
+template <typename container_t>
+py::array_t<double> boundCovarianceArray(const container_t& covs,
+                                         const py::object& base) {
+  using Covariance = typename container_t::value_type;
+  const auto N = static_cast<py::ssize_t>(covs.size());
+  if (N == 0) {
+    return readOnly(py::array_t<double>({N, py::ssize_t{6}, py::ssize_t{6}}));
+  }
+  constexpr py::ssize_t dbl = sizeof(double);
+  return readOnly(py::array_t<double>(
+      {N, py::ssize_t{6}, py::ssize_t{6}},
+      {static_cast<py::ssize_t>(sizeof(Covariance)), dbl, 6 * dbl},
+      covs[0].data(), base));
+}
+
+/// Zero-copy view of a dynamic column of a vector backend. The value types
+/// are tried in order until the column type matches.
+template <typename... value_ts, typename backend_t>
+std::optional<py::array> findDynamicColumn(const backend_t& backend,
+                                           Acts::HashedString key,
+                                           const py::object& base) {
+  std::optional<py::array> result;
+  (... || [&]() {
+    if (auto column = backend.template dynamicColumnData<value_ts>(key)) {
+      result = columnArray(*column, base);
+      return true;
+    }
+    return false;
+  }());
+  return result;
+}
+
+template <typename backend_t>
+py::array dynamicColumnArray(const backend_t& backend, const std::string& name,
+                             const py::object& base) {
+  auto result =
+      findDynamicColumn<float, double, std::int8_t, std::int16_t, std::int32_t,
+                        std::int64_t, std::uint8_t, std::uint16_t,
+                        std::uint32_t, std::uint64_t>(
+          backend, Acts::hashStringDynamic(name), base);
+  if (!result.has_value()) {
+    throw py::key_error("No dynamic column '" + name +
+                        "' with an arithmetic value type");
+  }
+  return *result;
+}
+
+}  // namespace
+
 void addEventData(py::module& mex) {
   py::class_<Acts::TrackStateType>(mex, "TrackStateTypeFlags")
       .def_property_readonly("isMeasurement",
@@ -132,30 +240,94 @@ void addEventData(py::module& mex) {
                                      },
                                      py::keep_alive<0, 1>()));
 
-  // Mark a numpy array as non-writeable and return it.
-  const auto readOnly = [](auto arr) {
-    arr.attr("flags").attr("writeable") = py::bool_(false);
-    return arr;
-  };
-
   // Factory for zero-copy 1-D views over a plain SoA column.
   // `accessor` is called with the backend and must return a const-ref to the
   // desired std::vector member.  dtype and stride are derived automatically.
-  const auto col1D = [&readOnly](auto accessor) {
-    return [accessor, &readOnly](const py::object& self_py) {
+  const auto col1D = [](auto accessor) {
+    return [accessor](const py::object& self_py) {
       const auto& backend =
           self_py.cast<const ConstTrackContainer&>().container();
-      const auto N = static_cast<py::ssize_t>(backend.size_impl());
       const auto& vec = accessor(backend);
       using T = typename std::decay_t<decltype(vec)>::value_type;
-      if (N == 0) {
-        return readOnly(py::array_t<T>(py::ssize_t{0}));
-      }
-      return readOnly(py::array_t<T>({N}, {static_cast<py::ssize_t>(sizeof(T))},
-                                     vec.data(), self_py));
+      return columnArray(std::span<const T>(vec), self_py);
+    };
+  };
+
+  // Zero-copy strided 1-D view over a track state column
+  const auto stateCol1D = [](auto getColumn) {
+    return [getColumn](const py::object& self_py) {
+      return columnArray(
+          getColumn(self_py.cast<const Acts::ConstVectorMultiTrajectory&>()),
+          self_py);
     };
   };
 
+  py::class_<Acts::ConstVectorMultiTrajectory>(mex,
+                                               "ConstVectorMultiTrajectory")
+      .def("__len__", &Acts::ConstVectorMultiTrajectory::size)
+
+      // Zero-copy numpy array views of the track state columns, indexed by
+      // track state. The arrays are read-only and keep the track states alive.
+      .def_property_readonly("previous",
+                             stateCol1D([](const auto& mtj) {
+                               return mtj.previousColumn();
+                             }))
+      .def_property_readonly(
+          "chi2",
+          stateCol1D([](const auto& mtj) { return mtj.chi2Column(); }))
+      .def_property_readonly(
+          "pathLength",
+          stateCol1D([](const auto& mtj) { return mtj.pathLengthColumn(); }))
+      .def_property_readonly(
+          "typeFlags",
+          stateCol1D([](const auto& mtj) { return mtj.typeFlagsColumn(); }))
+
+      // Row of the predicted, filtered and smoothed parameters of each track
+      // state in `parametersPool` and `covariancePool`, `kTrackIndexInvalid`
+      // if the state does not have the component
+      .def_property_readonly("predictedIndex",
+                             stateCol1D([](const auto& mtj) {
+                               return mtj.parametersIndexColumn(
+                                   Acts::TrackStatePropMask::Predicted);
+                             }))
+      .def_property_readonly("filteredIndex",
+                             stateCol1D([](const auto& mtj) {
+                               return mtj.parametersIndexColumn(
+                                   Acts::TrackStatePropMask::Filtered);
+                             }))
+      .def_property_readonly("smoothedIndex",
+                             stateCol1D([](const auto& mtj) {
+                               return mtj.parametersIndexColumn(
+                                   Acts::TrackStatePropMask::Smoothed);
+                             }))
+
+      // shape (P, 6) and (P, 6, 6), float64
+      .def_property_readonly(
+          "parametersPool",
+          [](const py::object& self_py) {
+            return boundParametersArray(
+                self_py.cast<const Acts::ConstVectorMultiTrajectory&>()
+                    .parametersPool(),
+                self_py);
+          })
+      .def_property_readonly(
+          "covariancePool",
+          [](const py::object& self_py) {
+            return boundCovarianceArray(
+                self_py.cast<const Acts::ConstVectorMultiTrajectory&>()
+                    .covariancePool(),
+                self_py);
+          })
+
+      .def(
+          "dynamicColumn",
+          [](const py::object& self_py, const std::string& name) {
+            return dynamicColumnArray(
+                self_py.cast<const Acts::ConstVectorMultiTrajectory&>(), name,
+                self_py);
+          },
+          py::arg("name"));
+
   auto constTrackContainer =
       py::classh<ConstTrackContainer>(mex, "ConstTrackContainer")
           .def("__len__", &ConstTrackContainer::size)
@@ -175,43 +347,24 @@ void addEventData(py::module& mex) {
           // padding between entries.
           .def_property_readonly(
               "parameters",
-              [&readOnly](const py::object& self_py) -> py::array_t<double> {
-                using CoeffsType = Acts::detail_tsp::FixedSizeTypes<
-                    Acts::eBoundSize>::Coefficients;
-                const auto& backend =
-                    self_py.cast<const ConstTrackContainer&>().container();
-                const auto N = static_cast<py::ssize_t>(backend.size_impl());
-                if (N == 0) {
-                  return readOnly(py::array_t<double>({N, py::ssize_t{6}}));
-                }
-                return readOnly(py::array_t<double>(
-                    {N, py::ssize_t{6}},
-                    {static_cast<py::ssize_t>(sizeof(CoeffsType)),
-                     static_cast<py::ssize_t>(sizeof(double))},
-                    backend.m_params[0].data(), self_py));
+              [](const py::object& self_py) {
+                return boundParametersArray(
+                    self_py.cast<const ConstTrackContainer&>()
+                        .container()
+                        .m_params,
+                    self_py);
               })
 
           // shape (N, 6, 6), float64, column-major sub-matrices (Eigen
           // default). arr[k, i, j] is row i, column j of track k's covariance.
           .def_property_readonly(
               "covariance",
-              [&readOnly](const py::object& self_py) -> py::array_t<double> {
-                using CovType = Acts::detail_tsp::FixedSizeTypes<
-                    Acts::eBoundSize>::Covariance;
-                const auto& backend =
-                    self_py.cast<const ConstTrackContainer&>().container();
-                const auto N = static_cast<py::ssize_t>(backend.size_impl());
-                if (N == 0) {
-                  return readOnly(
-                      py::array_t<double>({N, py::ssize_t{6}, py::ssize_t{6}}));
-                }
-                // Eigen column-major: row stride = 1 double, col stride = 6
-                // doubles.
-                constexpr py::ssize_t dbl = sizeof(double);
-                return readOnly(py::array_t<double>(
-                    {N, py::ssize_t{6}, py::ssize_t{6}},
-                    {static_cast<py::ssize_t>(sizeof(CovType)), dbl, 6 * dbl},
-                    backend.m_cov[0].data(), self_py));
+              [](const py::object& self_py) {
+                return boundCovarianceArray(
+                    self_py.cast<const ConstTrackContainer&>()
+                        .container()
+                        .m_cov,
+                    self_py);
               })
 
           .def_property_readonly(
@@ -232,7 +385,57 @@ void addEventData(py::module& mex) {
               col1D([](const auto& b) -> const auto& { return b.m_chi2; }))
           .def_property_readonly("ndf", col1D([](const auto& b) -> const auto& {
                                    return b.m_ndf;
-                                 }));
+                                 }))
+
+          // Zero-copy view of a column added with `addColumn`, for columns
+          // holding arithmetic values other than bool
+          .def(
+              "dynamicColumn",
+              [](const py::object& self_py, const std::string& name) {
+                return dynamicColumnArray(
+                    self_py.cast<const ConstTrackContainer&>().container(),
+                    name, self_py);
+              },
+              py::arg("name"))
+
+          // Track states of all tracks, owned by the track container
+          .def_property_readonly(
+              "trackStateContainer",
+              [](const ConstTrackContainer& self)
+                  -> const Acts::ConstVectorMultiTrajectory& {
+                return self.trackStateContainer();
+              },
+              py::return_value_policy::reference_internal)
+
+          // CSR layout of the track states of all tracks: returns the arrays
+          // (offsets, indices) where the track states of track i, from the
+          // first to the last one, are indices[offsets[i]:offsets[i + 1]]
+          .def("trackStateIndices", [](const ConstTrackContainer& self) {
+            const auto& tipIndex = self.container().m_tipIndex;
+            const auto previous = self.trackStateContainer().previousColumn();
+
+            py::array_t<Acts::TrackIndexType> offsets(
+                static_cast<py::ssize_t>(tipIndex.size() + 1));
+            auto* offsetsData = offsets.mutable_data();
+            offsetsData[0] = 0;
+            std::vector<Acts::TrackIndexType> indices;
+            indices.reserve(previous.size);
+            for (std::size_t i = 0; i < tipIndex.size(); ++i) {
+              const std::size_t first = indices.size();
+              for (auto istate = tipIndex[i];
+                   istate != Acts::kTrackIndexInvalid;
+                   istate = previous.data[istate]) {
+                indices.push_back(istate);
+              }
+              std::reverse(indices.begin() + first, indices.end());
+              offsetsData[i + 1] =
+                  static_cast<Acts::TrackIndexType>(indices.size());
+            }
+            return py::make_tuple(
+                offsets, py::array_t<Acts::TrackIndexType>(
+                             static_cast<py::ssize_t>(indices.size()),
+                             indices.data()));
+          });
 
   WhiteBoardRegistry::registerClass(constTrackContainer);
 
@@ -17,6 +17,7 @@
 #include "ActsExamples/Framework/SequenceElement.hpp"
 #include "ActsExamples/Framework/Sequencer.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/TbbParallelExecutor.hpp"
 #include "ActsPython/Utilities/Macros.hpp"
 #include "ActsPython/Utilities/WhiteBoardRegistry.hpp"
 
@@ -477,6 +478,10 @@ void addFramework(py::module& mex) {
         .def(py::init<>())
         .def_readwrite("seed", &RandomNumbers::Config::seed);
   }
+
+  py::class_<TbbParallelExecutor, ParallelExecutor,
+             std::shared_ptr<TbbParallelExecutor>>(mex, "TbbParallelExecutor")
+      .def(py::init<>());
 }
 
 }  // namespace ActsPython
@@ -23,6 +23,7 @@
 #include "ActsExamples/Io/Obj/ObjSimHitWriter.hpp"
 #include "ActsExamples/Io/Obj/ObjTrackingGeometryWriter.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
+#include "ActsExamples/TrackFinding/BinaryTrackParamsLookupWriter.hpp"
 #include "ActsExamples/TrackFinding/ITrackParamsLookupWriter.hpp"
 #include "ActsPython/Utilities/Macros.hpp"
 
@@ -154,6 +155,23 @@ void addOutput(py::module& mex) {
   py::class_<ITrackParamsLookupWriter,
              std::shared_ptr<ITrackParamsLookupWriter>>(
       mex, "ITrackParamsLookupWriter");
+
+  {
+    using IWriter = ITrackParamsLookupWriter;
+    using Writer = BinaryTrackParamsLookupWriter;
+    using Config = Writer::Config;
+
+    auto cls = py::class_<Writer, IWriter, std::shared_ptr<Writer>>(
+                   mex, "BinaryTrackParamsLookupWriter")
+                   .def(py::init<const Config&>(), py::arg("config"))
+                   .def("writeLookup", &Writer::writeLookup)
+                   .def_property_readonly("config", &Writer::config);
+
+    auto c = py::class_<Config>(cls, "Config")
+                 .def(py::init<>())
+                 .def(py::init<const std::string&>(), py::arg("path"));
+    ACTS_PYTHON_STRUCT(c, path);
+  }
 }
 
 }  // namespace ActsPython
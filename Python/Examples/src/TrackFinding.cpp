@@ -60,7 +60,8 @@ void addTrackFinding(py::module& mex) {
       zOriginWeightFactor, maxSeedsPerSpM, compatSeedLimit, seedWeightIncrement,
       numSeedIncrement, seedConfirmation, centralSeedConfirmationRange,
       forwardSeedConfirmationRange, maxSeedsPerSpMConf,
-      maxQualitySeedsPerSpMConf, useDeltaRinsteadOfTopRadius, useExtraCuts);
+      maxQualitySeedsPerSpMConf, useDeltaRinsteadOfTopRadius, useExtraCuts,
+      maxRetainedSpacePoints, parallelBinGroups);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(
       OrthogonalTripletSeedingAlgorithm, mex,
@@ -83,7 +84,7 @@ void addTrackFinding(py::module& mex) {
     auto c =
         py::class_<Config>(mex, "GraphBasedSeedingConfig").def(py::init<>());
     ACTS_PYTHON_STRUCT(c, minPt, connectorInputFile, nMaxPhiSlice,
-                       lutInputFile);
+                       lutInputFile, executor);
     patchKwargsConstructor(c);
   }
 
@@ -114,9 +115,9 @@ void addTrackFinding(py::module& mex) {
       TrackParamsEstimationAlgorithm, mex, "TrackParamsEstimationAlgorithm",
       inputSeeds, inputProtoTracks, inputParticleHypotheses,
       outputTrackParameters, outputSeeds, outputProtoTracks, trackingGeometry,
-      magneticField, bFieldMin, initialSigmas, initialSigmaQoverPt,
-      initialSigmaPtRel, initialVarInflation, noTimeVarInflation,
-      particleHypothesis);
+      magneticField, paramsLookup, bFieldMin, initialSigmas,
+      initialSigmaQoverPt, initialSigmaPtRel, initialVarInflation,
+      noTimeVarInflation, particleHypothesis);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(
       TrackParamsLookupEstimation, mex, "TrackParamsLookupEstimation",
@@ -314,7 +314,8 @@ PYBIND11_MODULE(ActsExamplesPythonBindingsRoot, root) {
           const std::vector<
               Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
                   const MuonSpacePoint*>::Maximum>&,
-          const Acts::HoughTransformUtils::HoughPlane<const MuonSpacePoint*>&,
+          const Acts::HoughTransformUtils::CompactHoughPlane<
+              const MuonSpacePoint*>&,
           const Acts::HoughTransformUtils::HoughAxisRanges&,
           const MuonSegmentContainer&, const Acts::Logger&)>(
           visualizeMuonHoughMaxima);
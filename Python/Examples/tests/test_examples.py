@@ -238,6 +238,36 @@ def test_seeding(tmp_path, trk_geo, field, assert_root_hash):
     assert_csv_output(csv, "particles_simulated")
 
 
+def test_seeding_parallel_bin_groups(tmp_path, trk_geo, field):
+    from seeding import runSeeding
+    from helpers.hash_root import hash_root_file
+
+    field = acts.ConstantBField(acts.Vector3(0, 0, 2 * acts.UnitConstants.T))
+
+    hashes = {}
+    for parallelBinGroups in [False, True]:
+        outputDir = tmp_path / f"parallel_{parallelBinGroups}"
+        (outputDir / "csv").mkdir(parents=True)
+
+        # several threads are needed for the bin groups to run as TBB tasks
+        seq = Sequencer(events=10, numThreads=4)
+        runSeeding(
+            trk_geo,
+            field,
+            outputDir=str(outputDir),
+            s=seq,
+            parallelBinGroups=parallelBinGroups,
+        ).run()
+
+        fp = outputDir / "estimatedparams.root"
+        assert fp.exists()
+        assert_has_entries(fp, "estimatedparams")
+        hashes[parallelBinGroups] = hash_root_file(fp)
+
+    # the seeds of the parallel bin groups are identical to the serial ones
+    assert hashes[True] == hashes[False]
+
+
 @pytest.mark.slow
 @pytest.mark.skipif(not hashingSeedingEnabled, reason="HashingSeeding not set up")
 def test_hashing_seeding(tmp_path, trk_geo, field, assert_root_hash):
@@ -295,6 +295,30 @@ def test_python_track_state_access(generic_detector_config, tmp_path):
                     for fwd, rev in zip(fwd_predicted, reversed(rev_predicted)):
                         assert all(fwd[i] == pytest.approx(rev[i]) for i in range(6))
 
+                # bulk track state columns must match the per-proxy accessors
+                states = tracks.trackStateContainer
+                offsets, indices = tracks.trackStateIndices()
+                assert len(offsets) == len(tracks) + 1
+                assert len(indices) == offsets[-1]
+                predicted_index = states.predictedIndex
+                parameters_pool = states.parametersPool
+                for track in tracks:
+                    track_indices = indices[
+                        offsets[track.index] : offsets[track.index + 1]
+                    ]
+                    proxies = list(track.trackStates)
+                    assert len(track_indices) == len(proxies)
+                    assert track_indices[-1] == tracks.tipIndex[track.index]
+                    for istate, state in zip(track_indices, proxies):
+                        assert states.pathLength[istate] == pytest.approx(
+                            state.pathLength
+                        )
+                        if state.hasPredicted:
+                            assert np.allclose(
+                                [state.predicted[i] for i in range(6)],
+                                parameters_pool[predicted_index[istate]],
+                            )
+
                 return acts.examples.ProcessCode.SUCCESS
 
         seq.addAlgorithm(TrackStateAccess())
@@ -9,12 +9,14 @@
 #include "ActsPlugins/Gnn/BoostTrackBuilding.hpp"
 #include "ActsPlugins/Gnn/CudaTrackBuilding.hpp"
 #include "ActsPlugins/Gnn/GnnPipeline.hpp"
+#include "ActsPlugins/Gnn/KDTreeGraphConstruction.hpp"
 #include "ActsPlugins/Gnn/ModuleMapCuda.hpp"
 #include "ActsPlugins/Gnn/OnnxEdgeClassifier.hpp"
 #include "ActsPlugins/Gnn/TensorRTEdgeClassifier.hpp"
 #include "ActsPlugins/Gnn/TorchEdgeClassifier.hpp"
 #include "ActsPlugins/Gnn/TorchMetricLearning.hpp"
 #include "ActsPlugins/Gnn/TruthGraphMetricsHook.hpp"
+#include "ActsPlugins/Gnn/UnionFindTrackBuilding.hpp"
 #include "ActsPython/Utilities/Macros.hpp"
 
 #include <boost/preprocessor/if.hpp>
@@ -65,6 +67,13 @@ PYBIND11_MODULE(ActsPluginsPythonBindingsGnn, gnn) {
 
   ACTS_PYTHON_DECLARE_GNN_STAGE(BoostTrackBuilding, TrackBuildingBase, gnn);
 
+  ACTS_PYTHON_DECLARE_GNN_STAGE(UnionFindTrackBuilding, TrackBuildingBase, gnn,
+                                executor, minCandidateSize);
+
+  ACTS_PYTHON_DECLARE_GNN_STAGE(KDTreeGraphConstruction, GraphConstructionBase,
+                                gnn, selectedFeatures, featureScales, rVal,
+                                executor);
+
 #ifdef ACTS_GNN_TORCH_BACKEND
   ACTS_PYTHON_DECLARE_GNN_STAGE(TorchMetricLearning, GraphConstructionBase, gnn,
                                 modelPath, selectedFeatures, embeddingDim, rVal,
@@ -0,0 +1,801 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/SeedContainer2.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/SpacePointContainer2.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MultiEigenStepperLoop.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Seeding2/BroadTripletSeedFilter.hpp"
+#include "Acts/Seeding2/CylindricalSpacePointGrid2.hpp"
+#include "Acts/Seeding2/DoubletSeedFinder.hpp"
+#include "Acts/Seeding2/TripletSeedFinder.hpp"
+#include "Acts/Seeding2/TripletSeeder.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/TrackStateCreator.hpp"
+#include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+#include "Acts/TrackFitting/GainMatrixSmoother.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/TrackFitting/GaussianSumFitter.hpp"
+#include "Acts/TrackFitting/GsfMixtureReduction.hpp"
+#include "Acts/TrackFitting/GsfOptions.hpp"
+#include "Acts/TrackFitting/KalmanFitter.hpp"
+#include "Acts/Utilities/AnnealingUtility.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/GridBinFinder.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
+#include "Acts/Vertexing/GaussianTrackDensity.hpp"
+#include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/TrackDensityVertexFinder.hpp"
+#include "Acts/Vertexing/Vertex.hpp"
+#include "Acts/Vertexing/VertexingOptions.hpp"
+#include "ActsTests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "ActsTests/CommonHelpers/MeasurementsCreator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <new>
+#include <numbers>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+using namespace Acts;
+using namespace Acts::detail::Test;
+using namespace Acts::UnitLiterals;
+
+// Count every allocation that goes through the global operator new, so the
+// report can track allocation regressions next to the timing. Allocations
+// that bypass operator new (e.g. Eigen's aligned malloc) are not counted.
+namespace {
+std::atomic<std::uint64_t> s_numAllocations{0};
+std::atomic<std::uint64_t> s_numAllocatedBytes{0};
+}  // namespace
+
+void* operator new(std::size_t size) {
+  s_numAllocations.fetch_add(1, std::memory_order_relaxed);
+  s_numAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size); ptr != nullptr) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+  return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+using TrackContainerType =
+    TrackContainer<VectorTrackContainer, VectorMultiTrajectory,
+                   detail::ValueHolder>;
+using TrackStateBackend = TrackContainerType::TrackStateContainerBackend;
+
+using Stepper = EigenStepper<>;
+using NavigatingPropagator = Propagator<Stepper, Navigator>;
+using GsfPropagator = Propagator<MultiEigenStepperLoop<>, Navigator>;
+using VertexingPropagator = Propagator<Stepper>;
+
+using Ckf = CombinatorialKalmanFilter<NavigatingPropagator, TrackContainerType>;
+using Kf = KalmanFitter<NavigatingPropagator, VectorMultiTrajectory>;
+using Gsf = GaussianSumFitter<GsfPropagator, VectorMultiTrajectory>;
+
+using SourceLinkMultimap =
+    std::unordered_multimap<GeometryIdentifier, TestSourceLink>;
+
+/// Source link accessor for the CKF on top of a geometry keyed multimap
+struct SourceLinkAccessor {
+  struct Iterator {
+    using BaseIterator = SourceLinkMultimap::const_iterator;
+
+    using iterator_category = BaseIterator::iterator_category;
+    using value_type = BaseIterator::value_type;
+    using difference_type = BaseIterator::difference_type;
+    using pointer = BaseIterator::pointer;
+    using reference = BaseIterator::reference;
+
+    Iterator& operator++() {
+      ++m_iterator;
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return m_iterator == other.m_iterator;
+    }
+
+    SourceLink operator*() const { return SourceLink{m_iterator->second}; }
+
+    BaseIterator m_iterator;
+  };
+
+  const SourceLinkMultimap* container = nullptr;
+
+  std::pair<Iterator, Iterator> range(const Surface& surface) const {
+    auto [begin, end] = container->equal_range(surface.geometryId());
+    return {Iterator{begin}, Iterator{end}};
+  }
+};
+
+using TrackStateCreatorType =
+    TrackStateCreator<SourceLinkAccessor::Iterator, TrackContainerType>;
+
+/// Benchmark options
+struct Options {
+  std::size_t events = 20;
+  std::size_t warmup = 2;
+  std::size_t vertices = 5;
+  std::size_t tracksPerVertex = 20;
+  std::uint32_t seed = 42;
+  std::string output;
+  unsigned int lvl = Logging::FATAL;
+};
+
+/// Generated input of one event
+struct Event {
+  /// True particle parameters at the production vertex
+  std::vector<BoundTrackParameters> truth;
+  /// Smeared start parameters for track finding and fitting
+  std::vector<BoundTrackParameters> start;
+};
+
+/// Work done by one stage in one event
+struct StageCount {
+  /// Number of input objects processed by the stage
+  std::size_t items = 0;
+  /// Number of output objects produced by the stage
+  std::size_t outputs = 0;
+};
+
+/// Accumulated measurements of one reconstruction stage
+struct StageReport {
+  std::string name;
+  /// Wall-clock latency per event in seconds
+  std::vector<double> latencies;
+  std::size_t items = 0;
+  std::size_t outputs = 0;
+  std::uint64_t allocations = 0;
+  std::uint64_t allocatedBytes = 0;
+
+  /// Run @p stage once, and record its cost if @p record is set
+  template <typename stage_t>
+  void run(bool record, stage_t&& stage) {
+    const std::uint64_t allocationsBefore =
+        s_numAllocations.load(std::memory_order_relaxed);
+    const std::uint64_t bytesBefore =
+        s_numAllocatedBytes.load(std::memory_order_relaxed);
+    const auto start = std::chrono::steady_clock::now();
+    const StageCount count = stage();
+    const auto stop = std::chrono::steady_clock::now();
+    if (!record) {
+      return;
+    }
+    latencies.push_back(std::chrono::duration<double>(stop - start).count());
+    items += count.items;
+    outputs += count.outputs;
+    allocations +=
+        s_numAllocations.load(std::memory_order_relaxed) - allocationsBefore;
+    allocatedBytes +=
+        s_numAllocatedBytes.load(std::memory_order_relaxed) - bytesBefore;
+  }
+};
+
+/// Nearest-rank percentile of already sorted @p values
+double percentile(const std::vector<double>& sorted, double fraction) {
+  if (sorted.empty()) {
+    return 0;
+  }
+  const auto rank = static_cast<std::size_t>(
+      std::ceil(fraction * static_cast<double>(sorted.size())));
+  return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+
+/// Write the report as a JSON document. The key layout is kept stable so
+/// consecutive runs can be compared by regression tracking scripts.
+void writeJson(std::ostream& os, const Options& opts,
+               const std::vector<StageReport>& stages) {
+  const double nEvents = static_cast<double>(opts.events);
+  os << "{\n";
+  os << "  \"benchmark\": \"ReconstructionChain\",\n";
+  os << "  \"config\": {\n";
+  os << "    \"events\": " << opts.events << ",\n";
+  os << "    \"warmup\": " << opts.warmup << ",\n";
+  os << "    \"vertices\": " << opts.vertices << ",\n";
+  os << "    \"tracksPerVertex\": " << opts.tracksPerVertex << ",\n";
+  os << "    \"seed\": " << opts.seed << "\n";
+  os << "  },\n";
+  os << "  \"stages\": [\n";
+  double totalSeconds = 0;
+  for (std::size_t i = 0; i < stages.size(); ++i) {
+    const StageReport& stage = stages[i];
+    std::vector<double> sorted = stage.latencies;
+    std::ranges::sort(sorted);
+    double seconds = 0;
+    for (double latency : sorted) {
+      seconds += latency;
+    }
+    totalSeconds += seconds;
+    const double mean = sorted.empty() ? 0 : seconds / sorted.size();
+    const double perSecond = seconds > 0 ? 1 / seconds : 0;
+
+    os << "    {\n";
+    os << "      \"name\": \"" << stage.name << "\",\n";
+    os << "      \"totalSeconds\": " << seconds << ",\n";
+    os << "      \"eventsPerSecond\": " << nEvents * perSecond << ",\n";
+    os << "      \"itemsPerSecond\": " << stage.items * perSecond << ",\n";
+    os << "      \"itemsPerEvent\": " << stage.items / nEvents << ",\n";
+    os << "      \"outputsPerEvent\": " << stage.outputs / nEvents << ",\n";
+    os << "      \"latencyMs\": {\n";
+    os << "        \"mean\": " << mean * 1e3 << ",\n";
+    os << "        \"p50\": " << percentile(sorted, 0.5) * 1e3 << ",\n";
+    os << "        \"p90\": " << percentile(sorted, 0.9) * 1e3 << ",\n";
+    os << "        \"p99\": " << percentile(sorted, 0.99) * 1e3 << ",\n";
+    os << "        \"max\": " << (sorted.empty() ? 0 : sorted.back() * 1e3)
+       << "\n";
+    os << "      },\n";
+    os << "      \"allocationsPerEvent\": " << stage.allocations / nEvents
+       << ",\n";
+    os << "      \"allocatedBytesPerEvent\": "
+       << stage.allocatedBytes / nEvents << "\n";
+    os << "    }" << (i + 1 < stages.size() ? "," : "") << "\n";
+  }
+  os << "  ],\n";
+  os << "  \"eventsPerSecond\": "
+     << (totalSeconds > 0 ? nEvents / totalSeconds : 0) << "\n";
+  os << "}\n";
+}
+
+/// Reconstruction chain on the cylindrical test detector in a solenoid field
+class ReconstructionChain {
+ public:
+  explicit ReconstructionChain(const Options& opts)
+      : m_opts(opts),
+        m_detector(m_geoCtx),
+        m_geometry(m_detector()),
+        m_field(std::make_shared<ConstantBField>(Vector3(0, 0, s_bz))),
+        m_surfaceAccessor{*m_geometry},
+        m_perigee(Surface::makeShared<PerigeeSurface>(Vector3::Zero())),
+        m_propagator(makePropagator<Stepper>()),
+        m_ckf(makePropagator<Stepper>(), logger("CKF")),
+        m_kf(makePropagator<Stepper>(), logger("KalmanFitter")),
+        m_gsf(makePropagator<MultiEigenStepperLoop<>>(),
+              std::make_shared<AtlasBetheHeitlerApprox>(
+                  makeDefaultBetheHeitlerApprox()),
+              logger("GSF")),
+        m_measurementSelector(MeasurementSelector::Config{
+            {GeometryIdentifier(), {{}, {15}, {1u}}}}),
+        m_ambiguityResolution(
+            GreedyAmbiguityResolution::Config{1, 1000, 3},
+            logger("GreedyAmbiguityResolution")),
+        m_seeder(logger("TripletSeeder")) {
+    configureSeeding();
+    configureVertexing();
+  }
+
+  std::vector<StageReport> run() {
+    std::vector<StageReport> stages(7);
+    stages[0].name = "navigation";
+    stages[1].name = "seeding";
+    stages[2].name = "ckf";
+    stages[3].name = "ambiguity";
+    stages[4].name = "kalman";
+    stages[5].name = "gsf";
+    stages[6].name = "vertexing";
+
+    for (std::size_t i = 0; i < m_opts.warmup + m_opts.events; ++i) {
+      const bool record = i >= m_opts.warmup;
+      std::default_random_engine rng(m_opts.seed + i);
+      const Event event = generate(rng);
+
+      std::vector<std::vector<SourceLink>> measurements;
+      std::vector<TestSourceLink> sourceLinks;
+      stages[0].run(record, [&] {
+        return createMeasurements(event, rng, measurements, sourceLinks);
+      });
+      stages[1].run(record, [&] { return findSeeds(sourceLinks); });
+
+      TrackContainerType ckfTracks{VectorTrackContainer{},
+                                   VectorMultiTrajectory{}};
+      stages[2].run(record,
+                    [&] { return findTracks(event, sourceLinks, ckfTracks); });
+      stages[3].run(record, [&] { return resolveAmbiguities(ckfTracks); });
+
+      std::vector<BoundTrackParameters> perigees;
+      stages[4].run(record,
+                    [&] { return fitKalman(event, measurements, perigees); });
+      stages[5].run(record, [&] { return fitGsf(event, measurements); });
+      stages[6].run(record, [&] { return findVertices(perigees); });
+    }
+    return stages;
+  }
+
+ private:
+  static constexpr double s_bz = 2_T;
+
+  std::unique_ptr<const Logger> logger(const std::string& name) const {
+    return getDefaultLogger(name, Logging::Level(m_opts.lvl));
+  }
+
+  template <typename stepper_t>
+  Propagator<stepper_t, Navigator> makePropagator() const {
+    Navigator::Config cfg{m_geometry};
+    cfg.resolvePassive = false;
+    cfg.resolveMaterial = true;
+    cfg.resolveSensitive = true;
+    return Propagator<stepper_t, Navigator>(
+        stepper_t(m_field), Navigator(cfg, logger("Navigator")));
+  }
+
+  void configureSeeding() {
+    m_gridConfig.minPt = 400_MeV;
+    m_gridConfig.rMax = 200_mm;
+    m_gridConfig.zMin = -600_mm;
+    m_gridConfig.zMax = 600_mm;
+    m_gridConfig.deltaRMax = 200_mm;
+    m_gridConfig.cotThetaMax = 2;
+    m_gridConfig.impactMax = 10_mm;
+    m_gridConfig.bFieldInZ = s_bz;
+    m_gridConfig.bottomBinFinder.emplace(
+        1, std::vector<std::pair<int, int>>{}, 0);
+    m_gridConfig.topBinFinder.emplace(1, std::vector<std::pair<int, int>>{},
+                                      0);
+
+    DoubletSeedFinder::Config bottomConfig;
+    bottomConfig.spacePointsSortedByRadius = true;
+    bottomConfig.candidateDirection = Direction::Backward();
+    bottomConfig.deltaRMin = 5_mm;
+    bottomConfig.deltaRMax = 200_mm;
+    bottomConfig.impactMax = m_gridConfig.impactMax;
+    bottomConfig.cotThetaMax = m_gridConfig.cotThetaMax;
+    bottomConfig.minPt = m_gridConfig.minPt;
+    m_bottomFinder = DoubletSeedFinder::create(
+        DoubletSeedFinder::DerivedConfig(bottomConfig, s_bz));
+
+    DoubletSeedFinder::Config topConfig = bottomConfig;
+    topConfig.candidateDirection = Direction::Forward();
+    m_topFinder = DoubletSeedFinder::create(
+        DoubletSeedFinder::DerivedConfig(topConfig, s_bz));
+
+    TripletSeedFinder::Config tripletConfig;
+    tripletConfig.useStripInfo = false;
+    tripletConfig.sortedByCotTheta = true;
+    tripletConfig.minPt = m_gridConfig.minPt;
+    tripletConfig.impactMax = m_gridConfig.impactMax;
+    m_tripletFinder = TripletSeedFinder::create(
+        TripletSeedFinder::DerivedConfig(tripletConfig, s_bz));
+  }
+
+  void configureVertexing() {
+    auto propagator = std::make_shared<VertexingPropagator>(Stepper(m_field));
+
+    ImpactPointEstimator::Config ipEstimatorConfig(m_field, propagator);
+    ImpactPointEstimator ipEstimator(ipEstimatorConfig);
+
+    AnnealingUtility::Config annealingConfig;
+    annealingConfig.setOfTemperatures = {
+        8., 4., 2., std::numbers::sqrt2, std::sqrt(3. / 2.), 1.};
+
+    HelicalTrackLinearizer::Config linearizerConfig;
+    linearizerConfig.bField = m_field;
+    linearizerConfig.propagator = propagator;
+    m_linearizer = std::make_unique<HelicalTrackLinearizer>(linearizerConfig);
+
+    AdaptiveMultiVertexFitter::Config fitterConfig(ipEstimator);
+    fitterConfig.annealingTool = AnnealingUtility(annealingConfig);
+    fitterConfig.extractParameters.connect<&InputTrack::extractParameters>();
+    fitterConfig.trackLinearizer
+        .connect<&HelicalTrackLinearizer::linearizeTrack>(m_linearizer.get());
+
+    GaussianTrackDensity::Config densityConfig;
+    densityConfig.extractParameters.connect<&InputTrack::extractParameters>();
+    auto seedFinder = std::make_shared<TrackDensityVertexFinder>(
+        TrackDensityVertexFinder::Config{GaussianTrackDensity(densityConfig)});
+
+    AdaptiveMultiVertexFinder::Config finderConfig(
+        AdaptiveMultiVertexFitter(std::move(fitterConfig)), seedFinder,
+        ipEstimator, m_field);
+    finderConfig.extractParameters.connect<&InputTrack::extractParameters>();
+    m_vertexFinder =
+        std::make_unique<AdaptiveMultiVertexFinder>(std::move(finderConfig));
+  }
+
+  /// Generate a deterministic event from @p rng. Vertices are spread along
+  /// the beam line, particles are charged pions within the barrel.
+  Event generate(std::default_random_engine& rng) const {
+    std::normal_distribution<double> vertexXY(0, 10_um);
+    std::normal_distribution<double> vertexZ(0, 30_mm);
+    std::uniform_real_distribution<double> phiDist(-std::numbers::pi,
+                                                   std::numbers::pi);
+    std::uniform_real_distribution<double> etaDist(-1, 1);
+    std::uniform_real_distribution<double> logPtDist(std::log(0.5_GeV),
+                                                     std::log(10_GeV));
+    std::bernoulli_distribution chargeDist(0.5);
+    std::normal_distribution<double> normal(0, 1);
+
+    BoundVector stddev;
+    stddev[eBoundLoc0] = 20_um;
+    stddev[eBoundLoc1] = 20_um;
+    stddev[eBoundPhi] = 1_mrad;
+    stddev[eBoundTheta] = 1_mrad;
+    stddev[eBoundTime] = 1_ns;
+
+    Event event;
+    for (std::size_t v = 0; v < m_opts.vertices; ++v) {
+      const Vector4 vertex(vertexXY(rng), vertexXY(rng), vertexZ(rng), 0);
+      for (std::size_t t = 0; t < m_opts.tracksPerVertex; ++t) {
+        const double phi = phiDist(rng);
+        const double theta = 2 * std::atan(std::exp(-etaDist(rng)));
+        const double p = std::exp(logPtDist(rng)) / std::sin(theta);
+        const double q = chargeDist(rng) ? 1_e : -1_e;
+        stddev[eBoundQOverP] = 0.01 / p;
+
+        const BoundMatrix cov = stddev.cwiseProduct(stddev).asDiagonal();
+        const auto& truth = event.truth.emplace_back(
+            BoundTrackParameters::createCurvilinear(
+                vertex, phi, theta, q / p, cov, ParticleHypothesis::pion()));
+
+        BoundVector smeared = truth.parameters();
+        for (std::size_t i = 0; i < eBoundSize; ++i) {
+          smeared[i] += stddev[i] * normal(rng);
+        }
+        // Inflate the start covariance so the fits are not over-constrained
+        event.start.emplace_back(truth.referenceSurface().getSharedPtr(),
+                                 smeared, cov * 100,
+                                 ParticleHypothesis::pion());
+      }
+    }
+    return event;
+  }
+
+  /// Propagate the true particles through the detector and record smeared
+  /// measurements. The source id is renumbered to a unique measurement index.
+  StageCount createMeasurements(
+      const Event& event, std::default_random_engine& rng,
+      std::vector<std::vector<SourceLink>>& measurements,
+      std::vector<TestSourceLink>& sourceLinks) const {
+    measurements.resize(event.truth.size());
+    for (std::size_t i = 0; i < event.truth.size(); ++i) {
+      auto created =
+          ActsTests::createMeasurements(m_propagator, m_geoCtx, m_magCtx,
+                                        event.truth[i], m_resolutions, rng);
+      for (TestSourceLink& sl : created.sourceLinks) {
+        sl.sourceId = sourceLinks.size();
+        measurements[i].emplace_back(sl);
+        sourceLinks.push_back(sl);
+      }
+    }
+    return {event.truth.size(), sourceLinks.size()};
+  }
+
+  StageCount findSeeds(const std::vector<TestSourceLink>& sourceLinks) const {
+    std::vector<Vector3> positions;
+    std::vector<float> phi;
+    std::vector<float> z;
+    std::vector<float> r;
+    positions.reserve(sourceLinks.size());
+    for (const TestSourceLink& sl : sourceLinks) {
+      const Surface* surface = m_geometry->findSurface(sl.m_geometryId);
+      const Vector3& position = positions.emplace_back(
+          surface->localToGlobal(m_geoCtx, sl.parameters, Vector3::UnitZ()));
+      phi.push_back(static_cast<float>(std::atan2(position.y(), position.x())));
+      z.push_back(static_cast<float>(position.z()));
+      r.push_back(static_cast<float>(VectorHelpers::perp(position)));
+    }
+    const CylindricalSpacePointGrid2 grid(m_gridConfig, logger("Grid"));
+    CylindricalSpacePointGrid2::ContiguousBins bins;
+    grid.fillContiguous(phi, z, r, bins);
+
+    SpacePointContainer2 spacePoints(
+        SpacePointColumns::PackedXY | SpacePointColumns::PackedZR |
+        SpacePointColumns::VarianceZ | SpacePointColumns::VarianceR);
+    spacePoints.reserve(bins.spacePoints.size());
+    for (SpacePointIndex2 index : bins.spacePoints) {
+      const Vector3& position = positions[index];
+      auto sp = spacePoints.createSpacePoint();
+      sp.xy() = {static_cast<float>(position.x()),
+                 static_cast<float>(position.y())};
+      sp.zr() = {z[index], r[index]};
+      sp.varianceZ() = static_cast<float>(sourceLinks[index].covariance(1, 1));
+      sp.varianceR() = 0;
+    }
+    const std::vector<SpacePointIndexRange2>& binRanges = bins.binRanges;
+
+    BroadTripletSeedFilter::State filterState;
+    BroadTripletSeedFilter::Cache filterCache;
+    const auto filterLogger = logger("SeedFilter");
+    BroadTripletSeedFilter filter(m_filterConfig, filterState, filterCache,
+                                  *filterLogger);
+
+    TripletSeeder::Cache cache;
+    std::vector<SpacePointContainer2::ConstRange> bottomRanges;
+    std::vector<SpacePointContainer2::ConstRange> topRanges;
+    SeedContainer2 seeds;
+    for (std::size_t group = 0; group < bins.numberOfGroups(); ++group) {
+      const auto middleRange =
+          spacePoints.range(binRanges.at(bins.middleBins[group])).asConst();
+      bottomRanges.clear();
+      for (const auto b : bins.bottomBins(group)) {
+        bottomRanges.push_back(spacePoints.range(binRanges.at(b)).asConst());
+      }
+      topRanges.clear();
+      for (const auto t : bins.topBins(group)) {
+        topRanges.push_back(spacePoints.range(binRanges.at(t)).asConst());
+      }
+      m_seeder.createSeedsFromGroups(cache, *m_bottomFinder, *m_topFinder,
+                                     *m_tripletFinder, filter, spacePoints,
+                                     bottomRanges, middleRange, topRanges,
+                                     {50_mm, 150_mm}, seeds);
+    }
+    return {sourceLinks.size(), seeds.size()};
+  }
+
+  StageCount findTracks(const Event& event,
+                        const std::vector<TestSourceLink>& sourceLinks,
+                        TrackContainerType& tracks) const {
+    SourceLinkMultimap byGeometry;
+    for (const TestSourceLink& sl : sourceLinks) {
+      byGeometry.emplace(sl.m_geometryId, sl);
+    }
+    SourceLinkAccessor accessor{&byGeometry};
+
+    TrackStateCreatorType trackStateCreator;
+    trackStateCreator.sourceLinkAccessor
+        .connect<&SourceLinkAccessor::range>(&accessor);
+    trackStateCreator.calibrator
+        .connect<&testSourceLinkCalibrator<TrackStateBackend>>();
+    trackStateCreator.measurementSelector
+        .connect<&MeasurementSelector::select<TrackStateBackend>>(
+            &m_measurementSelector);
+
+    CombinatorialKalmanFilterExtensions<TrackContainerType> extensions;
+    extensions.updater
+        .connect<&GainMatrixUpdater::operator()<TrackStateBackend>>(
+            &m_updater);
+    extensions.createTrackStates
+        .connect<&TrackStateCreatorType::createTrackStates>(
+            &trackStateCreator);
+    CombinatorialKalmanFilterOptions<TrackContainerType> options(
+        m_geoCtx, m_magCtx, m_calCtx, extensions,
+        PropagatorPlainOptions(m_geoCtx, m_magCtx));
+
+    for (const BoundTrackParameters& start : event.start) {
+      // Failed searches are part of the workload and simply produce no track
+      static_cast<void>(m_ckf.findTracks(start, options, tracks));
+    }
+    return {event.start.size(), tracks.size()};
+  }
+
+  StageCount resolveAmbiguities(const TrackContainerType& tracks) const {
+    GreedyAmbiguityResolution::State state;
+    m_ambiguityResolution.computeInitialState(
+        tracks, state,
+        [](const SourceLink& sl) {
+          return std::hash<std::size_t>{}(sl.get<TestSourceLink>().sourceId);
+        },
+        [](const SourceLink& a, const SourceLink& b) {
+          return a.get<TestSourceLink>().sourceId ==
+                 b.get<TestSourceLink>().sourceId;
+        });
+    m_ambiguityResolution.resolve(state);
+    return {tracks.size(), state.selectedTracks.size()};
+  }
+
+  StageCount fitKalman(const Event& event,
+                       const std::vector<std::vector<SourceLink>>& measurements,
+                       std::vector<BoundTrackParameters>& perigees) const {
+    KalmanFitterExtensions<VectorMultiTrajectory> extensions;
+    extensions.calibrator
+        .connect<&testSourceLinkCalibrator<VectorMultiTrajectory>>();
+    extensions.updater
+        .connect<&GainMatrixUpdater::operator()<VectorMultiTrajectory>>(
+            &m_updater);
+    extensions.smoother
+        .connect<&GainMatrixSmoother::operator()<VectorMultiTrajectory>>(
+            &m_smoother);
+    extensions.surfaceAccessor
+        .connect<&TestSourceLink::SurfaceAccessor::operator()>(
+            &m_surfaceAccessor);
+    KalmanFitterOptions options(m_geoCtx, m_magCtx, m_calCtx, extensions,
+                                PropagatorPlainOptions(m_geoCtx, m_magCtx),
+                                m_perigee.get());
+
+    TrackContainerType tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+    for (std::size_t i = 0; i < event.start.size(); ++i) {
+      auto result =
+          m_kf.fit(measurements[i].begin(), measurements[i].end(),
+                   event.start[i], options, tracks);
+      if (result.ok() && result->hasReferenceSurface()) {
+        perigees.push_back(result->createParametersAtReference());
+      }
+    }
+    return {event.start.size(), perigees.size()};
+  }
+
+  StageCount fitGsf(
+      const Event& event,
+      const std::vector<std::vector<SourceLink>>& measurements) const {
+    GsfOptions<VectorMultiTrajectory> options{m_geoCtx, m_magCtx, m_calCtx};
+    options.extensions.calibrator
+        .connect<&testSourceLinkCalibrator<VectorMultiTrajectory>>();
+    options.extensions.updater
+        .connect<&GainMatrixUpdater::operator()<VectorMultiTrajectory>>(
+            &m_updater);
+    options.extensions.surfaceAccessor
+        .connect<&TestSourceLink::SurfaceAccessor::operator()>(
+            &m_surfaceAccessor);
+    options.extensions.mixtureReducer.connect<&reduceMixtureWithKLDistance>();
+    options.propagatorPlainOptions =
+        PropagatorPlainOptions(m_geoCtx, m_magCtx);
+
+    TrackContainerType tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+    std::size_t nFitted = 0;
+    for (std::size_t i = 0; i < event.start.size(); ++i) {
+      auto result =
+          m_gsf.fit(measurements[i].begin(), measurements[i].end(),
+                    event.start[i], options, tracks);
+      nFitted += result.ok() ? 1 : 0;
+    }
+    return {event.start.size(), nFitted};
+  }
+
+  StageCount findVertices(
+      const std::vector<BoundTrackParameters>& perigees) const {
+    std::vector<InputTrack> inputTracks;
+    inputTracks.reserve(perigees.size());
+    for (const BoundTrackParameters& params : perigees) {
+      inputTracks.emplace_back(&params);
+    }
+
+    Vertex beamSpot;
+    beamSpot.setPosition(Vector3::Zero());
+    beamSpot.setCovariance(
+        Vector3(square(20_um), square(20_um), square(50_mm)).asDiagonal());
+    VertexingOptions options(m_geoCtx, m_magCtx, beamSpot);
+
+    auto state = m_vertexFinder->makeState(m_magCtx);
+    auto result = m_vertexFinder->find(inputTracks, options, state);
+    return {perigees.size(), result.ok() ? result->size() : 0};
+  }
+
+  Options m_opts;
+
+  GeometryContext m_geoCtx = GeometryContext::dangerouslyDefaultConstruct();
+  MagneticFieldContext m_magCtx;
+  CalibrationContext m_calCtx;
+
+  ActsTests::CylindricalTrackingGeometry m_detector;
+  std::shared_ptr<const TrackingGeometry> m_geometry;
+  std::shared_ptr<const MagneticFieldProvider> m_field;
+  TestSourceLink::SurfaceAccessor m_surfaceAccessor;
+  std::shared_ptr<PerigeeSurface> m_perigee;
+  ActsTests::MeasurementResolutionMap m_resolutions = {
+      {GeometryIdentifier(),
+       {ActsTests::MeasurementType::eLoc01, {25_um, 50_um}}}};
+
+  NavigatingPropagator m_propagator;
+  Ckf m_ckf;
+  Kf m_kf;
+  Gsf m_gsf;
+  GainMatrixUpdater m_updater;
+  GainMatrixSmoother m_smoother;
+  MeasurementSelector m_measurementSelector;
+  GreedyAmbiguityResolution m_ambiguityResolution;
+
+  CylindricalSpacePointGrid2::Config m_gridConfig;
+  BroadTripletSeedFilter::Config m_filterConfig;
+  std::unique_ptr<DoubletSeedFinder> m_bottomFinder;
+  std::unique_ptr<DoubletSeedFinder> m_topFinder;
+  std::unique_ptr<TripletSeedFinder> m_tripletFinder;
+  TripletSeeder m_seeder;
+
+  std::unique_ptr<HelicalTrackLinearizer> m_linearizer;
+  std::unique_ptr<AdaptiveMultiVertexFinder> m_vertexFinder;
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Options opts;
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("events", po::value<std::size_t>(&opts.events)->default_value(20), "number of measured events")
+      ("warmup", po::value<std::size_t>(&opts.warmup)->default_value(2), "number of unmeasured warm-up events")
+      ("vertices", po::value<std::size_t>(&opts.vertices)->default_value(5), "number of vertices per event")
+      ("tracks", po::value<std::size_t>(&opts.tracksPerVertex)->default_value(20), "number of tracks per vertex")
+      ("seed", po::value<std::uint32_t>(&opts.seed)->default_value(42), "random seed of the event sample")
+      ("output", po::value<std::string>(&opts.output), "JSON output file, stdout if not given")
+      ("verbose", po::value<unsigned int>(&opts.lvl)->default_value(Logging::FATAL), "logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.contains("help")) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  if (opts.events == 0) {
+    std::cerr << "error: at least one event is required" << std::endl;
+    return 1;
+  }
+
+  ReconstructionChain chain(opts);
+  const std::vector<StageReport> stages = chain.run();
+
+  if (opts.output.empty()) {
+    writeJson(std::cout, opts, stages);
+    return 0;
+  }
+  std::ofstream file(opts.output);
+  if (!file) {
+    std::cerr << "error: cannot open " << opts.output << std::endl;
+    return 1;
+  }
+  writeJson(file, opts, stages);
+  return 0;
+}
@@ -18,9 +18,19 @@
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Utilities/TrackHelpers.hpp"
 
+#ifdef ACTS_HAVE_EDM4HEP
+#include "ActsPlugins/EDM4hep/PodioTrackContainer.hpp"
+#include "ActsPlugins/EDM4hep/PodioTrackStateContainer.hpp"
+#include "ActsPlugins/EDM4hep/PodioUtil.hpp"
+#endif
+
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <numeric>
+#include <optional>
 #include <random>
+#include <string_view>
 #include <type_traits>
 
 using namespace Acts;
@@ -55,56 +65,47 @@ class BenchmarkSourceLink final {
   }
 };
 
-int main(int /*argc*/, char** /*argv[]*/) {
-  std::size_t runs = 1000000;
-  std::size_t nTracks = 10000;
+namespace {
 
-  VectorMultiTrajectory mtj;
-  VectorTrackContainer vtc;
-  TrackContainer tc{vtc, mtj};
-
-  VectorMultiTrajectory mtjOut;
-  VectorTrackContainer vtcOut;
-  TrackContainer output{vtcOut, mtjOut};
+/// Surfaces and parameters shared by all benchmarked backends
+struct Workload {
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  std::vector<std::pair<BoundVector, BoundMatrix>> parameters;
+  std::shared_ptr<PerigeeSurface> perigee;
+};
 
+/// Fill @p tc with random tracks and copy 10% of them into @p output in every
+/// run. The random numbers are seeded identically for every backend.
+template <typename input_t, typename output_t>
+void runBenchmark(std::string_view name, const Workload& workload,
+                  input_t& tc, output_t& output, std::size_t runs,
+                  std::size_t nTracks) {
   auto gid = GeometryIdentifier().withVolume(5).withLayer(3).withSensitive(1);
 
-  static_assert(sizeof(BenchmarkSourceLink) <= ACTS_SOURCELINK_SBO_SIZE);
-
-  static_assert(std::is_trivially_move_constructible_v<BenchmarkSourceLink>);
-
   std::uniform_int_distribution<> nStatesDist(1, 20);
   std::uniform_int_distribution<> measDimDist(1, 3);
   std::uniform_real_distribution<> typeDist(0, 1);
   std::uniform_real_distribution<> copyDist(0, 1);
   std::mt19937 rng{42};
 
-  std::vector<std::shared_ptr<Surface>> surfaces;
-  std::vector<std::pair<BoundVector, BoundMatrix>> parametersVector;
-  for (std::size_t s = 0; s < 50; ++s) {
-    surfaces.push_back(Surface::makeShared<PlaneSurface>(
-        Transform3::Identity(), std::make_shared<RectangleBounds>(50, 50)));
-
-    parametersVector.push_back(
-        detail::Test::generateBoundParametersCovariance(rng, {}));
-  }
-
   std::size_t nSurface = 0;
   auto surface = [&]() {
     nSurface++;
-    return surfaces.at(nSurface % surfaces.size());
+    return workload.surfaces.at(nSurface % workload.surfaces.size());
   };
 
   std::size_t nParams = 0;
   auto parameters = [&]() -> const std::pair<BoundVector, BoundMatrix>& {
     nParams++;
-    return parametersVector.at(nParams % parametersVector.size());
+    return workload.parameters.at(nParams % workload.parameters.size());
   };
 
-  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  // Reserve for the mean number of track states per track
+  tc.container().reserve(nTracks);
+  tc.trackStateContainer().reserve(nTracks * 11);
 
-  std::cout << "Creating " << nTracks << " tracks x " << runs << " runs"
-            << std::endl;
+  std::size_t nStatesTotal = 0;
+  const auto start = std::chrono::steady_clock::now();
   for (std::size_t r = 0; r < runs; ++r) {
     tc.clear();
     output.clear();
@@ -113,6 +114,7 @@ int main(int /*argc*/, char** /*argv[]*/) {
       auto track = tc.makeTrack();
 
       std::size_t nStates = nStatesDist(rng);
+      nStatesTotal += nStates;
 
       for (std::size_t j = 0; j < nStates; ++j) {
         auto trackState = track.appendTrackState(TrackStatePropMask::All);
@@ -156,7 +158,7 @@ int main(int /*argc*/, char** /*argv[]*/) {
         }
       }
 
-      track.setReferenceSurface(perigee);
+      track.setReferenceSurface(workload.perigee);
 
       const auto& [ref, cov] = parameters();
       track.parameters() = ref;
@@ -177,6 +179,117 @@ int main(int /*argc*/, char** /*argv[]*/) {
       target.copyFrom(track);
     }
   }
+  const std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::cout << name << ": " << elapsed.count() / runs << " ms per run, "
+            << 1e6 * elapsed.count() / nStatesTotal << " ns per track state"
+            << std::endl;
+}
+
+#ifdef ACTS_HAVE_EDM4HEP
+/// Identifies the benchmark surfaces by their position in the workload, like
+/// sensitive surfaces of a tracking geometry
+class BenchmarkConversionHelper final
+    : public ActsPlugins::PodioUtil::ConversionHelper {
+ public:
+  explicit BenchmarkConversionHelper(const Workload& workload) {
+    for (const auto& surface : workload.surfaces) {
+      m_surfaces.push_back(surface.get());
+    }
+  }
+
+  std::optional<ActsPlugins::PodioUtil::Identifier> surfaceToIdentifier(
+      const Surface& surface) const override {
+    auto it = std::ranges::find(m_surfaces, &surface);
+    if (it == m_surfaces.end()) {
+      return std::nullopt;
+    }
+    return std::distance(m_surfaces.begin(), it);
+  }
+
+  const Surface* identifierToSurface(
+      ActsPlugins::PodioUtil::Identifier identifier) const override {
+    return identifier < m_surfaces.size() ? m_surfaces[identifier] : nullptr;
+  }
+
+  ActsPlugins::PodioUtil::Identifier sourceLinkToIdentifier(
+      const SourceLink& /*sl*/) override {
+    return 0;
+  }
+
+  SourceLink identifierToSourceLink(
+      ActsPlugins::PodioUtil::Identifier /*identifier*/) const override {
+    return SourceLink{0};
+  }
+
+ private:
+  std::vector<const Surface*> m_surfaces;
+};
+#endif
+
+}  // namespace
+
+int main(int /*argc*/, char** /*argv[]*/) {
+  std::size_t runs = 100;
+  std::size_t nTracks = 10000;
+
+  static_assert(sizeof(BenchmarkSourceLink) <= ACTS_SOURCELINK_SBO_SIZE);
+
+  static_assert(std::is_trivially_move_constructible_v<BenchmarkSourceLink>);
+
+  std::mt19937 rng{42};
+
+  Workload workload;
+  for (std::size_t s = 0; s < 50; ++s) {
+    workload.surfaces.push_back(Surface::makeShared<PlaneSurface>(
+        Transform3::Identity(), std::make_shared<RectangleBounds>(50, 50)));
+
+    workload.parameters.push_back(
+        detail::Test::generateBoundParametersCovariance(rng, {}));
+  }
+  workload.perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+
+  std::cout << "Creating " << nTracks << " tracks x " << runs << " runs"
+            << std::endl;
+
+  {
+    VectorMultiTrajectory mtj;
+    VectorTrackContainer vtc;
+    TrackContainer tc{vtc, mtj};
+
+    VectorMultiTrajectory mtjOut;
+    VectorTrackContainer vtcOut;
+    TrackContainer output{vtcOut, mtjOut};
+
+    runBenchmark("Vector backend", workload, tc, output, runs, nTracks);
+  }
+
+#ifdef ACTS_HAVE_EDM4HEP
+  {
+    using namespace ActsPlugins;
+
+    BenchmarkConversionHelper helper{workload};
+
+    MutablePodioTrackStateContainer tsc{
+        helper, std::make_unique<ActsPodioEdm::TrackStateCollection>(),
+        std::make_unique<ActsPodioEdm::BoundParametersCollection>(),
+        std::make_unique<ActsPodioEdm::JacobianCollection>()};
+    MutablePodioTrackContainer ptc{
+        helper, std::make_unique<ActsPodioEdm::TrackCollection>()};
+    TrackContainer tc{ptc, tsc};
+
+    MutablePodioTrackStateContainer tscOut{
+        helper, std::make_unique<ActsPodioEdm::TrackStateCollection>(),
+        std::make_unique<ActsPodioEdm::BoundParametersCollection>(),
+        std::make_unique<ActsPodioEdm::JacobianCollection>()};
+    MutablePodioTrackContainer ptcOut{
+        helper, std::make_unique<ActsPodioEdm::TrackCollection>()};
+    TrackContainer output{ptcOut, tscOut};
+
+    runBenchmark("Podio backend", workload, tc, output, runs, nTracks);
+  }
+#endif
 
   return 0;
 }
@@ -0,0 +1,45 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace ActsTests {
+
+/// Parallel executor for tests which runs every chunk on its own thread
+class ThreadParallelExecutor final : public Acts::ParallelExecutor {
+ public:
+  explicit ThreadParallelExecutor(std::size_t nThreads)
+      : m_nThreads(nThreads) {}
+
+  std::size_t concurrency() const override { return m_nThreads; }
+
+  void run(std::size_t nChunks,
+           const std::function<void(std::size_t)>& task) const override {
+    std::vector<std::thread> threads;
+    threads.reserve(nChunks);
+    for (std::size_t chunk = 1; chunk < nChunks; ++chunk) {
+      threads.emplace_back(task, chunk);
+    }
+    task(0);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+ private:
+  std::size_t m_nThreads;
+};
+
+}  // namespace ActsTests
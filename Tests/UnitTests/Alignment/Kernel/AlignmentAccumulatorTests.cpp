@@ -0,0 +1,212 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Alignment.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "ActsAlignment/Kernel/AlignmentSolver.hpp"
+#include "ActsAlignment/Kernel/detail/AlignmentAccumulator.hpp"
+#include "ActsTests/CommonHelpers/FloatComparisons.hpp"
+#include "ActsTests/CommonHelpers/ThreadParallelExecutor.hpp"
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Acts;
+using ActsAlignment::AlignmentComputeOptions;
+using ActsAlignment::AlignmentSolver;
+using ActsAlignment::detail::accumulateAlignment;
+using ActsAlignment::detail::AlignmentAccumulator;
+using ActsAlignment::detail::solveAlignment;
+using ActsAlignment::detail::TrackAlignmentState;
+
+namespace {
+
+constexpr std::size_t nSurfaces = 12;
+
+/// Tracks crossing a few neighbouring surfaces with a random positive
+/// definite contribution to the chi2 second derivative
+std::vector<TrackAlignmentState> makeStates(
+    const std::vector<std::shared_ptr<Surface>>& surfaces,
+    std::size_t nTracks, std::size_t maskedDof = eAlignmentSize) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<std::size_t> first(0, nSurfaces - 3);
+  std::normal_distribution<double> gauss(0., 1.);
+
+  std::vector<TrackAlignmentState> states;
+  for (std::size_t t = 0; t < nTracks; ++t) {
+    TrackAlignmentState state;
+    const std::size_t begin = first(rng);
+    for (std::size_t i = 0; i < 3; ++i) {
+      state.alignedSurfaces.emplace(surfaces[begin + i].get(),
+                                    std::pair{begin + i, i});
+    }
+    state.alignmentDof = 3 * eAlignmentSize;
+    state.measurementDim = 6;
+    state.chi2 = 3.;
+
+    DynamicMatrix derivative(state.alignmentDof + 2, state.alignmentDof);
+    for (Eigen::Index i = 0; i < derivative.rows(); ++i) {
+      for (Eigen::Index j = 0; j < derivative.cols(); ++j) {
+        derivative(i, j) = gauss(rng);
+      }
+    }
+    if (maskedDof < eAlignmentSize) {
+      for (std::size_t i = 0; i < 3; ++i) {
+        derivative.col(i * eAlignmentSize + maskedDof).setZero();
+      }
+    }
+    state.alignmentToChi2SecondDerivative =
+        derivative.transpose() * derivative;
+    state.alignmentToChi2Derivative =
+        derivative.transpose() * DynamicVector::Ones(derivative.rows());
+    states.push_back(std::move(state));
+  }
+  return states;
+}
+
+AlignmentAccumulator accumulateStates(
+    const std::vector<TrackAlignmentState>& states, std::size_t nThreads) {
+  const ActsTests::ThreadParallelExecutor executor(nThreads);
+  return accumulateAlignment(
+      states.size(), nSurfaces, &executor,
+      [&](AlignmentAccumulator& accumulator, std::size_t begin,
+          std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          accumulator.add(states[i]);
+        }
+      });
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(AlignmentSuite)
+
+BOOST_AUTO_TEST_CASE(AlignmentAccumulatorParallel) {
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  for (std::size_t i = 0; i < nSurfaces; ++i) {
+    surfaces.push_back(
+        Surface::makeShared<PlaneSurface>(Transform3::Identity()));
+  }
+  const auto states = makeStates(surfaces, 200);
+
+  const auto serial = accumulateStates(states, 1);
+  BOOST_CHECK_EQUAL(serial.numTracks(), 200u);
+  BOOST_CHECK_EQUAL(serial.alignmentDof(), nSurfaces * eAlignmentSize);
+  // Only neighbouring surfaces are coupled
+  BOOST_CHECK_LE(serial.numBlocks(), nSurfaces * 5);
+  CHECK_CLOSE_REL(serial.chi2(), 600., 1e-12);
+  BOOST_CHECK_EQUAL(serial.measurementDim(), 1200u);
+
+  for (std::size_t nThreads : {2u, 3u, 8u}) {
+    const auto parallel = accumulateStates(states, nThreads);
+    BOOST_CHECK_EQUAL(parallel.numTracks(), serial.numTracks());
+    BOOST_CHECK_EQUAL(parallel.numBlocks(), serial.numBlocks());
+    CHECK_CLOSE_ABS(parallel.chi2Derivative(), serial.chi2Derivative(), 1e-9);
+    CHECK_CLOSE_ABS(parallel.denseChi2SecondDerivative(),
+                    serial.denseChi2SecondDerivative(), 1e-9);
+  }
+
+  const DynamicMatrix sparse = serial.sparseChi2SecondDerivative();
+  CHECK_CLOSE_ABS(sparse, serial.denseChi2SecondDerivative(), 1e-12);
+
+  // Failures while filling a partial sum reach the caller
+  const ThreadParallelExecutor executor(4);
+  BOOST_CHECK_THROW(
+      accumulateAlignment(states.size(), nSurfaces, &executor,
+                          [](AlignmentAccumulator&, std::size_t begin,
+                             std::size_t) {
+                            if (begin > 0) {
+                              throw std::runtime_error("fit failure");
+                            }
+                          }),
+      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(AlignmentAccumulatorSolvers) {
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  for (std::size_t i = 0; i < nSurfaces; ++i) {
+    surfaces.push_back(
+        Surface::makeShared<PlaneSurface>(Transform3::Identity()));
+  }
+  const auto accumulator = accumulateStates(makeStates(surfaces, 200), 4);
+
+  AlignmentComputeOptions options;
+  const auto dense = solveAlignment(accumulator, options);
+  BOOST_CHECK(dense.success);
+
+  BOOST_CHECK_EQUAL(dense.alignmentCovarianceBlocks.size(), nSurfaces);
+
+  options.solver = AlignmentSolver::SparseCholesky;
+  const auto cholesky = solveAlignment(accumulator, options);
+  BOOST_CHECK(cholesky.success);
+  CHECK_CLOSE_ABS(cholesky.deltaAlignmentParameters,
+                  dense.deltaAlignmentParameters, 1e-8);
+  // Only the covariance blocks of the aligned surfaces by default
+  BOOST_CHECK_EQUAL(cholesky.alignmentCovariance.size(), 0);
+  BOOST_REQUIRE_EQUAL(cholesky.alignmentCovarianceBlocks.size(), nSurfaces);
+  for (std::size_t i = 0; i < nSurfaces; ++i) {
+    CHECK_CLOSE_ABS(cholesky.alignmentCovarianceBlocks[i],
+                    dense.alignmentCovarianceBlocks[i], 1e-8);
+  }
+
+  options.fullCovariance = true;
+  const auto choleskyFull = solveAlignment(accumulator, options);
+  CHECK_CLOSE_ABS(choleskyFull.alignmentCovariance, dense.alignmentCovariance,
+                  1e-8);
+
+  options.solver = AlignmentSolver::ConjugateGradient;
+  options.cgTolerance = 1e-12;
+  const auto cg = solveAlignment(accumulator, options);
+  BOOST_CHECK(cg.success);
+  BOOST_CHECK_GT(cg.iterations, 0u);
+  CHECK_CLOSE_ABS(cg.deltaAlignmentParameters, dense.deltaAlignmentParameters,
+                  1e-6);
+  // Only the diagonal blocks of the covariance are filled
+  BOOST_CHECK_EQUAL(cg.alignmentCovariance(0, eAlignmentSize), 0.);
+  BOOST_CHECK_NE(cg.alignmentCovariance(0, 0), 0.);
+  const AlignmentMatrix cgFirstBlock =
+      cg.alignmentCovariance.topLeftCorner<eAlignmentSize, eAlignmentSize>();
+  CHECK_CLOSE_ABS(cgFirstBlock, cg.alignmentCovarianceBlocks.front(), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(AlignmentAccumulatorMaskedDof) {
+  std::vector<std::shared_ptr<Surface>> surfaces;
+  for (std::size_t i = 0; i < nSurfaces; ++i) {
+    surfaces.push_back(
+        Surface::makeShared<PlaneSurface>(Transform3::Identity()));
+  }
+  const auto accumulator = accumulateStates(
+      makeStates(surfaces, 200, eAlignmentRotation2), 2);
+
+  for (auto solver :
+       {AlignmentSolver::SparseCholesky, AlignmentSolver::ConjugateGradient}) {
+    AlignmentComputeOptions options;
+    options.solver = solver;
+    const auto solution = solveAlignment(accumulator, options);
+    BOOST_CHECK(solution.success);
+    for (std::size_t i = 0; i < nSurfaces; ++i) {
+      const std::size_t masked = i * eAlignmentSize + eAlignmentRotation2;
+      BOOST_CHECK_EQUAL(solution.deltaAlignmentParameters[masked], 0.);
+      BOOST_CHECK_EQUAL(solution.alignmentCovarianceBlocks[i](
+                            eAlignmentRotation2, eAlignmentRotation2),
+                        0.);
+      BOOST_CHECK(solution.deltaAlignmentParameters[masked - 1] != 0.);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
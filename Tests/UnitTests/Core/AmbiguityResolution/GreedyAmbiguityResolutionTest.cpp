@@ -0,0 +1,151 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
+#include "ActsTests/CommonHelpers/ThreadParallelExecutor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Acts;
+
+namespace ActsTests {
+
+namespace {
+
+/// Fill the state like computeInitialState does for the given tracks
+GreedyAmbiguityResolution::State makeState(
+    const std::vector<std::vector<std::size_t>>& measurementsPerTrack,
+    const std::vector<float>& chi2) {
+  GreedyAmbiguityResolution::State state;
+  state.numberOfTracks = measurementsPerTrack.size();
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    state.trackTips.push_back(static_cast<int>(iTrack));
+    state.trackChi2.push_back(chi2[iTrack]);
+    state.measurementsPerTrack.push_back(measurementsPerTrack[iTrack]);
+    state.selectedTracks.insert(iTrack);
+    for (auto iMeasurement : measurementsPerTrack[iTrack]) {
+      state.tracksPerMeasurement[iMeasurement].insert(iTrack);
+    }
+  }
+  state.sharedMeasurementsPerTrack.assign(state.numberOfTracks, 0);
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      if (state.tracksPerMeasurement[iMeasurement].size() > 1) {
+        ++state.sharedMeasurementsPerTrack[iTrack];
+      }
+    }
+  }
+  return state;
+}
+
+/// Tracks in small groups that share measurements among each other
+GreedyAmbiguityResolution::State makeRandomState(std::size_t nGroups,
+                                                 std::uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<std::size_t> nTracksDist(1, 6);
+  std::uniform_int_distribution<std::size_t> nMeasDist(7, 12);
+  std::uniform_real_distribution<float> chi2Dist(0.5, 3.);
+
+  std::vector<std::vector<std::size_t>> measurementsPerTrack;
+  std::vector<float> chi2;
+  std::size_t offset = 0;
+  for (std::size_t iGroup = 0; iGroup < nGroups; ++iGroup) {
+    // every group draws from its own measurement pool
+    std::size_t pool = 16;
+    std::uniform_int_distribution<std::size_t> measDist(offset,
+                                                        offset + pool - 1);
+    std::size_t nTracks = nTracksDist(rng);
+    for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+      std::vector<std::size_t> measurements;
+      std::size_t nMeasurements = nMeasDist(rng);
+      while (measurements.size() < nMeasurements) {
+        std::size_t iMeasurement = measDist(rng);
+        if (std::ranges::find(measurements, iMeasurement) ==
+            measurements.end()) {
+          measurements.push_back(iMeasurement);
+        }
+      }
+      measurementsPerTrack.push_back(std::move(measurements));
+      // quantised so that ties in chi2 occur
+      chi2.push_back(std::round(chi2Dist(rng) * 4.f) / 4.f);
+    }
+    offset += pool;
+  }
+  return makeState(measurementsPerTrack, chi2);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(AmbiguitesResolutionSuite)
+
+BOOST_AUTO_TEST_CASE(GreedyResolveComponentsSimple) {
+  // two duplicates and one independent track
+  auto state = makeState({{0, 1, 2, 3}, {0, 1, 2, 4}, {5, 6, 7, 8}},
+                         {1.f, 2.f, 1.f});
+
+  GreedyAmbiguityResolution::Config cfg;
+  GreedyAmbiguityResolution resolver(cfg);
+  resolver.resolveComponents(state);
+
+  BOOST_CHECK_EQUAL(state.selectedTracks.size(), 2u);
+  BOOST_CHECK(state.selectedTracks.contains(0));
+  BOOST_CHECK(state.selectedTracks.contains(2));
+  BOOST_CHECK_EQUAL(state.sharedMeasurementsPerTrack[0], 0u);
+  BOOST_CHECK_EQUAL(state.tracksPerMeasurement[0].size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(GreedyResolveComponentsMatchesResolve) {
+  for (std::uint32_t seed = 1; seed <= 5; ++seed) {
+    auto reference = makeRandomState(200, seed);
+
+    GreedyAmbiguityResolution::Config cfg;
+    cfg.maximumIterations = 100000;
+    GreedyAmbiguityResolution resolver(cfg);
+    auto components = reference;
+    resolver.resolve(reference);
+    resolver.resolveComponents(components);
+
+    BOOST_CHECK(components.selectedTracks == reference.selectedTracks);
+    for (auto iTrack : reference.selectedTracks) {
+      BOOST_CHECK_EQUAL(components.sharedMeasurementsPerTrack[iTrack],
+                        reference.sharedMeasurementsPerTrack[iTrack]);
+    }
+    BOOST_CHECK(components.tracksPerMeasurement ==
+                reference.tracksPerMeasurement);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GreedyResolveComponentsThreads) {
+  auto state = makeRandomState(500, 7);
+
+  GreedyAmbiguityResolution::Config cfg;
+  cfg.maximumSharedHits = 2;
+  cfg.maximumIterations = 100000;
+  auto single = state;
+  GreedyAmbiguityResolution(cfg).resolveComponents(single);
+
+  cfg.executor = std::make_shared<ThreadParallelExecutor>(4);
+  GreedyAmbiguityResolution(cfg).resolveComponents(state);
+
+  BOOST_CHECK(state.selectedTracks == single.selectedTracks);
+  BOOST_CHECK_LT(state.selectedTracks.size(), state.numberOfTracks);
+  for (auto iTrack : state.selectedTracks) {
+    BOOST_CHECK_LT(state.sharedMeasurementsPerTrack[iTrack],
+                   cfg.maximumSharedHits);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
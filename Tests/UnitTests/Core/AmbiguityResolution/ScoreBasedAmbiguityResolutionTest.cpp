@@ -12,9 +12,14 @@
 #include "Acts/EventData/TrackContainer.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Utilities/TrackHelpers.hpp"
+#include "ActsTests/CommonHelpers/ThreadParallelExecutor.hpp"
 
 #include <map>
+#include <memory>
+#include <random>
 
 using namespace Acts;
 using IndexType = TrackIndexType;
@@ -184,6 +189,96 @@ BOOST_FIXTURE_TEST_CASE(GetCleanedOutTracksTest, Fixture) {
   BOOST_CHECK_EQUAL(accepted, false);
 }
 
+BOOST_FIXTURE_TEST_CASE(SolveAmbiguityThreadsTest, Fixture) {
+  Fixture fixture;
+  fixture.config.minScoreSharedTracks = 0;
+  fixture.config.maxShared = 2;
+
+  auto surface = Surface::makeShared<PlaneSurface>(
+      Transform3::Identity(), std::make_shared<RectangleBounds>(10., 10.));
+  surface->assignGeometryId(GeometryIdentifier().withVolume(8));
+
+  VectorTrackContainer mutVtc;
+  VectorMultiTrajectory mutMtj;
+  TrackContainer mutTc{mutVtc, mutMtj};
+
+  // tracks that draw their hits from a small pool, so many of them share
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<std::size_t> hitDist(0, 299);
+  std::uniform_int_distribution<int> flagDist(0, 9);
+  for (std::size_t iTrack = 0; iTrack < 200; ++iTrack) {
+    auto track = mutTc.makeTrack();
+    for (std::size_t iState = 0; iState < 8; ++iState) {
+      auto ts = track.appendTrackState();
+      ts.setReferenceSurface(surface);
+      int flag = flagDist(rng);
+      if (flag == 0) {
+        ts.typeFlags().setIsHole();
+        continue;
+      }
+      ts.typeFlags().setHasMeasurement();
+      if (flag == 1) {
+        ts.typeFlags().setIsOutlier();
+      }
+      ts.setUncalibratedSourceLink(SourceLink{hitDist(rng)});
+    }
+    calculateTrackQuantities(track);
+    track.chi2() = 0.5 * static_cast<double>(iTrack % 7 + 1);
+    track.nDoF() = 10;
+  }
+
+  ConstVectorTrackContainer vtc{std::move(mutVtc)};
+  ConstVectorMultiTrajectory mtj{std::move(mutMtj)};
+  TrackContainer ctc{vtc, mtj};
+
+  auto sourceLinkHash = [](const SourceLink& sl) {
+    return std::hash<std::size_t>{}(sl.get<std::size_t>());
+  };
+  auto sourceLinkEquality = [](const SourceLink& a, const SourceLink& b) {
+    return a.get<std::size_t>() == b.get<std::size_t>();
+  };
+
+  // reference built from the individual steps
+  ScoreBasedAmbiguityResolution tester(fixture.config);
+  auto trackFeaturesVectors = tester.computeInitialState(ctc);
+  auto trackScore = tester.simpleScore(ctc, trackFeaturesVectors);
+  std::vector<std::vector<std::size_t>> measurementsPerTrackVector;
+  std::map<std::size_t, std::size_t> nTracksPerMeasurement;
+  for (const auto& track : ctc) {
+    std::vector<std::size_t> measurementsPerTrack;
+    for (const auto& ts : track.trackStatesReversed()) {
+      if (ts.typeFlags().isOutlier() || ts.typeFlags().isMeasurement()) {
+        auto hit = ts.getUncalibratedSourceLink().template get<std::size_t>();
+        measurementsPerTrack.push_back(hit);
+        nTracksPerMeasurement[hit]++;
+      }
+    }
+    measurementsPerTrackVector.push_back(std::move(measurementsPerTrack));
+  }
+  std::vector<int> expected;
+  for (const auto& track : ctc) {
+    std::size_t iTrack = track.index();
+    if (tester.getCleanedOutTracks(track, trackScore[iTrack],
+                                   measurementsPerTrackVector[iTrack],
+                                   nTracksPerMeasurement) &&
+        trackScore[iTrack] > fixture.config.minScore) {
+      expected.push_back(track.index());
+    }
+  }
+  BOOST_CHECK(!expected.empty());
+  BOOST_CHECK_LT(expected.size(), ctc.size());
+
+  for (std::size_t nThreads : {1u, 3u, 8u}) {
+    auto config = fixture.config;
+    config.executor = std::make_shared<ThreadParallelExecutor>(nThreads);
+    ScoreBasedAmbiguityResolution resolver(config);
+    auto goodTracks =
+        resolver.solveAmbiguity(ctc, sourceLinkHash, sourceLinkEquality);
+    BOOST_CHECK_EQUAL_COLLECTIONS(goodTracks.begin(), goodTracks.end(),
+                                  expected.begin(), expected.end());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
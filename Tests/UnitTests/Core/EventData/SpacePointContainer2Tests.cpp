@@ -14,6 +14,7 @@
 #include "Acts/EventData/Types.hpp"
 
 #include <stdexcept>
+#include <utility>
 
 #include <boost/core/no_exceptions_support.hpp>
 
@@ -116,6 +117,22 @@ BOOST_AUTO_TEST_CASE(Clear) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(ShrinkToFit) {
+  SpacePointContainer2 container(SpacePointColumns::PackedXY);
+  container.reserve(100);
+
+  auto sp = container.createSpacePoint();
+  sp.xy() = {1, 2};
+
+  container.shrinkToFit();
+
+  BOOST_CHECK_EQUAL(container.size(), 1u);
+  BOOST_CHECK_EQUAL(container.at(0).xy()[0], 1);
+  BOOST_CHECK_EQUAL(container.at(0).xy()[1], 2);
+  BOOST_CHECK_EQUAL(std::as_const(container).xyColumn().column().capacity(),
+                    1u);
+}
+
 BOOST_AUTO_TEST_CASE(KnownExtraColumns) {
   SpacePointContainer2 container;
 
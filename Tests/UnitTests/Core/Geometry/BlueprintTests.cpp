@@ -20,6 +20,7 @@
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/LayerBlueprintNode.hpp"
 #include "Acts/Geometry/MaterialDesignatorBlueprintNode.hpp"
+#include "Acts/Geometry/Portal.hpp"
 #include "Acts/Geometry/StaticBlueprintNode.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Geometry/TrapezoidVolumeBounds.hpp"
@@ -30,6 +31,8 @@
 #include "Acts/Material/MaterialSlab.hpp"
 #include "Acts/Material/ProtoSurfaceMaterial.hpp"
 #include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceTransformStore.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/ProtoAxis.hpp"
@@ -281,6 +284,67 @@ BOOST_AUTO_TEST_CASE(CylinderContainer) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(PoolSurfaceTransforms) {
+  auto makeBlueprint = [](bool pool) {
+    Blueprint::Config cfg;
+    cfg.envelope[AxisDirection::AxisZ] = {20_mm, 20_mm};
+    cfg.envelope[AxisDirection::AxisR] = {2_mm, 20_mm};
+    cfg.poolSurfaceTransforms = pool;
+    auto root = std::make_unique<Blueprint>(cfg);
+
+    auto& cyl = root->addCylinderContainer("Container", AxisDirection::AxisZ);
+    cyl.setAttachmentStrategy(VolumeAttachmentStrategy::Gap);
+    auto cylBounds =
+        std::make_shared<CylinderVolumeBounds>(10_mm, 20_mm, 30_mm);
+    for (std::size_t i = 0; i < 3; i++) {
+      cyl.addStaticVolume(std::make_unique<TrackingVolume>(
+          Transform3{Translation3{Vector3{0, 0, -200_mm + i * 72_mm}}},
+          cylBounds, "child" + std::to_string(i)));
+    }
+    return root;
+  };
+
+  auto referenceRoot = makeBlueprint(false);
+  auto reference = referenceRoot->construct({}, gctx, *logger);
+  BOOST_CHECK(reference->surfaceTransformStore() == nullptr);
+
+  auto root = makeBlueprint(true);
+  auto tGeometry = root->construct({}, gctx, *logger);
+  SurfaceTransformStore* store = tGeometry->surfaceTransformStore();
+  BOOST_REQUIRE(store != nullptr);
+  BOOST_CHECK_GT(store->size(), 0u);
+
+  // all portal surfaces refer to the store and keep their transform
+  std::vector<const Surface*> surfaces;
+  tGeometry->apply([&](const Portal& portal) {
+    const Surface& surface = portal.surface();
+    BOOST_CHECK_EQUAL(surface.transformStore(), store);
+    BOOST_CHECK_EQUAL(&surface.localToGlobalTransform(gctx),
+                      &store->transform(surface.transformStoreIndex()));
+    surfaces.push_back(&surface);
+  });
+  std::vector<const Surface*> referenceSurfaces;
+  reference->apply([&](const Portal& portal) {
+    referenceSurfaces.push_back(&portal.surface());
+  });
+  BOOST_REQUIRE(!surfaces.empty());
+  BOOST_REQUIRE_EQUAL(surfaces.size(), referenceSurfaces.size());
+  for (std::size_t i = 0; i < surfaces.size(); ++i) {
+    BOOST_CHECK(surfaces[i]->localToGlobalTransform(gctx).isApprox(
+        referenceSurfaces[i]->localToGlobalTransform(gctx)));
+  }
+
+  // an alignment update of the store is picked up by the surface
+  const Surface& surface = *surfaces.front();
+  const std::size_t index = surface.transformStoreIndex();
+  const Vector3 center = surface.center(gctx);
+  const Transform3 shifted =
+      Translation3{Vector3{1_mm, 2_mm, 3_mm}} * store->transform(index);
+  store->setTransform(index, shifted);
+  BOOST_CHECK(
+      surface.center(gctx).isApprox(center + Vector3{1_mm, 2_mm, 3_mm}));
+}
+
 BOOST_AUTO_TEST_CASE(Confined) {
   Transform3 base{Transform3::Identity()};
 
@@ -8,13 +8,19 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Acts/Definitions/Tolerance.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "ActsTests/CommonHelpers/CubicTrackingGeometry.hpp"
 #include "ActsTests/CommonHelpers/CylindricalTrackingGeometry.hpp"
 
 #include <optional>
+#include <random>
+#include <vector>
 
 using namespace Acts;
 
@@ -71,6 +77,86 @@ BOOST_AUTO_TEST_CASE(SurfaceLookupTracksNonSensitiveSurfaces) {
           << *nonSensitiveSurfaceId << " even when it is not sensitive");
 }
 
+/// Compare the accelerated lookup with the hierarchy walk of the world
+void checkLowestTrackingVolume(const TrackingGeometry& geometry,
+                               const std::vector<Vector3>& positions) {
+  const TrackingVolume* world = geometry.highestTrackingVolume();
+
+  std::size_t found = 0;
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    const TrackingVolume* expected =
+        world->lowestTrackingVolume(tgContext, positions[i],
+                                    s_onSurfaceTolerance);
+    BOOST_CHECK_EQUAL(geometry.lowestTrackingVolume(tgContext, positions[i]),
+                      expected);
+    found += expected != nullptr && expected != world ? 1 : 0;
+  }
+  BOOST_CHECK_GT(found, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(LowestTrackingVolumeCylindrical) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+  BOOST_REQUIRE_NE(tGeometry, nullptr);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> rDist(0., 1200.);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> zDist(-1600., 1600.);
+
+  std::vector<Vector3> positions;
+  for (std::size_t i = 0; i < 2000; ++i) {
+    double r = rDist(rng);
+    double phi = phiDist(rng);
+    positions.emplace_back(r * std::cos(phi), r * std::sin(phi), zDist(rng));
+  }
+  checkLowestTrackingVolume(*tGeometry, positions);
+}
+
+BOOST_AUTO_TEST_CASE(LowestTrackingVolumeManyChildren) {
+  // a world box with a grid of boxes, enough to need a hierarchy
+  auto world = std::make_shared<TrackingVolume>(
+      Transform3::Identity(),
+      std::make_shared<CuboidVolumeBounds>(100., 100., 100.), "World");
+
+  constexpr int nCells = 4;
+  constexpr double cellHalf = 20.;
+  for (int ix = 0; ix < nCells; ++ix) {
+    for (int iy = 0; iy < nCells; ++iy) {
+      Vector3 center(-75. + 50. * ix, -75. + 50. * iy, 0.);
+      auto cell = std::make_unique<TrackingVolume>(
+          Transform3(Translation3(center)),
+          std::make_shared<CuboidVolumeBounds>(cellHalf, cellHalf, 80.),
+          "Cell");
+      // a rotated cylinder inside of every other cell
+      if ((ix + iy) % 2 == 0) {
+        Transform3 transform = Transform3(Translation3(center)) *
+                               AngleAxis3(M_PI / 2., Vector3::UnitX());
+        cell->addVolume(std::make_unique<TrackingVolume>(
+            transform, std::make_shared<CylinderVolumeBounds>(5., 15., 10.),
+            "Tube"));
+      }
+      world->addVolume(std::move(cell));
+    }
+  }
+  TrackingGeometry geometry(world);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(-110., 110.);
+  std::vector<Vector3> positions;
+  for (std::size_t i = 0; i < 5000; ++i) {
+    positions.emplace_back(dist(rng), dist(rng), dist(rng));
+  }
+  // positions on the cell boundaries
+  for (int ix = 0; ix < nCells; ++ix) {
+    double x = -75. + 50. * ix + cellHalf;
+    positions.emplace_back(x, -75., 0.);
+    positions.emplace_back(x + 0.5 * s_onSurfaceTolerance, -75., 10.);
+    positions.emplace_back(x + 2. * s_onSurfaceTolerance, -25., -10.);
+  }
+  checkLowestTrackingVolume(geometry, positions);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -0,0 +1,148 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/MagneticField/TabulatedBField.hpp"
+#include "ActsTests/CommonHelpers/FloatComparisons.hpp"
+
+#include <memory>
+#include <random>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace ActsTests {
+
+namespace {
+
+std::shared_ptr<const SolenoidBField> makeSolenoid() {
+  SolenoidBField::Config cfg{};
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 1154;
+  cfg.bMagCenter = 2_T;
+  return std::make_shared<const SolenoidBField>(cfg);
+}
+
+TabulatedBField::Config makeConfig() {
+  TabulatedBField::Config cfg;
+  cfg.min = Vector3(-1_m, -1_m, -2_m);
+  cfg.max = Vector3(1_m, 1_m, 2_m);
+  cfg.binSize = Vector3::Constant(50_mm);
+  cfg.tileSize = 4;
+  return cfg;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(MagneticFieldSuite)
+
+BOOST_AUTO_TEST_CASE(TabulatedBFieldConstruction) {
+  auto field = makeSolenoid();
+  auto cfg = makeConfig();
+
+  TabulatedBField tabulated(field, cfg);
+  // 40 x 40 x 80 bins in tiles of 4 bins per axis
+  BOOST_CHECK_EQUAL(tabulated.numTiles(), 10u * 10u * 20u);
+  BOOST_CHECK_EQUAL(tabulated.numFilledTiles(), 0u);
+
+  BOOST_CHECK_THROW(TabulatedBField(nullptr, cfg), std::invalid_argument);
+  auto badCfg = cfg;
+  badCfg.tileSize = 0;
+  BOOST_CHECK_THROW(TabulatedBField(field, badCfg), std::invalid_argument);
+  badCfg = cfg;
+  badCfg.max = cfg.min;
+  BOOST_CHECK_THROW(TabulatedBField(field, badCfg), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedBFieldLookup) {
+  MagneticFieldContext mctx;
+  auto field = makeSolenoid();
+  TabulatedBField tabulated(field, makeConfig());
+
+  auto exactCache = field->makeCache(mctx);
+  auto cache = tabulated.makeCache(mctx);
+
+  // Grid points are reproduced exactly
+  Vector3 node(100_mm, -200_mm, 350_mm);
+  CHECK_CLOSE_ABS(tabulated.getField(node, cache).value(),
+                  field->getField(node, exactCache).value(), 1e-9_T);
+  BOOST_CHECK_EQUAL(tabulated.numFilledTiles(), 1u);
+
+  // Interpolation inside the region stays close to the exact field. Bins
+  // touching the beam axis are avoided, where the radial field of the
+  // solenoid is not continuous.
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> xy(0.1_m, 0.7_m);
+  std::uniform_real_distribution<double> z(-1.99_m, 1.99_m);
+  std::uniform_int_distribution<int> sign(0, 1);
+  for (std::size_t i = 0; i < 200; ++i) {
+    Vector3 pos((sign(rng) != 0 ? 1 : -1) * xy(rng),
+                (sign(rng) != 0 ? 1 : -1) * xy(rng), z(rng));
+    CHECK_CLOSE_ABS(tabulated.getField(pos, cache).value(),
+                    field->getField(pos, exactCache).value(), 1e-2_T);
+  }
+
+  // Outside the region the wrapped provider is used
+  Vector3 outside(0, 0, 2.5_m);
+  BOOST_CHECK_EQUAL(tabulated.getField(outside, cache).value(),
+                    field->getField(outside, exactCache).value());
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedBFieldPrewarm) {
+  MagneticFieldContext mctx;
+  TabulatedBField tabulated(makeSolenoid(), makeConfig());
+
+  Extent extent;
+  extent.set(AxisDirection::AxisZ, -100_mm, 100_mm);
+  tabulated.prewarm(extent, mctx);
+  // z range covers 2 tiles (from -200 mm to 200 mm), x and y are unbounded
+  BOOST_CHECK_EQUAL(tabulated.numFilledTiles(), 10u * 10u * 2u);
+
+  tabulated.prewarm(Extent(), mctx);
+  BOOST_CHECK_EQUAL(tabulated.numFilledTiles(), tabulated.numTiles());
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedBFieldErrorBound) {
+  MagneticFieldContext mctx;
+  auto field = makeSolenoid();
+
+  // A constant field is interpolated exactly and passes any bound
+  auto cfg = makeConfig();
+  cfg.maxError = 1e-9_T;
+  TabulatedBField constant(
+      std::make_shared<const ConstantBField>(Vector3(0, 0, 2_T)), cfg);
+  auto constantCache = constant.makeCache(mctx);
+  BOOST_CHECK_EQUAL(constant.getField({1_mm, 2_mm, 3_mm}, constantCache)
+                        .value(),
+                    Vector3(0, 0, 2_T));
+  BOOST_CHECK_EQUAL(constant.numExactTiles(), 0u);
+
+  // Coarse bins near the coil cannot meet a tight bound, lookups are then
+  // forwarded to the exact field
+  cfg.binSize = Vector3::Constant(250_mm);
+  cfg.maxError = 1e-6_T;
+  TabulatedBField coarse(field, cfg);
+  auto cache = coarse.makeCache(mctx);
+  auto exactCache = field->makeCache(mctx);
+  Vector3 pos(0.9_m, 0.1_m, 1.3_m);
+  BOOST_CHECK_EQUAL(coarse.getField(pos, cache).value(),
+                    field->getField(pos, exactCache).value());
+  BOOST_CHECK_EQUAL(coarse.numExactTiles(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
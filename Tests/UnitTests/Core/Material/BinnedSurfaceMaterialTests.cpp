@@ -61,6 +61,38 @@ BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_construction_test) {
   BinnedSurfaceMaterial bsmMoveAssigned(std::move(bsmAssigned));
 }
 
+/// Test the precomputed interaction constants
+BOOST_AUTO_TEST_CASE(BinnedSurfaceMaterial_constants_test) {
+  BinUtility xBinning(2, -1., 1., open, AxisDirection::AxisX);
+
+  MaterialSlab a0(Material::fromMolarDensity(1., 2., 3., 4., 5.), 6.);
+  MaterialSlab a1(Material::fromMolarDensity(2., 3., 4., 5., 6.), 7.);
+  BinnedSurfaceMaterial bsm(xBinning, MaterialSlabVector{a0, a1}, 0.5);
+
+  const Vector3 gp(0.5, 0., 0.);
+  auto constants = bsm.interactionConstants(gp, Direction::Positive(),
+                                            MaterialUpdateMode::FullUpdate);
+  BOOST_CHECK_EQUAL(constants.thickness(), a1.thickness());
+  BOOST_CHECK_EQUAL(constants.thicknessInX0(), a1.thicknessInX0());
+
+  // the split factor applies to the constants as to the slab
+  constants = bsm.interactionConstants(gp, Direction::Positive(),
+                                       MaterialUpdateMode::PreUpdate);
+  BOOST_CHECK_EQUAL(constants.thickness(),
+                    bsm.materialSlab(gp, Direction::Positive(),
+                                     MaterialUpdateMode::PreUpdate)
+                        .thickness());
+  BOOST_CHECK(bsm.interactionConstants(gp, Direction::Positive(),
+                                       MaterialUpdateMode::NoUpdate)
+                  .isVacuum());
+
+  // scaling the material scales the constants
+  bsm.scale(2.);
+  constants = bsm.interactionConstants(gp, Direction::Positive(),
+                                       MaterialUpdateMode::FullUpdate);
+  BOOST_CHECK_EQUAL(constants.thickness(), 2 * a1.thickness());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
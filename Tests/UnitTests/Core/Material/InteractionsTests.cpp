@@ -121,6 +121,58 @@ BOOST_DATA_TEST_CASE(vacuum, thickness * particle * momentum, x, i, m, q, p) {
   BOOST_CHECK_EQUAL(computeEnergyLossMode(vacuum, absPdg, m, qOverP, absQ), 0);
   BOOST_CHECK_EQUAL(
       computeMultipleScatteringTheta0(vacuum, absPdg, m, qOverP, absQ), 0);
+
+  const MaterialInteractionConstants constants(vacuum);
+  BOOST_CHECK(constants.isVacuum());
+  BOOST_CHECK_EQUAL(computeEnergyLossMean(constants, absPdg, m, qOverP, absQ),
+                    0);
+  BOOST_CHECK_EQUAL(
+      computeMultipleScatteringTheta0(constants, absPdg, m, qOverP, absQ), 0);
+}
+
+// precomputed constants -> same interactions as the slab
+BOOST_DATA_TEST_CASE(constants_consistency, thickness * particle * momentum, x,
+                     i, m, q, p) {
+  const auto slab = MaterialSlab(material, x);
+  const MaterialInteractionConstants constants(slab);
+  const auto qOverP = q / p;
+  const auto absQ = std::abs(q);
+  const auto absPdg = makeAbsolutePdgParticle(i);
+
+  // relative tolerance in percent
+  const double tol = 1e-3;
+  BOOST_CHECK_CLOSE(computeEnergyLossBethe(constants, m, qOverP, absQ),
+                    computeEnergyLossBethe(slab, m, qOverP, absQ), tol);
+  BOOST_CHECK_CLOSE(computeEnergyLossLandau(constants, m, qOverP, absQ),
+                    computeEnergyLossLandau(slab, m, qOverP, absQ), tol);
+  BOOST_CHECK_CLOSE(computeEnergyLossLandauSigma(constants, m, qOverP, absQ),
+                    computeEnergyLossLandauSigma(slab, m, qOverP, absQ), tol);
+  BOOST_CHECK_CLOSE(
+      computeEnergyLossLandauSigmaQOverP(constants, m, qOverP, absQ),
+      computeEnergyLossLandauSigmaQOverP(slab, m, qOverP, absQ), tol);
+  BOOST_CHECK_CLOSE(
+      computeEnergyLossRadiative(constants, absPdg, m, qOverP, absQ),
+      computeEnergyLossRadiative(slab, absPdg, m, qOverP, absQ), tol);
+  BOOST_CHECK_CLOSE(computeEnergyLossMean(constants, absPdg, m, qOverP, absQ),
+                    computeEnergyLossMean(slab, absPdg, m, qOverP, absQ), tol);
+  BOOST_CHECK_CLOSE(computeEnergyLossMode(constants, absPdg, m, qOverP, absQ),
+                    computeEnergyLossMode(slab, absPdg, m, qOverP, absQ), tol);
+  BOOST_CHECK_CLOSE(
+      computeMultipleScatteringTheta0(constants, absPdg, m, qOverP, absQ),
+      computeMultipleScatteringTheta0(slab, absPdg, m, qOverP, absQ), tol);
+
+  // scaling the constants is the same as scaling the slab
+  auto slabScaled = slab;
+  slabScaled.scaleThickness(2.5);
+  auto constantsScaled = constants;
+  constantsScaled.scaleThickness(2.5);
+  BOOST_CHECK_CLOSE(
+      computeEnergyLossMean(constantsScaled, absPdg, m, qOverP, absQ),
+      computeEnergyLossMean(slabScaled, absPdg, m, qOverP, absQ), tol);
+  BOOST_CHECK_CLOSE(
+      computeMultipleScatteringTheta0(constantsScaled, absPdg, m, qOverP, absQ),
+      computeMultipleScatteringTheta0(slabScaled, absPdg, m, qOverP, absQ),
+      tol);
 }
 
 // Silicon Bethe Energy Loss Validation
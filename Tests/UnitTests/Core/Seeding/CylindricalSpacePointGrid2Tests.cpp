@@ -0,0 +1,131 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SpacePointContainer2.hpp"
+#include "Acts/Seeding2/CylindricalSpacePointGrid2.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace ActsTests {
+
+namespace {
+
+CylindricalSpacePointGrid2::Config makeGridConfig() {
+  CylindricalSpacePointGrid2::Config cfg;
+  cfg.minPt = 400_MeV;
+  cfg.rMax = 200_mm;
+  cfg.zMin = -600_mm;
+  cfg.zMax = 600_mm;
+  cfg.deltaRMax = 200_mm;
+  cfg.cotThetaMax = 2;
+  cfg.impactMax = 10_mm;
+  cfg.bFieldInZ = 2_T;
+  cfg.bottomBinFinder.emplace(1, std::vector<std::pair<int, int>>{}, 0);
+  cfg.topBinFinder.emplace(1, std::vector<std::pair<int, int>>{}, 0);
+  return cfg;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedingSuite)
+
+BOOST_AUTO_TEST_CASE(CylindricalSpacePointGrid2FillContiguous) {
+  const CylindricalSpacePointGrid2::Config cfg = makeGridConfig();
+  CylindricalSpacePointGrid2 grid(cfg);
+
+  // space points on a few layers, some of them outside of the grid in z
+  std::mt19937 engine(42);
+  std::uniform_real_distribution<float> phiDist(-std::numbers::pi_v<float>,
+                                                std::numbers::pi_v<float>);
+  std::uniform_real_distribution<float> zDist(-700_mm, 700_mm);
+  const std::vector<float> radii = {30_mm, 70_mm, 120_mm, 170_mm};
+
+  SpacePointContainer2 spacePoints(SpacePointColumns::PackedZR);
+  std::vector<float> phi;
+  std::vector<float> z;
+  std::vector<float> r;
+  for (std::size_t i = 0; i < 2000; ++i) {
+    phi.push_back(phiDist(engine));
+    z.push_back(zDist(engine));
+    r.push_back(radii[i % radii.size()]);
+    auto sp = spacePoints.createSpacePoint();
+    sp.zr() = {z.back(), r.back()};
+    grid.insert(sp.index(), phi.back(), z.back(), r.back());
+  }
+  grid.sortBinsByR(spacePoints);
+
+  CylindricalSpacePointGrid2::ContiguousBins bins;
+  grid.fillContiguous(phi, z, r, bins);
+
+  BOOST_CHECK_EQUAL(bins.spacePoints.size(), grid.numberOfSpacePoints());
+  BOOST_CHECK_LT(bins.spacePoints.size(), phi.size());
+  BOOST_REQUIRE_EQUAL(bins.binRanges.size(), grid.numberOfBins());
+
+  std::uint32_t expectedBegin = 0;
+  for (std::size_t bin = 0; bin < grid.numberOfBins(); ++bin) {
+    const auto [begin, end] = bins.binRanges[bin];
+    BOOST_CHECK_EQUAL(begin, expectedBegin);
+    expectedBegin = end;
+
+    // same content as the per bin vectors, radius ordering within the bin
+    const auto& expected = grid.at(bin);
+    BOOST_REQUIRE_EQUAL(end - begin, expected.size());
+    std::vector<std::uint32_t> binSps(bins.spacePoints.begin() + begin,
+                                      bins.spacePoints.begin() + end);
+    for (std::size_t i = 1; i < binSps.size(); ++i) {
+      BOOST_CHECK_LE(r[binSps[i - 1]], r[binSps[i]]);
+    }
+    std::ranges::sort(binSps);
+    std::vector<std::uint32_t> expectedSps(expected.begin(), expected.end());
+    std::ranges::sort(expectedSps);
+    BOOST_CHECK(binSps == expectedSps);
+  }
+
+  // same groups as the binned group over the filled per bin vectors
+  std::size_t group = 0;
+  for (const auto [bottom, middle, top] : grid.binnedGroup()) {
+    BOOST_REQUIRE_LT(group, bins.numberOfGroups());
+    BOOST_CHECK_EQUAL(bins.middleBins[group], middle);
+    BOOST_CHECK_EQUAL_COLLECTIONS(bottom.begin(), bottom.end(),
+                                  bins.bottomBins(group).begin(),
+                                  bins.bottomBins(group).end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(top.begin(), top.end(),
+                                  bins.topBins(group).begin(),
+                                  bins.topBins(group).end());
+    ++group;
+  }
+  BOOST_CHECK_EQUAL(group, bins.numberOfGroups());
+  BOOST_CHECK_GT(group, 0u);
+
+  // reusing the layout overwrites the previous content
+  grid.fillContiguous(std::span(phi).first(10), std::span(z).first(10),
+                      std::span(r).first(10), bins);
+  BOOST_CHECK_LE(bins.spacePoints.size(), 10u);
+  BOOST_CHECK_EQUAL(bins.binRanges.back().second, bins.spacePoints.size());
+  BOOST_CHECK_LE(bins.numberOfGroups(), bins.spacePoints.size());
+
+  BOOST_CHECK_THROW(
+      grid.fillContiguous(phi, z, std::span(r).first(10), bins),
+      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
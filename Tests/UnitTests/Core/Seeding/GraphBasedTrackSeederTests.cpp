@@ -0,0 +1,200 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SeedContainer2.hpp"
+#include "Acts/EventData/SpacePointContainer2.hpp"
+#include "Acts/Seeding2/GbtsGeometry.hpp"
+#include "Acts/Seeding2/GbtsLayerConnection.hpp"
+#include "Acts/Seeding2/GbtsRoiDescriptor.hpp"
+#include "Acts/Seeding2/GbtsTrackingFilter.hpp"
+#include "Acts/Seeding2/GraphBasedTrackSeeder.hpp"
+#include "ActsTests/CommonHelpers/ThreadParallelExecutor.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <set>
+#include <sstream>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::Experimental;
+using namespace Acts::UnitLiterals;
+
+namespace ActsTests {
+
+namespace {
+
+const std::vector<float> barrelRadii = {40_mm, 80_mm, 120_mm, 160_mm, 200_mm};
+
+std::int32_t barrelLayerId(std::size_t layer) {
+  return 80000 + 1000 * static_cast<std::int32_t>(layer);
+}
+
+std::shared_ptr<GbtsGeometry> makeGeometry() {
+  std::vector<GbtsLayerDescription> layers;
+  for (std::size_t l = 0; l < barrelRadii.size(); ++l) {
+    layers.push_back({barrelLayerId(l), GbtsLayerType::Barrel, barrelRadii[l],
+                      -400_mm, 400_mm});
+  }
+
+  // connect every layer to the next two outer layers
+  std::vector<std::pair<std::int32_t, std::int32_t>> links;
+  for (std::size_t l = 0; l < barrelRadii.size(); ++l) {
+    for (std::size_t k = l + 1; k < std::min(l + 3, barrelRadii.size()); ++k) {
+      links.emplace_back(barrelLayerId(k), barrelLayerId(l));
+    }
+  }
+  std::stringstream connections;
+  connections << links.size() << " 0.2\n";
+  for (std::size_t i = 0; i < links.size(); ++i) {
+    connections << i << " 0 " << links[i].first << " " << links[i].second
+                << " 1 1 1\n1\n";
+  }
+
+  const GbtsLayerConnectionMap connectionMap =
+      GbtsLayerConnectionMap::fromStream(connections, false);
+  return std::make_shared<GbtsGeometry>(layers, connectionMap);
+}
+
+SpacePointContainer2 makeSpacePoints(std::size_t nTracks, std::size_t nNoise,
+                                     float bFieldInZ) {
+  SpacePointContainer2 spacePoints(
+      SpacePointColumns::X | SpacePointColumns::Y | SpacePointColumns::Z |
+      SpacePointColumns::R | SpacePointColumns::Phi);
+  auto layerColumn = spacePoints.createColumn<std::uint32_t>("layerId");
+  auto clusterWidthColumn = spacePoints.createColumn<float>("clusterWidth");
+  auto localPositionColumn = spacePoints.createColumn<float>("localPositionY");
+
+  auto addSpacePoint = [&](std::uint32_t layer, float phi, float z) {
+    const float r = barrelRadii[layer];
+    auto sp = spacePoints.createSpacePoint();
+    sp.x() = r * std::cos(phi);
+    sp.y() = r * std::sin(phi);
+    sp.z() = z;
+    sp.r() = r;
+    sp.phi() = phi;
+    sp.extra(layerColumn) = layer;
+    sp.extra(clusterWidthColumn) = 0;
+    sp.extra(localPositionColumn) = 0;
+  };
+
+  std::mt19937 engine(1234);
+  std::uniform_real_distribution<float> phiDist(-std::numbers::pi_v<float>,
+                                                std::numbers::pi_v<float>);
+  std::uniform_real_distribution<float> z0Dist(-50_mm, 50_mm);
+  std::uniform_real_distribution<float> cotThetaDist(-1.5, 1.5);
+  std::uniform_real_distribution<float> invPtDist(-1 / 2_GeV, 1 / 2_GeV);
+  std::uniform_real_distribution<float> zDist(-400_mm, 400_mm);
+
+  for (std::size_t t = 0; t < nTracks; ++t) {
+    const float phi0 = phiDist(engine);
+    const float z0 = z0Dist(engine);
+    const float cotTheta = cotThetaDist(engine);
+    // signed radius of the helix in the transverse plane
+    const float radius = 1 / (invPtDist(engine) * bFieldInZ);
+    for (std::uint32_t l = 0; l < barrelRadii.size(); ++l) {
+      const float halfAngle = std::asin(barrelRadii[l] / (2 * radius));
+      float phi = phi0 + halfAngle;
+      if (phi > std::numbers::pi_v<float>) {
+        phi -= 2 * std::numbers::pi_v<float>;
+      } else if (phi < -std::numbers::pi_v<float>) {
+        phi += 2 * std::numbers::pi_v<float>;
+      }
+      const float z = z0 + 2 * radius * halfAngle * cotTheta;
+      if (std::abs(z) < 400_mm) {
+        addSpacePoint(l, phi, z);
+      }
+    }
+  }
+
+  std::uniform_int_distribution<std::uint32_t> layerDist(
+      0, barrelRadii.size() - 1);
+  for (std::size_t n = 0; n < nNoise; ++n) {
+    addSpacePoint(layerDist(engine), phiDist(engine), zDist(engine));
+  }
+
+  return spacePoints;
+}
+
+std::vector<std::vector<SpacePointIndex2>> findSeeds(
+    const std::shared_ptr<GbtsGeometry>& geometry,
+    const SpacePointContainer2& spacePoints, std::size_t nThreads) {
+  GraphBasedTrackSeeder::Config cfg;
+  cfg.executor = std::make_shared<ThreadParallelExecutor>(nThreads);
+  const GraphBasedTrackSeeder seeder(GraphBasedTrackSeeder::DerivedConfig(cfg),
+                                     geometry);
+
+  const GbtsTrackingFilter filter(GbtsTrackingFilter::Config{}, geometry);
+  const GbtsRoiDescriptor roi(0, -4.5, 4.5, 0, -std::numbers::pi,
+                              std::numbers::pi, 0, -150_mm, 150_mm);
+  const GraphBasedTrackSeeder::Options options(2_T);
+
+  SeedContainer2 seeds;
+  seeder.createSeeds(spacePoints, roi, geometry->numLayers(), filter, options,
+                     seeds);
+
+  std::vector<std::vector<SpacePointIndex2>> result;
+  for (const auto& seed : seeds) {
+    const auto indices = seed.spacePointIndices();
+    result.emplace_back(indices.begin(), indices.end());
+  }
+  return result;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedingSuite)
+
+BOOST_AUTO_TEST_CASE(GbtsGeometryBinGroupStages) {
+  const auto geometry = makeGeometry();
+
+  const auto& binGroups = geometry->binGroups();
+  const auto& stages = geometry->binGroupStages();
+
+  BOOST_REQUIRE_GE(stages.size(), 2u);
+  BOOST_CHECK_EQUAL(stages.front(), 0u);
+  BOOST_CHECK_EQUAL(stages.back(), binGroups.size());
+
+  // the groups of a stage must not use the bin1 of each other
+  for (std::size_t s = 0; s + 1 < stages.size(); ++s) {
+    BOOST_CHECK_LE(stages[s], stages[s + 1]);
+    std::set<std::uint32_t> bin1s;
+    for (std::size_t g = stages[s]; g < stages[s + 1]; ++g) {
+      bin1s.insert(binGroups[g].first);
+    }
+    for (std::size_t g = stages[s]; g < stages[s + 1]; ++g) {
+      for (const std::uint32_t bin2 : binGroups[g].second) {
+        BOOST_CHECK(!bin1s.contains(bin2));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GraphBasedTrackSeederParallelEdges) {
+  const auto geometry = makeGeometry();
+  const SpacePointContainer2 spacePoints = makeSpacePoints(200, 500, 2_T);
+
+  const auto referenceSeeds = findSeeds(geometry, spacePoints, 1);
+  BOOST_CHECK(!referenceSeeds.empty());
+
+  // the graph and therefore the seeds do not depend on the number of chunks
+  for (const std::size_t nThreads : {2u, 4u}) {
+    const auto seeds = findSeeds(geometry, spacePoints, nThreads);
+    BOOST_CHECK(seeds == referenceSeeds);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
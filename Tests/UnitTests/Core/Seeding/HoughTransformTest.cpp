@@ -13,9 +13,11 @@
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Seeding/HoughTransformUtils.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsTests/CommonHelpers/ThreadParallelExecutor.hpp"
 
 #include <array>
 #include <format>
+#include <stdexcept>
 #include <vector>
 
 using namespace Acts;
@@ -261,6 +263,158 @@ BOOST_AUTO_TEST_CASE(hough_plane_layers_hits) {
   BOOST_CHECK_EQUAL(nHits, plane.nHits(0, 0));
 }
 
+BOOST_AUTO_TEST_CASE(compact_hough_plane) {
+  std::array<DriftCircle, 6> driftCircles{
+      DriftCircle{-427.981, -225.541, 14.5202, 0.3},
+      DriftCircle{-412.964, -199.53, 1.66237, 0.3},
+      DriftCircle{-427.981, -173.519, 12.3176, 0.3},
+      DriftCircle{-427.981, 173.519, 1.5412, 0.3},
+      DriftCircle{-442.999, 199.53, 12.3937, 0.3},
+      DriftCircle{-427.981, 225.541, 3.77967, 0.3}};
+  std::vector<std::size_t> ids(driftCircles.size());
+  std::vector<unsigned> layers(driftCircles.size());
+  for (std::size_t k = 0; k < driftCircles.size(); ++k) {
+    ids[k] = k;
+    layers[k] = k / 2;
+  }
+
+  HoughTransformUtils::HoughPlaneConfig planeCfg{200, 300};
+  HoughTransformUtils::HoughAxisRanges axisRanges{-3., 3., -2000., 2000.};
+  HoughTransformUtils::LineParametrisation<DriftCircle> houghParam =
+      [](double tanTheta, const DriftCircle& DC) {
+        return DC.y - tanTheta * DC.z -
+               DC.rDrift / std::cos(std::atan(tanTheta));
+      };
+  HoughTransformUtils::LineParametrisation<DriftCircle> houghWidth =
+      [](double, const DriftCircle& DC) {
+        return std::min(DC.rDriftError * 3., 1.0);
+      };
+
+  HoughTransformUtils::HoughPlane<std::size_t> plane(planeCfg);
+  HoughTransformUtils::CompactHoughPlane<std::size_t> compact(planeCfg);
+  HoughTransformUtils::CompactHoughPlane<std::size_t> parallel(planeCfg);
+  const ThreadParallelExecutor executor(4);
+
+  // fill twice to check that the planes are properly reset
+  for (int event = 0; event < 2; ++event) {
+    plane.reset();
+    compact.reset();
+    parallel.reset();
+    for (std::size_t k = 0; k < driftCircles.size(); ++k) {
+      plane.fill<DriftCircle>(driftCircles[k], axisRanges, houghParam,
+                              houghWidth, ids[k], layers[k]);
+      compact.fill<DriftCircle>(driftCircles[k], axisRanges, houghParam,
+                                houghWidth, ids[k], layers[k]);
+    }
+    parallel.fill<DriftCircle>(driftCircles, axisRanges, houghParam,
+                               houghWidth, ids, layers, &executor);
+    BOOST_CHECK_THROW(compact.hitIds(0, 0), std::logic_error);
+    compact.finalize();
+    parallel.finalize();
+
+    BOOST_CHECK_EQUAL(compact.maxHits(), plane.maxHits());
+    BOOST_CHECK_EQUAL(compact.maxLayers(), plane.maxLayers());
+    BOOST_CHECK_EQUAL(compact.getNonEmptyBins().size(),
+                      plane.getNonEmptyBins().size());
+    BOOST_CHECK(compact.getNonEmptyBins() == parallel.getNonEmptyBins());
+    for (std::size_t x = 0; x < planeCfg.nBinsX; ++x) {
+      for (std::size_t y = 0; y < planeCfg.nBinsY; ++y) {
+        BOOST_CHECK_EQUAL(compact.nHits(x, y), plane.nHits(x, y));
+        BOOST_CHECK_EQUAL(parallel.nHits(x, y), plane.nHits(x, y));
+        BOOST_CHECK_EQUAL(compact.nLayers(x, y), plane.nLayers(x, y));
+        BOOST_CHECK_EQUAL(parallel.nLayers(x, y), plane.nLayers(x, y));
+        auto hits = plane.hitIds(x, y);
+        auto compactHits = compact.hitIds(x, y);
+        auto parallelHits = parallel.hitIds(x, y);
+        BOOST_CHECK_EQUAL_COLLECTIONS(compactHits.begin(), compactHits.end(),
+                                      hits.begin(), hits.end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(parallelHits.begin(), parallelHits.end(),
+                                      hits.begin(), hits.end());
+      }
+    }
+
+    HoughTransformUtils::PeakFinders::IslandsAroundMaxConfig peakFinderCfg;
+    peakFinderCfg.threshold = 2.;
+    HoughTransformUtils::PeakFinders::IslandsAroundMax<std::size_t> peakFinder(
+        peakFinderCfg);
+    auto maxima = peakFinder.findPeaks(plane, axisRanges);
+    auto compactMaxima = peakFinder.findPeaks(parallel, axisRanges);
+    BOOST_CHECK(!maxima.empty());
+    BOOST_REQUIRE_EQUAL(maxima.size(), compactMaxima.size());
+    for (std::size_t i = 0; i < maxima.size(); ++i) {
+      BOOST_CHECK_CLOSE(maxima[i].x, compactMaxima[i].x, 1e-6);
+      BOOST_CHECK_CLOSE(maxima[i].y, compactMaxima[i].y, 1e-6);
+      BOOST_CHECK(maxima[i].hitIdentifiers == compactMaxima[i].hitIdentifiers);
+    }
+  }
+
+  // a failing parallel fill resets the whole plane, including the content
+  // of earlier fills
+  HoughTransformUtils::LineParametrisation<DriftCircle> failingParam =
+      [&](double tanTheta, const DriftCircle& DC) {
+        if (tanTheta > 1.) {
+          throw std::runtime_error("line parametrisation failed");
+        }
+        return houghParam(tanTheta, DC);
+      };
+  BOOST_CHECK_THROW(
+      parallel.fill<DriftCircle>(driftCircles, axisRanges, failingParam,
+                                 houghWidth, ids, layers, &executor),
+      std::runtime_error);
+  parallel.finalize();
+  BOOST_CHECK(parallel.getNonEmptyBins().empty());
+  BOOST_CHECK_EQUAL(parallel.maxHits(), 0.);
+  std::size_t nFilledCells = 0;
+  for (std::size_t x = 0; x < planeCfg.nBinsX; ++x) {
+    for (std::size_t y = 0; y < planeCfg.nBinsY; ++y) {
+      if (parallel.nHits(x, y) != 0. || parallel.nLayers(x, y) != 0.) {
+        ++nFilledCells;
+      }
+    }
+  }
+  BOOST_CHECK_EQUAL(nFilledCells, 0u);
+
+  // the plane can be filled again afterwards
+  parallel.fill<DriftCircle>(driftCircles, axisRanges, houghParam, houghWidth,
+                             ids, layers, &executor);
+  parallel.finalize();
+  BOOST_CHECK(parallel.getNonEmptyBins() == compact.getNonEmptyBins());
+  BOOST_CHECK_EQUAL(parallel.maxLayers(), compact.maxLayers());
+}
+
+BOOST_AUTO_TEST_CASE(compact_hough_plane_layers_hits) {
+  HoughTransformUtils::HoughPlaneConfig config{1, 1};
+  HoughTransformUtils::CompactHoughPlane<std::uint8_t> plane(config);
+  HoughTransformUtils::HoughPlane<std::uint8_t> reference(config);
+
+  std::uint8_t nHits = 0;
+  static constexpr std::uint8_t nLayers = 10;
+  for (std::uint8_t layer = 1; layer <= nLayers; ++layer) {
+    for (std::uint8_t hit = 0; hit < layer; ++hit) {
+      plane.fillBin(0, 0, nHits, layer);
+      reference.fillBin(0, 0, nHits++, layer);
+    }
+  }
+  // a repeated hit is skipped, a layer is counted again if another layer
+  // was filled in between, as in HoughPlane
+  plane.fillBin(0, 0, nHits - 1, nLayers);
+  reference.fillBin(0, 0, nHits - 1, nLayers);
+  plane.fillBin(0, 0, nHits, 1);
+  reference.fillBin(0, 0, nHits++, 1);
+  plane.finalize();
+
+  BOOST_CHECK_EQUAL(nLayers + 1, plane.nLayers(0, 0));
+  BOOST_CHECK_EQUAL(reference.nLayers(0, 0), plane.nLayers(0, 0));
+  BOOST_CHECK_EQUAL(nHits, plane.nHits(0, 0));
+  BOOST_CHECK_EQUAL(nHits, plane.hitIds(0, 0).size());
+
+  plane.reset();
+  plane.finalize();
+  BOOST_CHECK_EQUAL(plane.nHits(0, 0), 0.);
+  BOOST_CHECK(plane.hitIds(0, 0).empty());
+  BOOST_CHECK(plane.getNonEmptyBins().empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
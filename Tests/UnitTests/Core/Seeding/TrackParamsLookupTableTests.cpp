@@ -0,0 +1,165 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Seeding/TrackParamsLookupTable.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "ActsTests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Acts;
+
+namespace ActsTests {
+
+namespace {
+
+const GeometryIdentifier geoId =
+    GeometryIdentifier().withVolume(1).withLayer(2).withSensitive(3);
+
+TrackParamsLookupTable makeTable() {
+  // 2 x 4 bins on [-1, 1] x [-2, 2], left column points along x with
+  // q/p = 1, right column along y with q/p = 3. The top row stays empty.
+  TrackParamsLookupTable::SurfaceGrid grid;
+  grid.min = {-1., -2.};
+  grid.max = {1., 2.};
+  grid.nBins = {2, 4};
+  grid.bins.assign(8, TrackParamsLookupTable::BinContent::Zero());
+  for (std::size_t i1 = 0; i1 < 3; ++i1) {
+    grid.at(0, i1) << 1.f, 0.f, 0.f, 1.f;
+    grid.at(1, i1) << 0.f, 1.f, 0.f, 3.f;
+  }
+
+  TrackParamsLookupTable table;
+  table.addGrid(geoId, std::move(grid));
+  return table;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedingSuite)
+
+BOOST_AUTO_TEST_CASE(TrackParamsLookupTableInterpolation) {
+  const TrackParamsLookupTable table = makeTable();
+  BOOST_CHECK_EQUAL(table.size(), 1u);
+  BOOST_CHECK(table.grid(GeometryIdentifier().withVolume(2)) == nullptr);
+
+  // Bin centre returns the bin content
+  auto centre = table.interpolate(geoId, Vector2{-0.5, -1.5});
+  BOOST_REQUIRE(centre.has_value());
+  CHECK_CLOSE_ABS(centre->first, Vector3::UnitX(), 1e-6);
+  CHECK_CLOSE_ABS(centre->second, 1., 1e-6);
+
+  // Half way between the columns the direction is averaged
+  auto between = table.interpolate(geoId, Vector2{0., -1.});
+  BOOST_REQUIRE(between.has_value());
+  CHECK_CLOSE_ABS(between->first, Vector3(1., 1., 0.).normalized(), 1e-6);
+  CHECK_CLOSE_ABS(between->second, 2., 1e-6);
+
+  // Empty bins are ignored, positions outside of the grid are rejected
+  auto nextToEmpty = table.interpolate(geoId, Vector2{-0.5, 1.});
+  BOOST_REQUIRE(nextToEmpty.has_value());
+  CHECK_CLOSE_ABS(nextToEmpty->second, 1., 1e-6);
+  BOOST_CHECK(!table.interpolate(geoId, Vector2{-0.5, 1.9}).has_value());
+  BOOST_CHECK(!table.interpolate(geoId, Vector2{1.5, 0.}).has_value());
+  BOOST_CHECK(
+      !table.interpolate(GeometryIdentifier(), Vector2{0., 0.}).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(TrackParamsLookupTableEstimate) {
+  auto gctx = GeometryContext::dangerouslyDefaultConstruct();
+  auto surface = Surface::makeShared<PlaneSurface>(
+      Transform3::Identity(), std::make_shared<RectangleBounds>(1., 2.));
+  surface->assignGeometryId(geoId);
+
+  const TrackParamsLookupTable table = makeTable();
+  auto params = table.estimate(gctx, *surface, Vector3{-0.5, -1.5, 0.}, 5.);
+  BOOST_REQUIRE(params.has_value());
+  CHECK_CLOSE_ABS(params->segment<3>(eFreePos0), Vector3(-0.5, -1.5, 0.),
+                  1e-9);
+  CHECK_CLOSE_ABS((*params)[eFreeTime], 5., 1e-9);
+  CHECK_CLOSE_ABS(params->segment<3>(eFreeDir0), Vector3::UnitX(), 1e-6);
+  CHECK_CLOSE_ABS((*params)[eFreeQOverP], 1., 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(TrackParamsLookupTableBinaryIo) {
+  const TrackParamsLookupTable table = makeTable();
+
+  std::stringstream stream;
+  table.toBinaryStream(stream);
+  const auto readBack = TrackParamsLookupTable::fromBinaryStream(stream);
+
+  BOOST_CHECK_EQUAL(readBack.size(), table.size());
+  const auto* original = table.grid(geoId);
+  const auto* restored = readBack.grid(geoId);
+  BOOST_REQUIRE(restored != nullptr);
+  BOOST_CHECK_EQUAL(restored->nBins[0], original->nBins[0]);
+  BOOST_CHECK_EQUAL(restored->nBins[1], original->nBins[1]);
+  BOOST_CHECK_EQUAL(restored->min[1], original->min[1]);
+  BOOST_CHECK_EQUAL(restored->max[0], original->max[0]);
+  for (std::size_t i = 0; i < original->bins.size(); ++i) {
+    BOOST_CHECK((restored->bins[i] == original->bins[i]).all());
+  }
+
+  std::stringstream garbage("not a lookup table");
+  BOOST_CHECK_THROW(TrackParamsLookupTable::fromBinaryStream(garbage),
+                    std::runtime_error);
+
+  TrackParamsLookupTable::SurfaceGrid invalid;
+  invalid.min = {0., 0.};
+  invalid.max = {1., 1.};
+  invalid.nBins = {2, 2};
+  TrackParamsLookupTable empty;
+  BOOST_CHECK_THROW(empty.addGrid(geoId, invalid), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(TrackParamsLookupTableCorruptBinaryStream) {
+  std::stringstream stream;
+  makeTable().toBinaryStream(stream);
+  const std::string valid = stream.str();
+
+  // magic, version, number of grids, geometry id and the first axis range
+  // precede the number of bins of the first axis
+  constexpr std::size_t nBinsOffset = 8 + 4 + 8 + 8 + 2 * 8;
+  auto withBins = [&](std::uint64_t nBins0, std::uint64_t nBins1) {
+    std::string data = valid;
+    std::memcpy(data.data() + nBinsOffset, &nBins0, sizeof(nBins0));
+    std::memcpy(data.data() + nBinsOffset + 3 * 8, &nBins1, sizeof(nBins1));
+    return std::stringstream(data);
+  };
+
+  for (const auto& [nBins0, nBins1] :
+       std::vector<std::pair<std::uint64_t, std::uint64_t>>{
+           {0, 4},
+           {4, 0},
+           {std::uint64_t{1} << 40, 4},
+           {std::uint64_t{1} << 32, std::uint64_t{1} << 32},
+           {std::numeric_limits<std::uint64_t>::max(), 2}}) {
+    auto corrupt = withBins(nBins0, nBins1);
+    BOOST_CHECK_THROW(TrackParamsLookupTable::fromBinaryStream(corrupt),
+                      std::runtime_error);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
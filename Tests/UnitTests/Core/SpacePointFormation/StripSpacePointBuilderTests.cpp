@@ -0,0 +1,147 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/SpacePointFormation2/StripSpacePointBuilder.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <numbers>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace Acts;
+
+namespace ActsTests {
+
+namespace {
+
+const auto gctx = GeometryContext::dangerouslyDefaultConstruct();
+
+/// Barrel module at radius r facing the beam line, with the strips rotated
+/// by the given stereo angle around the module normal
+std::shared_ptr<PlaneSurface> makeModule(double r, double stereo) {
+  RotationMatrix3 rotation;
+  // local x along global y, local y along global z, normal along global x
+  rotation.col(0) = Vector3::UnitY();
+  rotation.col(1) = Vector3::UnitZ();
+  rotation.col(2) = Vector3::UnitX();
+  Transform3 transform = Transform3::Identity();
+  transform.translation() = Vector3(r, 0, 0);
+  transform.linear() = rotation * AngleAxis3(stereo, Vector3::UnitZ());
+  return Surface::makeShared<PlaneSurface>(
+      transform, std::make_shared<RectangleBounds>(20., 50.));
+}
+
+StripSpacePointBuilder::StripEnds stripEnds(const Surface& surface,
+                                            double loc0) {
+  return {surface.localToGlobal(gctx, Vector2(loc0, 50.), Vector3::Zero()),
+          surface.localToGlobal(gctx, Vector2(loc0, -50.), Vector3::Zero())};
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SpacePointFormationSuite)
+
+BOOST_AUTO_TEST_CASE(ModulePairSpacePointsMatchSinglePairs) {
+  auto surface1 = makeModule(300., 0.02);
+  auto surface2 = makeModule(302., -0.02);
+
+  const auto geometry = StripSpacePointBuilder::computeModulePairGeometry(
+      gctx, *surface1, *surface2);
+
+  // the cached strip ends agree with the surface
+  for (double loc0 : {-10., 0., 7.5}) {
+    auto cached = geometry.first.stripEnds(loc0);
+    auto expected = stripEnds(*surface1, loc0);
+    BOOST_CHECK_SMALL((cached.top - expected.top).norm(), 1e-9);
+    BOOST_CHECK_SMALL((cached.bottom - expected.bottom).norm(), 1e-9);
+  }
+  BOOST_CHECK_CLOSE(geometry.stereoAngle, 0.04, 1e-6);
+
+  // clusters of straight tracks from the origin
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> yDist(-18., 18.);
+  std::uniform_real_distribution<double> zDist(-55., 55.);
+  std::vector<StripSpacePointBuilder::StripCluster> clusters1;
+  std::vector<StripSpacePointBuilder::StripCluster> clusters2;
+  for (std::size_t i = 0; i < 40; ++i) {
+    Vector3 direction(300., yDist(rng), zDist(rng));
+    for (auto [surface, clusters] :
+         {std::pair{surface1.get(), &clusters1},
+          std::pair{surface2.get(), &clusters2}}) {
+      Vector3 global = direction * (surface->center(gctx).x() / direction.x());
+      Vector2 local = surface->localToGlobalTransform(gctx)
+                          .inverse()
+                          .linear()
+                          .topRows<2>() *
+                      (global - surface->center(gctx));
+      clusters->push_back({local.x(), 0.01});
+    }
+  }
+  // an extra cluster without partner
+  clusters1.push_back({15., 0.01});
+
+  StripSpacePointBuilder::ClusterPairingOptions pairingOptions;
+  pairingOptions.maxAnglePhi = 0.01;
+  pairingOptions.maxAngleTheta = 0.05;
+  const StripSpacePointBuilder::ConstrainedOptions options{};
+
+  std::vector<StripSpacePointBuilder::StripPairSpacePoint> spacePoints;
+  StripSpacePointBuilder::computeModulePairSpacePoints(
+      geometry, clusters1, clusters2, pairingOptions, options, spacePoints);
+
+  // reference with the single pair functions
+  std::size_t iSpacePoint = 0;
+  for (std::size_t i1 = 0; i1 < clusters1.size(); ++i1) {
+    auto ends1 = stripEnds(*surface1, clusters1[i1].loc0);
+    std::optional<double> minDistance;
+    std::size_t best2 = 0;
+    for (std::size_t i2 = 0; i2 < clusters2.size(); ++i2) {
+      auto ends2 = stripEnds(*surface2, clusters2[i2].loc0);
+      auto distance = StripSpacePointBuilder::computeClusterPairDistance(
+          0.5 * (ends1.top + ends1.bottom), 0.5 * (ends2.top + ends2.bottom),
+          pairingOptions);
+      if (distance.ok() && (!minDistance || *distance < *minDistance)) {
+        minDistance = *distance;
+        best2 = i2;
+      }
+    }
+    if (!minDistance) {
+      continue;
+    }
+    auto ends2 = stripEnds(*surface2, clusters2[best2].loc0);
+    auto position = StripSpacePointBuilder::computeConstrainedSpacePoint(
+        ends1, ends2, options);
+    if (!position.ok()) {
+      continue;
+    }
+    Vector2 varianceZR = StripSpacePointBuilder::computeVarianceZR(
+        gctx, *surface1, *position, clusters1[i1].variance,
+        clusters2[best2].variance, geometry.stereoAngle);
+
+    BOOST_REQUIRE_LT(iSpacePoint, spacePoints.size());
+    const auto& sp = spacePoints[iSpacePoint++];
+    BOOST_CHECK_EQUAL(sp.cluster1, i1);
+    BOOST_CHECK_EQUAL(sp.cluster2, best2);
+    BOOST_CHECK_SMALL((sp.position - *position).norm(), 1e-9);
+    BOOST_CHECK_CLOSE(sp.varianceZR[0], varianceZR[0], 1e-6);
+    BOOST_CHECK_CLOSE(sp.varianceZR[1], varianceZR[1], 1e-6);
+  }
+  BOOST_CHECK_EQUAL(iSpacePoint, spacePoints.size());
+  BOOST_CHECK_GE(spacePoints.size(), 30u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
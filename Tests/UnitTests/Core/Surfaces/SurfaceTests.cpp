@@ -17,6 +17,7 @@
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Surfaces/SurfaceTransformStore.hpp"
 #include "ActsTests/CommonHelpers/DetectorElementStub.hpp"
 #include "ActsTests/CommonHelpers/FloatComparisons.hpp"
 #include "ActsTests/CommonHelpers/PredefinedMaterials.hpp"
@@ -181,6 +182,47 @@ BOOST_AUTO_TEST_CASE(EqualityOperators) {
   const auto sharedSurfacePtr = surfacePtr->getSharedPtr();
   BOOST_CHECK(*surfacePtr == *sharedSurfacePtr);
 }
+
+/// Unit test for surfaces referring to a shared transform store
+BOOST_AUTO_TEST_CASE(SurfaceTransformStoreTests) {
+  auto pPlanarBound = std::make_shared<const RectangleBounds>(5., 10.);
+  Transform3 pTransform1{Translation3{0., 1., 2.}};
+  Transform3 pTransform2{Translation3{3., 4., 5.}};
+  auto surface1 = Surface::makeShared<PlaneSurface>(pTransform1, pPlanarBound);
+  auto surface2 = Surface::makeShared<PlaneSurface>(pTransform1, pPlanarBound);
+
+  auto store = std::make_shared<SurfaceTransformStore>();
+  std::size_t index1 = store->insert(pTransform1);
+  std::size_t index2 = store->insert(pTransform2);
+  BOOST_CHECK_EQUAL(store->size(), 2u);
+
+  BOOST_CHECK_THROW(surface1->assignTransformStore(store, 2u),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(surface1->assignTransformStore(nullptr, 0u),
+                    std::invalid_argument);
+
+  surface1->assignTransformStore(store, index1);
+  BOOST_CHECK_EQUAL(surface1->transformStore(), store.get());
+  BOOST_CHECK_EQUAL(surface1->transformStoreIndex(), index1);
+  BOOST_CHECK_EQUAL(&surface1->localToGlobalTransform(tgContext),
+                    &store->transform(index1));
+  BOOST_CHECK(*surface1 == *surface2);
+
+  surface2->assignTransformStore(store, index2);
+  BOOST_CHECK(*surface1 != *surface2);
+
+  // Alignment updates are picked up by the surfaces
+  store->setTransform(index2, pTransform1);
+  BOOST_CHECK(*surface1 == *surface2);
+  CHECK_CLOSE_OR_SMALL(surface2->center(tgContext), pTransform1.translation(),
+                       1e-6, 1e-9);
+
+  // Surfaces with a placement cannot refer to the store
+  DetectorElementStub detElement{pTransform1, pPlanarBound, 0.2};
+  BOOST_CHECK_THROW(detElement.surface().assignTransformStore(store, index1),
+                    std::logic_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
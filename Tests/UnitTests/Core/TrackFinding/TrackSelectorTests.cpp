@@ -22,9 +22,11 @@
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/TrackFinding/TrackSelector.hpp"
 #include "Acts/Utilities/AngleHelpers.hpp"
+#include "ActsTests/CommonHelpers/ThreadParallelExecutor.hpp"
 
 #include <limits>
 #include <numbers>
+#include <random>
 
 using namespace Acts;
 namespace bdata = boost::unit_test::data;
@@ -836,6 +838,102 @@ BOOST_AUTO_TEST_CASE(SubsetHitCountCut) {
   BOOST_CHECK(selectorVol7And8.isValidTrack(trackVol7));
 }
 
+BOOST_AUTO_TEST_CASE(BatchSelectionMatchesTrackByTrack) {
+  using namespace Acts::UnitLiterals;
+
+  std::vector<std::shared_ptr<PlaneSurface>> surfaces;
+  for (unsigned int vol : {7u, 8u}) {
+    for (unsigned int sen = 1; sen <= 5; ++sen) {
+      auto srf =
+          CurvilinearSurface(Vector3::Zero(), Vector3::UnitZ()).planeSurface();
+      srf->assignGeometryId(
+          GeometryIdentifier{}.withVolume(vol).withLayer(2).withSensitive(sen));
+      surfaces.push_back(srf);
+    }
+  }
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+
+  std::mt19937 rng{1234};
+  std::uniform_real_distribution<double> theta(0.05, std::numbers::pi - 0.05);
+  std::uniform_real_distribution<double> phi(-std::numbers::pi,
+                                             std::numbers::pi);
+  std::uniform_real_distribution<double> loc(-3., 3.);
+  std::uniform_real_distribution<double> qOverP(0.1 / 1_GeV, 2. / 1_GeV);
+  std::uniform_int_distribution<unsigned int> count(0, 6);
+  std::uniform_int_distribution<std::size_t> surface(0, surfaces.size() - 1);
+
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  for (std::size_t i = 0; i < 500; ++i) {
+    auto track = tc.makeTrack();
+    track.parameters() << loc(rng), loc(rng), phi(rng), theta(rng),
+        qOverP(rng), loc(rng);
+    if (i % 7 != 0) {
+      track.setReferenceSurface(perigee);
+    }
+    track.nMeasurements() = 2 * count(rng);
+    track.nHoles() = count(rng);
+    track.nOutliers() = count(rng);
+    track.nSharedHits() = count(rng);
+    track.chi2() = 3.f * count(rng);
+
+    for (unsigned int j = count(rng); j > 0; --j) {
+      auto ts = track.appendTrackState();
+      ts.setReferenceSurface(surfaces[surface(rng)]);
+      ts.typeFlags().setHasMeasurement();
+    }
+  }
+
+  auto checkSelector = [&](const TrackSelector& selector) {
+    std::vector<std::uint8_t> expected;
+    for (const auto& track : tc) {
+      expected.push_back(selector.isValidTrack(track) ? 1 : 0);
+    }
+    // The configurations must neither select everything nor nothing
+    BOOST_CHECK_NE(std::ranges::count(expected, 1), 0);
+    BOOST_CHECK_NE(std::ranges::count(expected, 0), 0);
+
+    const ThreadParallelExecutor executor(3);
+    BOOST_CHECK(selector.selectionMask(tc) == expected);
+    BOOST_CHECK(selector.selectionMask(tc, &executor) == expected);
+
+    TrackContainer output{VectorTrackContainer{}, VectorMultiTrajectory{}};
+    selector.selectTracks(tc, output, &executor);
+    const auto nSelected = std::ranges::count(expected, 1);
+    BOOST_CHECK_EQUAL(output.size(), static_cast<std::size_t>(nSelected));
+  };
+
+  TrackSelector::Config single;
+  single.pt(0.8_GeV, 8_GeV).eta(-1.5, 2.).loc0(-2., 2.);
+  single.maxHoles = 4;
+  single.measurementCounter.addCounter({GeometryIdentifier{}.withVolume(7)},
+                                       1);
+  checkSelector(TrackSelector{single});
+
+  single.requireReferenceSurface = false;
+  checkSelector(TrackSelector{single});
+
+  TrackSelector::EtaBinnedConfig binned{0.2};
+  binned
+      .addCuts(1.,
+               [](auto& c) {
+                 c.minMeasurements = 4;
+                 c.maxChi2 = 12.;
+               })
+      .addCuts(2.,
+               [](auto& c) {
+                 c.maxHolesAndOutliers = 6;
+                 c.measurementCounter.addCounter(
+                     {GeometryIdentifier{}.withVolume(7)}, 1);
+                 c.measurementCounter.addCounter(
+                     {GeometryIdentifier{}.withVolume(8)}, 1);
+               })
+      .addCuts([](auto& c) {
+        c.maxSharedHits = 3;
+        c.phi(-2., 2.);
+      });
+  checkSelector(TrackSelector{binned});
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
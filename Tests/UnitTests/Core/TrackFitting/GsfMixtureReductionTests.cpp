@@ -18,6 +18,7 @@
 #include "Acts/Utilities/Zip.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <memory>
 #include <numbers>
@@ -220,6 +221,44 @@ BOOST_AUTO_TEST_CASE(test_mixture_reduction) {
   BOOST_CHECK_CLOSE(cmps[0].weight, 1.0, 1.e-8);
 }
 
+BOOST_AUTO_TEST_CASE(test_distance_queue_vs_matrix) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> qopDist(0.1, 5.0);
+  std::uniform_real_distribution<double> varDist(0.5, 2.0);
+
+  const std::size_t NComps = 30;
+  std::vector<GsfComponent> cmps;
+  for (auto i = 0ul; i < NComps; ++i) {
+    GsfComponent cmp = makeDefaultComponent(1.0);
+    // Use rounded values for half of the components to provoke ties
+    cmp.boundPars[eBoundQOverP] =
+        i % 2 == 0 ? std::round(qopDist(rng)) : qopDist(rng);
+    cmp.boundCov(eBoundQOverP, eBoundQOverP) = i % 2 == 0 ? 1.0 : varDist(rng);
+    cmps.push_back(cmp);
+  }
+
+  detail::Gsf::SymmetricKLDistanceMatrix mat(cmps);
+  detail::Gsf::SymmetricKLDistanceQueue queue(cmps);
+
+  for (auto remaining = NComps; remaining > 1; --remaining) {
+    const auto [i, j] = mat.minDistancePair();
+    const auto [qi, qj] = queue.minDistancePair();
+    BOOST_CHECK_EQUAL(i, qi);
+    BOOST_CHECK_EQUAL(j, qj);
+    BOOST_CHECK_EQUAL(mat.at(i, j), queue.at(qi, qj));
+
+    // Some artificial merge which only needs to be deterministic
+    cmps[i].boundPars[eBoundQOverP] = 0.5 * (cmps[i].boundPars[eBoundQOverP] +
+                                             cmps[j].boundPars[eBoundQOverP]);
+    cmps[i].boundCov(eBoundQOverP, eBoundQOverP) += 0.1;
+
+    mat.recomputeAssociatedDistances(i, cmps);
+    mat.maskAssociatedDistances(j);
+    queue.removeComponent(j);
+    queue.updateComponent(i, cmps[i]);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_weight_cut_reduction) {
   std::shared_ptr<PlaneSurface> dummy =
       CurvilinearSurface(Vector3{0, 0, 0}, Vector3{1, 0, 0}).planeSurface();
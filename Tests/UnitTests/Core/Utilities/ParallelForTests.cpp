@@ -0,0 +1,138 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/ParallelFor.hpp"
+#include "ActsTests/CommonHelpers/ThreadParallelExecutor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Acts;
+
+namespace ActsTests {
+
+namespace {
+
+/// Executor which runs the chunks in reverse order on the calling thread
+struct ReverseExecutor final : public ParallelExecutor {
+  std::size_t nChunks = 0;
+
+  std::size_t concurrency() const override { return nChunks; }
+
+  void run(std::size_t n,
+           const std::function<void(std::size_t)>& task) const override {
+    for (std::size_t chunk = n; chunk > 0; --chunk) {
+      task(chunk - 1);
+    }
+  }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(UtilitiesSuite)
+
+BOOST_AUTO_TEST_CASE(ParallelForChunks) {
+  for (const std::size_t n : {0u, 1u, 7u, 100u, 1000u}) {
+    for (const std::size_t nThreads : {0u, 1u, 3u, 8u}) {
+      const ThreadParallelExecutor executor(nThreads);
+      std::vector<std::atomic<int>> visits(n);
+      std::vector<std::size_t> chunkBegins(nThreads + 1, n + 1);
+      const std::size_t nChunks = parallelFor(
+          &executor, n,
+          [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+            chunkBegins.at(chunk) = begin;
+            for (std::size_t i = begin; i < end; ++i) {
+              ++visits[i];
+            }
+          },
+          10);
+
+      // every index is visited exactly once in contiguous ascending chunks
+      for (const auto& v : visits) {
+        BOOST_CHECK_EQUAL(v, 1);
+      }
+      BOOST_CHECK_LE(nChunks, maxParallelChunks(&executor));
+      BOOST_CHECK_EQUAL(nChunks == 0, n == 0);
+      for (std::size_t chunk = 0; chunk + 1 < nChunks; ++chunk) {
+        BOOST_CHECK_LT(chunkBegins[chunk], chunkBegins[chunk + 1]);
+      }
+      // chunks are not smaller than the minimum chunk size
+      if (nChunks > 1) {
+        BOOST_CHECK_GE(n / nChunks, 10u);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForBoundaries) {
+  // the chunk boundaries do not depend on the order the chunks are run in
+  ReverseExecutor reverse;
+  reverse.nChunks = 4;
+  const ThreadParallelExecutor threads(4);
+  std::vector<std::size_t> reverseBegins(4);
+  std::vector<std::size_t> threadBegins(4);
+  BOOST_CHECK_EQUAL(
+      parallelFor(&reverse, 100,
+                  [&](std::size_t chunk, std::size_t begin, std::size_t) {
+                    reverseBegins[chunk] = begin;
+                  }),
+      4u);
+  BOOST_CHECK_EQUAL(
+      parallelFor(&threads, 100,
+                  [&](std::size_t chunk, std::size_t begin, std::size_t) {
+                    threadBegins[chunk] = begin;
+                  }),
+      4u);
+  BOOST_CHECK(reverseBegins == threadBegins);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForSerial) {
+  // without an executor the whole range is processed on the calling thread
+  const auto caller = std::this_thread::get_id();
+  bool runInline = false;
+  std::size_t rangeEnd = 0;
+  BOOST_CHECK_EQUAL(maxParallelChunks(nullptr), 1u);
+  BOOST_CHECK_EQUAL(
+      parallelFor(nullptr, 100,
+                  [&](std::size_t, std::size_t, std::size_t end) {
+                    runInline = std::this_thread::get_id() == caller;
+                    rangeEnd = end;
+                  }),
+      1u);
+  BOOST_CHECK(runInline);
+  BOOST_CHECK_EQUAL(rangeEnd, 100u);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForExceptions) {
+  for (const std::size_t nThreads : {1u, 4u}) {
+    const ThreadParallelExecutor executor(nThreads);
+    std::atomic<std::size_t> nFinished = 0;
+    BOOST_CHECK_THROW(
+        parallelFor(&executor, 100,
+                    [&](std::size_t chunk, std::size_t, std::size_t) {
+                      if (chunk + 1 == nThreads) {
+                        throw std::runtime_error("chunk failure");
+                      }
+                      ++nFinished;
+                    }),
+        std::runtime_error);
+    // the other chunks still ran to completion
+    BOOST_CHECK_EQUAL(nFinished, nThreads - 1);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -20,7 +20,10 @@
 #include <memory>
 #include <numbers>
 #include <optional>
+#include <random>
+#include <ranges>
 #include <utility>
+#include <vector>
 
 using namespace Acts;
 using namespace Acts::UnitLiterals;
@@ -648,6 +651,129 @@ BOOST_AUTO_TEST_CASE(track_removing) {
   CHECK_CLOSE_ABS(0., sixthDensitySum2D, 1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(dense_density_map) {
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3(0., 0., 0.));
+
+  // Random tracks with correlated impact parameters
+  std::mt19937 rng(2718);
+  std::uniform_real_distribution<double> z0Dist(-2., 2.);
+  std::uniform_real_distribution<double> t0Dist(-0.5, 0.5);
+  std::uniform_real_distribution<double> d0Dist(-0.02, 0.02);
+  std::uniform_real_distribution<double> sigmaDist(0.02, 0.1);
+  std::uniform_real_distribution<double> rhoDist(-0.5, 0.5);
+  std::vector<BoundTrackParameters> tracks;
+  for (std::size_t i = 0; i < 50; ++i) {
+    BoundVector paramVec;
+    paramVec << d0Dist(rng), z0Dist(rng), 0, 0, 0, t0Dist(rng);
+    Covariance covMat = Covariance::Identity();
+    const double sigmaD = sigmaDist(rng);
+    const double sigmaZ = sigmaDist(rng);
+    const double sigmaT = sigmaDist(rng);
+    covMat(eBoundLoc0, eBoundLoc0) = sigmaD * sigmaD;
+    covMat(eBoundLoc1, eBoundLoc1) = sigmaZ * sigmaZ;
+    covMat(eBoundTime, eBoundTime) = sigmaT * sigmaT;
+    covMat(eBoundLoc0, eBoundLoc1) = rhoDist(rng) * sigmaD * sigmaZ;
+    covMat(eBoundLoc1, eBoundLoc0) = covMat(eBoundLoc0, eBoundLoc1);
+    covMat(eBoundLoc1, eBoundTime) = rhoDist(rng) * sigmaZ * sigmaT;
+    covMat(eBoundTime, eBoundLoc1) = covMat(eBoundLoc1, eBoundTime);
+    tracks.emplace_back(perigeeSurface, paramVec, covMat,
+                        ParticleHypothesis::pion());
+  }
+
+  for (bool useTime : {false, true}) {
+    AdaptiveGridTrackDensity::Config cfg;
+    cfg.spatialBinExtent = 0.01;
+    cfg.temporalBinExtent = 0.02;
+    cfg.spatialWindow = {-2.5, 2.5};
+    cfg.temporalWindow = {-1., 1.};
+    cfg.useTime = useTime;
+    AdaptiveGridTrackDensity grid(cfg);
+
+    AdaptiveGridTrackDensity::DensityMap mainDensityMap;
+    auto mainDenseDensityMap = grid.makeDenseDensityMap();
+    BOOST_CHECK(mainDenseDensityMap.empty());
+    BOOST_CHECK_EQUAL(mainDenseDensityMap.nZBins(), 501u);
+    BOOST_CHECK_EQUAL(mainDenseDensityMap.nTBins(), useTime ? 101u : 1u);
+
+    std::vector<AdaptiveGridTrackDensity::DensityMap> trackDensityMaps;
+    std::vector<AdaptiveGridTrackDensity::DenseTrackDensity> trackDensities;
+    for (const auto& trk : tracks) {
+      trackDensityMaps.push_back(grid.addTrack(trk, mainDensityMap));
+      trackDensities.push_back(grid.addTrack(trk, mainDenseDensityMap));
+    }
+    BOOST_CHECK(!mainDenseDensityMap.empty());
+
+    auto checkSameDensity = [&]() {
+      for (const auto& [bin, density] : mainDensityMap) {
+        CHECK_CLOSE_OR_SMALL(mainDenseDensityMap.at(bin), density, 1e-4,
+                             1e-3);
+      }
+    };
+    checkSameDensity();
+
+    auto res = grid.getMaxZTPositionAndWidth(mainDensityMap);
+    auto denseRes = grid.getMaxZTPositionAndWidth(mainDenseDensityMap);
+    BOOST_REQUIRE(res.ok());
+    BOOST_REQUIRE(denseRes.ok());
+    CHECK_CLOSE_ABS(res->first.first, denseRes->first.first, 1e-9);
+    CHECK_CLOSE_ABS(res->first.second, denseRes->first.second, 1e-9);
+    CHECK_CLOSE_REL(res->second, denseRes->second, 1e-3);
+
+    // Removing tracks gives the same density as for the sparse map
+    for (std::size_t i = 0; i < tracks.size(); i += 2) {
+      grid.subtractTrack(trackDensityMaps[i], mainDensityMap);
+      grid.subtractTrack(trackDensities[i], mainDenseDensityMap);
+    }
+    checkSameDensity();
+
+    res = grid.getMaxZTPositionAndWidth(mainDensityMap);
+    denseRes = grid.getMaxZTPositionAndWidth(mainDenseDensityMap);
+    BOOST_REQUIRE(res.ok());
+    BOOST_REQUIRE(denseRes.ok());
+    CHECK_CLOSE_ABS(res->first.first, denseRes->first.first, 1e-9);
+    CHECK_CLOSE_ABS(res->first.second, denseRes->first.second, 1e-9);
+
+    // The highest sum search yields the same position as well
+    AdaptiveGridTrackDensity::Config sumCfg = cfg;
+    sumCfg.useHighestSumZPosition = true;
+    sumCfg.maxRelativeDensityDev = 0.5;
+    AdaptiveGridTrackDensity sumGrid(sumCfg);
+    auto sumRes = sumGrid.getMaxZTPosition(mainDensityMap);
+    auto denseSumRes = sumGrid.getMaxZTPosition(mainDenseDensityMap);
+    BOOST_REQUIRE(sumRes.ok());
+    BOOST_REQUIRE(denseSumRes.ok());
+    CHECK_CLOSE_ABS(sumRes->first, denseSumRes->first, 1e-9);
+
+    // Clearing keeps the grid but resets the densities
+    mainDenseDensityMap.clear();
+    BOOST_CHECK(mainDenseDensityMap.empty());
+    BOOST_CHECK_EQUAL(mainDenseDensityMap.nZBins(), 501u);
+    for (const auto& [bin, density] : mainDensityMap) {
+      BOOST_CHECK_EQUAL(mainDenseDensityMap.at(bin), 0.f);
+    }
+
+    // Refilling in a different order extends the filled ranges in both
+    // directions and yields the same densities
+    AdaptiveGridTrackDensity::DensityMap refDensityMap;
+    for (const auto& trk : tracks) {
+      grid.addTrack(trk, refDensityMap);
+    }
+    for (const auto& trk : tracks | std::views::reverse) {
+      grid.addTrack(trk, mainDenseDensityMap);
+    }
+    for (const auto& [bin, density] : refDensityMap) {
+      CHECK_CLOSE_OR_SMALL(mainDenseDensityMap.at(bin), density, 1e-4, 1e-3);
+    }
+    res = grid.getMaxZTPositionAndWidth(refDensityMap);
+    denseRes = grid.getMaxZTPositionAndWidth(mainDenseDensityMap);
+    BOOST_REQUIRE(res.ok());
+    BOOST_REQUIRE(denseRes.ok());
+    CHECK_CLOSE_ABS(res->first.first, denseRes->first.first, 1e-9);
+    CHECK_CLOSE_ABS(res->first.second, denseRes->first.second, 1e-9);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -237,6 +237,11 @@ BOOST_AUTO_TEST_CASE(grid_density_vertex_finder_track_caching_test) {
   cfg2.extractParameters.connect<&InputTrack::extractParameters>();
   Finder2 finder2(cfg2);
 
+  // Same seeder accumulating the densities on a dense grid
+  Finder2::Config cfg3 = cfg2;
+  cfg3.useDenseDensityMap = true;
+  Finder2 finder3(cfg3);
+
   int mySeed = 31415;
   std::mt19937 gen(mySeed);
   unsigned int nTracks = 200;
@@ -279,6 +284,7 @@ BOOST_AUTO_TEST_CASE(grid_density_vertex_finder_track_caching_test) {
 
   IVertexFinder::State state1 = finder1.makeState(magFieldContext);
   IVertexFinder::State state2 = finder2.makeState(magFieldContext);
+  IVertexFinder::State state3 = finder3.makeState(magFieldContext);
 
   double zResult1 = 0;
   double zResult2 = 0;
@@ -315,6 +321,11 @@ BOOST_AUTO_TEST_CASE(grid_density_vertex_finder_track_caching_test) {
 
   CHECK_CLOSE_REL(zResult1, zResult2, 1e-5);
 
+  auto denseRes = finder3.find(inputTracks, vertexingOptions, state3);
+  BOOST_REQUIRE(denseRes.ok());
+  BOOST_REQUIRE(!(*denseRes).empty());
+  CHECK_CLOSE_REL((*denseRes).back().position()[eZ], zResult2, 1e-5);
+
   int trkCount = 0;
   std::vector<InputTrack> removedTracks;
   for (const auto& trk : trackVec) {
@@ -326,6 +337,7 @@ BOOST_AUTO_TEST_CASE(grid_density_vertex_finder_track_caching_test) {
 
   state1.as<Finder1::State>().tracksToRemove = removedTracks;
   state2.as<Finder2::State>().tracksToRemove = removedTracks;
+  state3.as<Finder2::State>().tracksToRemove = removedTracks;
 
   auto res3 = finder1.find(inputTracks, vertexingOptions, state1);
   if (!res3.ok()) {
@@ -360,6 +372,11 @@ BOOST_AUTO_TEST_CASE(grid_density_vertex_finder_track_caching_test) {
   }
 
   CHECK_CLOSE_REL(zResult1, zResult2, 1e-5);
+
+  denseRes = finder3.find(inputTracks, vertexingOptions, state3);
+  BOOST_REQUIRE(denseRes.ok());
+  BOOST_REQUIRE(!(*denseRes).empty());
+  CHECK_CLOSE_REL((*denseRes).back().position()[eZ], zResult2, 1e-5);
 }
 
 ///
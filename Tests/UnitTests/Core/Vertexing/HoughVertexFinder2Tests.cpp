@@ -11,8 +11,10 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/SpacePointContainer2.hpp"
 #include "Acts/Vertexing/HoughVertexFinder2.hpp"
+#include "ActsTests/CommonHelpers/ThreadParallelExecutor.hpp"
 
 #include <cmath>
+#include <memory>
 #include <random>
 #include <stdexcept>
 #include <vector>
@@ -179,6 +181,52 @@ BOOST_AUTO_TEST_CASE(hough_vertex_finder_full_test) {
   BOOST_CHECK_EQUAL(vtxFound, nEvents);
 }
 
+/// @brief Unit test for HoughVertexFinder2. Filling the Hough plane with
+/// several threads has to give exactly the same vertex as a single thread
+BOOST_AUTO_TEST_CASE(hough_vertex_finder_threads_test) {
+  HoughVertexFinder2::Config houghVtxCfg;
+  houghVtxCfg.targetSPs = 1000;
+  houghVtxCfg.minHits = 3;
+  houghVtxCfg.fillNeighbours = 1;
+  houghVtxCfg.nBinsCotThetaIterZ =
+      std::vector<unsigned int>({2000, 2000, 2000});
+
+  HoughVertexFinder2 serialFinder(houghVtxCfg);
+  houghVtxCfg.executor = std::make_shared<ThreadParallelExecutor>(4);
+  HoughVertexFinder2 parallelFinder(houghVtxCfg);
+
+  std::mt19937 gen(299792458);
+
+  for (int event = 0; event < 5; event++) {
+    double vtxZ = getRndDouble(gen, -50., 50.);
+
+    SpacePointContainer2 inputSpacePoints(
+        SpacePointColumns::X | SpacePointColumns::Y | SpacePointColumns::Z);
+
+    // straight lines from the vertex crossing three cylindrical layers
+    int nTracks = getRndInt(gen, 200, 1000);
+    for (int track = 0; track < nTracks; ++track) {
+      double phi = getRndDouble(gen, -M_PI, M_PI);
+      double cotTheta = std::sinh(getRndDouble(gen, -2.5, 2.5));
+      for (int rIndx = 1; rIndx <= 3; ++rIndx) {
+        double r = rIndx * 30 + getRndDouble(gen, -1., 1.);
+        auto sp = inputSpacePoints.createSpacePoint();
+        sp.x() = r * std::cos(phi);
+        sp.y() = r * std::sin(phi);
+        sp.z() = vtxZ + r * cotTheta;
+      }
+    }
+
+    auto serialVtx = serialFinder.find(inputSpacePoints);
+    auto parallelVtx = parallelFinder.find(inputSpacePoints);
+
+    BOOST_REQUIRE(serialVtx.ok());
+    BOOST_REQUIRE(parallelVtx.ok());
+    BOOST_CHECK_EQUAL(serialVtx.value()[2], parallelVtx.value()[2]);
+    BOOST_CHECK_SMALL(serialVtx.value()[2] - vtxZ, 0.2);
+  }
+}
+
 /// @brief Unit test for HoughVertexFinder2. Provides no input space points
 BOOST_AUTO_TEST_CASE(hough_vertex_finder_empty_test) {
   HoughVertexFinder2::Config houghVtxCfg;
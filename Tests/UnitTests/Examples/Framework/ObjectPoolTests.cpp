@@ -0,0 +1,98 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Utilities/ObjectPool.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(FrameworkSuite)
+
+BOOST_AUTO_TEST_CASE(ObjectPoolReuse) {
+  std::size_t nCreated = 0;
+  ObjectPool<std::vector<int>> pool([&] {
+    ++nCreated;
+    return std::make_unique<std::vector<int>>();
+  });
+  BOOST_CHECK_EQUAL(pool.idle(), 0u);
+
+  const std::vector<int>* first = nullptr;
+  {
+    auto buffer = pool.acquire();
+    buffer->assign(100, 1);
+    first = buffer.get();
+  }
+  BOOST_CHECK_EQUAL(nCreated, 1u);
+  BOOST_CHECK_EQUAL(pool.idle(), 1u);
+
+  {
+    // the object comes back with its content and capacity
+    auto buffer = pool.acquire();
+    BOOST_CHECK_EQUAL(buffer.get(), first);
+    BOOST_CHECK_GE(buffer->capacity(), 100u);
+    BOOST_CHECK_EQUAL(pool.idle(), 0u);
+
+    // a second concurrent user gets a new object
+    auto other = pool.acquire();
+    BOOST_CHECK_NE(other.get(), buffer.get());
+    BOOST_CHECK_EQUAL(nCreated, 2u);
+
+    auto moved = std::move(other);
+    BOOST_CHECK_EQUAL(pool.idle(), 0u);
+  }
+  BOOST_CHECK_EQUAL(pool.idle(), 2u);
+
+  pool.trim();
+  BOOST_CHECK_EQUAL(pool.idle(), 0u);
+  auto buffer = pool.acquire();
+  BOOST_CHECK(buffer->empty());
+  BOOST_CHECK_EQUAL(nCreated, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(ObjectPoolConcurrent) {
+  constexpr std::size_t nThreads = 4;
+  constexpr std::size_t nIterations = 1000;
+
+  std::atomic<std::size_t> nCreated = 0;
+  ObjectPool<std::vector<int>> pool([&] {
+    ++nCreated;
+    return std::make_unique<std::vector<int>>();
+  });
+
+  std::atomic<std::size_t> nCorrupted = 0;
+  std::vector<std::thread> workers;
+  for (std::size_t t = 0; t < nThreads; ++t) {
+    workers.emplace_back([&, t] {
+      for (std::size_t i = 0; i < nIterations; ++i) {
+        auto buffer = pool.acquire();
+        buffer->assign(10, static_cast<int>(t));
+        for (int value : *buffer) {
+          nCorrupted += value != static_cast<int>(t) ? 1 : 0;
+        }
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  BOOST_CHECK_EQUAL(nCorrupted.load(), 0u);
+  BOOST_CHECK_LE(nCreated.load(), nThreads);
+  BOOST_CHECK_EQUAL(pool.idle(), nCreated.load());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -379,6 +379,46 @@ BOOST_AUTO_TEST_CASE(ExternalCollectionSupport) {
   BOOST_CHECK_NO_THROW(ownedContainer->releaseInto(frame, ""));
 }
 
+BOOST_AUTO_TEST_CASE(SharedReferenceSurfaces) {
+  using namespace HashedStringLiteral;
+
+  NullHelper helper;
+  MutablePodioTrackStateContainer<> c{
+      helper, std::make_unique<ActsPodioEdm::TrackStateCollection>(),
+      std::make_unique<ActsPodioEdm::BoundParametersCollection>(),
+      std::make_unique<ActsPodioEdm::JacobianCollection>()};
+  c.addColumn<std::int32_t>("int_column");
+
+  c.reserve(10);
+  BOOST_CHECK_EQUAL(c.size(), 0);
+
+  auto free = Surface::makeShared<PlaneSurface>(
+      Transform3::Identity(), std::make_shared<RectangleBounds>(10, 10));
+  std::weak_ptr<const Surface> weakFree = free;
+  for (std::int32_t i = 0; i < 4; ++i) {
+    auto ts = c.makeTrackState(TrackStatePropMask::All);
+    ts.setReferenceSurface(free);
+    ts.component<std::int32_t, "int_column"_hash>() = i;
+  }
+  free.reset();
+
+  // The container keeps the surface alive and all states point to it
+  BOOST_CHECK(!weakFree.expired());
+  for (TrackIndexType i = 0; i < 4; ++i) {
+    auto ts = c.getTrackState(i);
+    BOOST_CHECK_EQUAL(&ts.referenceSurface(), weakFree.lock().get());
+    BOOST_CHECK_EQUAL((ts.component<std::int32_t, "int_column"_hash>()), i);
+  }
+
+  c.clear();
+  BOOST_CHECK(weakFree.expired());
+  BOOST_CHECK_EQUAL(c.size(), 0);
+
+  auto ts = c.makeTrackState(TrackStatePropMask::All);
+  BOOST_CHECK(!ts.hasReferenceSurface());
+  BOOST_CHECK_EQUAL(ts.index(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(CopyAndMoveConstructors) {
   using namespace HashedStringLiteral;
 
@@ -0,0 +1,195 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsPlugins/Gnn/BoostTrackBuilding.hpp"
+#include "ActsPlugins/Gnn/GnnPipeline.hpp"
+#include "ActsPlugins/Gnn/KDTreeGraphConstruction.hpp"
+#include "ActsPlugins/Gnn/UnionFindTrackBuilding.hpp"
+#include "ActsTests/CommonHelpers/ThreadParallelExecutor.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
+
+using namespace Acts;
+using namespace ActsPlugins;
+
+namespace {
+
+const ExecutionContext execContextCpu{Device::Cpu(), {}};
+
+/// Edge classifier that accepts all edges
+class AcceptAllEdges final : public EdgeClassificationBase {
+ public:
+  PipelineTensors operator()(PipelineTensors tensors,
+                             const ExecutionContext &execContext) override {
+    auto scores = Tensor<float>::Create({tensors.edgeIndex.shape()[1], 1},
+                                        execContext);
+    std::fill(scores.data(), scores.data() + scores.size(), 1.f);
+    tensors.edgeScores = std::move(scores);
+    return tensors;
+  }
+};
+
+/// Build a set of straight line "tracks" in (x, y, z) with well separated
+/// hits, 4 features per node
+std::vector<float> makeTrackFeatures(std::size_t nTracks, std::size_t nHits) {
+  std::vector<float> features;
+  for (std::size_t t = 0; t < nTracks; ++t) {
+    for (std::size_t h = 0; h < nHits; ++h) {
+      features.insert(features.end(), {10.f * t, 1.f * h, 0.f, 42.f});
+    }
+  }
+  return features;
+}
+
+std::vector<std::vector<int>> sorted(std::vector<std::vector<int>> tracks) {
+  std::ranges::for_each(tracks, [](auto &t) { std::ranges::sort(t); });
+  std::ranges::sort(tracks);
+  return tracks;
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(GnnSuite)
+
+BOOST_AUTO_TEST_CASE(test_kdtree_graph_construction) {
+  const std::size_t nTracks = 5;
+  const std::size_t nHits = 6;
+  auto features = makeTrackFeatures(nTracks, nHits);
+  const std::size_t numNodes = nTracks * nHits;
+
+  KDTreeGraphConstruction::Config cfg;
+  cfg.rVal = 1.5f;
+  cfg.executor = std::make_shared<ThreadParallelExecutor>(3);
+  KDTreeGraphConstruction graphConstruction(
+      cfg, getDefaultLogger("GraphConstruction", Logging::ERROR));
+
+  auto tensors = graphConstruction(features, numNodes, {}, execContextCpu);
+
+  // The node features are not copied
+  BOOST_CHECK(tensors.nodeFeatures.data() == features.data());
+  BOOST_CHECK_EQUAL(tensors.nodeFeatures.shape()[0], numNodes);
+  BOOST_CHECK_EQUAL(tensors.nodeFeatures.shape()[1], 4u);
+
+  // Consecutive hits on a track are connected, nothing else, and the COO
+  // edge index is sorted by source and target
+  const std::size_t numEdges = tensors.edgeIndex.shape()[1];
+  BOOST_CHECK_EQUAL(numEdges, nTracks * (nHits - 1));
+
+  const auto *src = tensors.edgeIndex.data();
+  const auto *tgt = tensors.edgeIndex.data() + numEdges;
+  for (std::size_t e = 0; e < numEdges; ++e) {
+    BOOST_CHECK_EQUAL(tgt[e], src[e] + 1);
+    BOOST_CHECK_EQUAL(src[e] / nHits, tgt[e] / nHits);
+    if (e > 0) {
+      BOOST_CHECK(src[e - 1] < src[e] ||
+                  (src[e - 1] == src[e] && tgt[e - 1] < tgt[e]));
+    }
+  }
+
+  // Nodes far apart yield no edges
+  cfg.rVal = 0.5f;
+  KDTreeGraphConstruction noEdges(
+      cfg, getDefaultLogger("GraphConstruction", Logging::ERROR));
+  BOOST_CHECK_THROW(noEdges(features, numNodes, {}, execContextCpu),
+                    NoEdgesError);
+}
+
+BOOST_AUTO_TEST_CASE(test_union_find_matches_boost) {
+  const std::size_t numNodes = 5000;
+  const std::size_t numEdges = 4000;
+
+  std::vector<int> spacePointIds(numNodes);
+  std::iota(spacePointIds.begin(), spacePointIds.end(), 1000);
+
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<std::int64_t> node(0, numNodes - 1);
+
+  auto makeTensors = [&]() {
+    std::mt19937 localRng = rng;
+    auto edgeIndex =
+        Tensor<std::int64_t>::Create({2, numEdges}, execContextCpu);
+    for (std::size_t e = 0; e < 2 * numEdges; ++e) {
+      edgeIndex.data()[e] = node(localRng);
+    }
+    auto scores = Tensor<float>::Create({numEdges, 1}, execContextCpu);
+    std::fill(scores.data(), scores.data() + scores.size(), 1.f);
+    return PipelineTensors{Tensor<float>::Create({numNodes, 1}, execContextCpu),
+                           std::move(edgeIndex), std::nullopt,
+                           std::move(scores)};
+  };
+
+  BoostTrackBuilding boost({}, getDefaultLogger("Boost", Logging::ERROR));
+  auto refTracks = sorted(boost(makeTensors(), spacePointIds));
+
+  for (std::size_t nThreads : {1ul, 4ul}) {
+    UnionFindTrackBuilding::Config cfg;
+    cfg.executor = std::make_shared<ThreadParallelExecutor>(nThreads);
+    UnionFindTrackBuilding unionFind(
+        cfg, getDefaultLogger("UnionFind", Logging::ERROR));
+    auto tracks = unionFind(makeTensors(), spacePointIds);
+
+    // Components are returned in order of their first node
+    for (std::size_t i = 1; i < tracks.size(); ++i) {
+      BOOST_CHECK(tracks[i - 1].front() < tracks[i].front());
+    }
+    BOOST_CHECK(sorted(std::move(tracks)) == refTracks);
+  }
+
+  UnionFindTrackBuilding::Config cfg;
+  cfg.minCandidateSize = 2;
+  UnionFindTrackBuilding unionFind(
+      cfg, getDefaultLogger("UnionFind", Logging::ERROR));
+  auto tracks = unionFind(makeTensors(), spacePointIds);
+  BOOST_CHECK(std::ranges::all_of(
+      tracks, [](const auto &t) { return t.size() >= 2; }));
+}
+
+BOOST_AUTO_TEST_CASE(test_cpu_pipeline) {
+  const std::size_t nTracks = 8;
+  const std::size_t nHits = 5;
+  auto features = makeTrackFeatures(nTracks, nHits);
+
+  std::vector<int> spacePointIds(nTracks * nHits);
+  std::iota(spacePointIds.begin(), spacePointIds.end(), 100);
+  std::vector<std::uint64_t> moduleIds(spacePointIds.size(), 0);
+
+  KDTreeGraphConstruction::Config graphCfg;
+  graphCfg.rVal = 1.5f;
+  UnionFindTrackBuilding::Config trackCfg;
+  trackCfg.executor = std::make_shared<ThreadParallelExecutor>(2);
+
+  GnnPipeline pipeline(
+      std::make_shared<KDTreeGraphConstruction>(
+          graphCfg, getDefaultLogger("GraphConstruction", Logging::ERROR)),
+      {std::make_shared<AcceptAllEdges>()},
+      std::make_shared<UnionFindTrackBuilding>(
+          trackCfg, getDefaultLogger("UnionFind", Logging::ERROR)),
+      getDefaultLogger("Pipeline", Logging::ERROR));
+
+  auto tracks =
+      pipeline.run(features, moduleIds, spacePointIds, Device::Cpu());
+
+  BOOST_REQUIRE_EQUAL(tracks.size(), nTracks);
+  for (std::size_t t = 0; t < nTracks; ++t) {
+    std::vector<int> expected(nHits);
+    std::iota(expected.begin(), expected.end(), 100 + t * nHits);
+    BOOST_CHECK(tracks[t] == expected);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -270,6 +270,26 @@ BOOST_AUTO_TEST_CASE(test_clone_cpu) {
                                 data.begin(), data.end());
 }
 
+BOOST_AUTO_TEST_CASE(tensor_wrap_cpu) {
+  std::vector<float> data = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+  {
+    auto view = Tensor<float>::Wrap(data.data(), {2, 3}, execContextCpu);
+    BOOST_CHECK(view.data() == data.data());
+    BOOST_CHECK(view.shape()[0] == 2);
+    BOOST_CHECK(view.shape()[1] == 3);
+
+    // A moved view still refers to the same memory
+    auto moved = std::move(view);
+    moved.data()[0] = 10.f;
+    BOOST_CHECK_EQUAL(data[0], 10.f);
+
+    auto clone = moved.clone(execContextCpu);
+    BOOST_CHECK(clone.data() != data.data());
+  }
+  // Destroying the view must not release the wrapped memory
+  BOOST_CHECK_EQUAL(data[5], 6.f);
+}
+
 BOOST_AUTO_TEST_CASE(tensor_sigmoid_cpu) {
   testSigmoid({-2.f, -1.f, 0.f, 1.f, 2.f}, execContextCpu);
 }
@@ -0,0 +1,176 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsPlugins/Onnx/OnnxBatchInferenceService.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ActsPlugins;
+
+namespace ActsTests {
+
+namespace {
+
+/// Stub model returning twice the first feature of every row and recording
+/// the number of rows of every call
+struct StubModel {
+  std::mutex mutex;
+  std::vector<Eigen::Index> batchRows;
+
+  std::vector<std::vector<float>> operator()(NetworkBatchInput& input) {
+    {
+      std::lock_guard lock(mutex);
+      batchRows.push_back(input.rows());
+    }
+    std::vector<std::vector<float>> output;
+    for (Eigen::Index row = 0; row < input.rows(); ++row) {
+      output.push_back({2 * input(row, 0)});
+    }
+    return output;
+  }
+};
+
+NetworkBatchInput makeInput(std::size_t nRows, float offset) {
+  NetworkBatchInput input(nRows, 3);
+  for (std::size_t row = 0; row < nRows; ++row) {
+    input.row(row).setConstant(offset + row);
+  }
+  return input;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(OnnxSuite)
+
+BOOST_AUTO_TEST_CASE(OnnxBatchInferenceServiceOrdering) {
+  StubModel model;
+  OnnxBatchInferenceService::Config cfg;
+  cfg.maxBatchSize = 16;
+  cfg.maxLatency = std::chrono::milliseconds(20);
+  const OnnxBatchInferenceService service(
+      [&](NetworkBatchInput& input) { return model(input); }, cfg);
+
+  // concurrent callers get back exactly the rows they have sent
+  constexpr std::size_t nCallers = 8;
+  std::atomic<std::size_t> nGood = 0;
+  std::vector<std::thread> callers;
+  for (std::size_t c = 0; c < nCallers; ++c) {
+    callers.emplace_back([&, c] {
+      const std::size_t nRows = 1 + c % 5;
+      const NetworkBatchInput input = makeInput(nRows, 100.f * c);
+      const auto output = service.runONNXInference(input);
+      bool good = output.size() == nRows;
+      for (std::size_t row = 0; good && row < nRows; ++row) {
+        good = output[row].size() == 1 && output[row][0] == 2 * input(row, 0);
+      }
+      nGood += good ? 1 : 0;
+    });
+  }
+  for (auto& caller : callers) {
+    caller.join();
+  }
+  BOOST_CHECK_EQUAL(nGood, nCallers);
+
+  BOOST_CHECK(service.runONNXInference(NetworkBatchInput(0, 3)).empty());
+}
+
+BOOST_AUTO_TEST_CASE(OnnxBatchInferenceServiceMaxBatchSize) {
+  StubModel model;
+  OnnxBatchInferenceService::Config cfg;
+  cfg.maxBatchSize = 4;
+  cfg.maxLatency = std::chrono::milliseconds(50);
+  const OnnxBatchInferenceService service(
+      [&](NetworkBatchInput& input) { return model(input); }, cfg);
+
+  // requests are merged up to the maximum batch size
+  constexpr std::size_t nCallers = 6;
+  std::vector<std::thread> callers;
+  for (std::size_t c = 0; c < nCallers; ++c) {
+    callers.emplace_back([&, c] {
+      const NetworkBatchInput input = makeInput(3, 10.f * c);
+      BOOST_CHECK_EQUAL(service.runONNXInference(input).size(), 3u);
+    });
+  }
+  for (auto& caller : callers) {
+    caller.join();
+  }
+  Eigen::Index nRows = 0;
+  for (const Eigen::Index rows : model.batchRows) {
+    BOOST_CHECK_LE(rows, 4);
+    nRows += rows;
+  }
+  BOOST_CHECK_EQUAL(nRows, 3 * nCallers);
+
+  // a single request above the maximum batch size is run as one call
+  model.batchRows.clear();
+  const auto output = service.runONNXInference(makeInput(10, 0.f));
+  BOOST_CHECK_EQUAL(output.size(), 10u);
+  BOOST_REQUIRE_EQUAL(model.batchRows.size(), 1u);
+  BOOST_CHECK_EQUAL(model.batchRows.front(), 10);
+}
+
+BOOST_AUTO_TEST_CASE(OnnxBatchInferenceServiceExceptions) {
+  OnnxBatchInferenceService::Config cfg;
+  cfg.maxBatchSize = 64;
+  cfg.maxLatency = std::chrono::milliseconds(20);
+
+  // a failing model call is reported to every caller of the batch
+  const OnnxBatchInferenceService failing(
+      [](NetworkBatchInput&) -> std::vector<std::vector<float>> {
+        throw std::runtime_error("stub failure");
+      },
+      cfg);
+  constexpr std::size_t nCallers = 4;
+  std::atomic<std::size_t> nThrown = 0;
+  std::vector<std::thread> callers;
+  for (std::size_t c = 0; c < nCallers; ++c) {
+    callers.emplace_back([&, c] {
+      try {
+        failing.runONNXInference(makeInput(2, c));
+      } catch (const std::runtime_error&) {
+        ++nThrown;
+      }
+    });
+  }
+  for (auto& caller : callers) {
+    caller.join();
+  }
+  BOOST_CHECK_EQUAL(nThrown, nCallers);
+
+  // a model returning the wrong number of rows is detected
+  const OnnxBatchInferenceService truncating(
+      [](NetworkBatchInput& input) {
+        return std::vector<std::vector<float>>(input.rows() - 1, {0.f});
+      },
+      cfg);
+  BOOST_CHECK_THROW(truncating.runONNXInference(makeInput(3, 0.f)),
+                    std::runtime_error);
+
+  BOOST_CHECK_THROW(
+      OnnxBatchInferenceService(OnnxBatchInferenceService::InferenceFunction{},
+                                cfg),
+      std::invalid_argument);
+  cfg.maxBatchSize = 0;
+  StubModel model;
+  BOOST_CHECK_THROW(
+      OnnxBatchInferenceService(
+          [&](NetworkBatchInput& input) { return model(input); }, cfg),
+      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests